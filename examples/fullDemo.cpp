@@ -181,6 +181,11 @@ int main() {
   window.addOverlaySeparator();
   window.addOverlayFrameTime("Frame time: %.3f ms/frame"); // Frame time's & FPS counter's texts must be formatted
   window.addOverlayFpsCounter("FPS: %.1f");
+  window.addOverlayCheckbox("Enable GPU profiling",
+                            false,
+                            [&renderSystem] () { renderSystem.enableGpuProfiling(); },
+                            [&renderSystem] () { renderSystem.disableGpuProfiling(); });
+  window.addOverlayGpuProfiler(renderSystem.getGpuProfiler());
 
   while (app.run());
 
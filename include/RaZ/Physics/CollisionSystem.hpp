@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef RAZ_COLLISIONSYSTEM_HPP
+#define RAZ_COLLISIONSYSTEM_HPP
+
+#include <array>
+
+#include "RaZ/System.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Pair of entities whose shapes are overlapping.
+struct CollisionPair {
+  Entity* firstEntity  = nullptr;
+  Entity* secondEntity = nullptr;
+};
+
+/// System finding which entities collide with each other, according to their shapes (considered in world space).
+/// A broad phase first finds the entities whose bounding boxes overlap, using a sort and sweep along the axis on which they are the most spread;
+///   the order being kept between frames, it is only refined by an insertion sort, which is close to linear as long as entities move coherently.
+/// The narrow phase then checks the actual shapes of each overlapping pair.
+class CollisionSystem : public System {
+public:
+  CollisionSystem();
+
+  std::size_t getSweepAxis() const { return m_sweepAxis; }
+  /// Gets the pairs of entities whose bounding boxes overlap, found during the last update.
+  const std::vector<CollisionPair>& getOverlappingPairs() const { return m_overlappingPairs; }
+  /// Gets the pairs of entities whose shapes actually intersect, found during the last update.
+  const std::vector<CollisionPair>& getCollisions() const { return m_collisions; }
+
+  void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
+  /// Finds the colliding entities, which can then be recovered with getCollisions().
+  /// \param deltaTime Time elapsed since the last update.
+  /// \return True, the system always remaining active.
+  bool update(float deltaTime) override;
+
+private:
+  static constexpr std::size_t MaxShapeCount = 6;
+
+  struct Proxy {
+    Entity* entity {};
+    Vec3f minPos {};
+    Vec3f maxPos {};
+    std::array<const Shape*, MaxShapeCount> shapes {};
+    std::size_t shapeCount {};
+  };
+
+  /// Checks if any shape of a proxy intersects any shape of another.
+  /// \param proxy1 First proxy to be checked.
+  /// \param proxy2 Second proxy to be checked.
+  /// \return True if the proxies' entities collide, false otherwise.
+  static bool intersects(const Proxy& proxy1, const Proxy& proxy2);
+  /// Recovers the proxies' shapes & bounding boxes, then sorts them along the sweep axis.
+  void updateProxies();
+  /// Sweeps the sorted proxies to find those overlapping & checks their shapes, then chooses the axis along which to sort them on the next update.
+  void findPairs();
+
+  std::vector<Proxy> m_proxies {};
+  std::size_t m_sweepAxis = 0;
+  bool m_isSortNeeded = false;
+
+  std::vector<CollisionPair> m_overlappingPairs {};
+  std::vector<CollisionPair> m_collisions {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_COLLISIONSYSTEM_HPP
@@ -0,0 +1,48 @@
+#pragma once
+
+#ifndef RAZ_CONVEXHULL_HPP
+#define RAZ_CONVEXHULL_HPP
+
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+class Mesh;
+
+/// Convex shape defined by a cloud of points, allowing convex meshes to be checked by GJK & EPA.
+/// The points do not have to form an actual hull: any point inside it is simply never retained as a support point.
+class ConvexHull {
+public:
+  ConvexHull() = default;
+  explicit ConvexHull(std::vector<Vec3f> points) : m_points{ std::move(points) } {}
+  /// Creates a hull enclosing all the vertices of a mesh, considered convex.
+  /// \param mesh Mesh to recover the vertices from.
+  explicit ConvexHull(const Mesh& mesh);
+
+  const std::vector<Vec3f>& getPoints() const { return m_points; }
+  std::size_t getPointCount() const { return m_points.size(); }
+
+  /// Transforms all the points of the hull, to place it in world space.
+  /// \param transform Transformation matrix to be applied.
+  void transform(const Mat4f& transform);
+  /// Computes the point of the hull farthest in a given direction.
+  /// The hull must not be empty.
+  /// \param direction Direction in which to find the point.
+  /// \return Support point of the hull.
+  Vec3f computeSupportPoint(const Vec3f& direction) const;
+  /// Computes the axis-aligned bounding box enclosing the hull.
+  /// The hull must not be empty.
+  /// \return Bounding box of the hull.
+  AABB computeBoundingBox() const;
+
+private:
+  std::vector<Vec3f> m_points {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_CONVEXHULL_HPP
@@ -0,0 +1,154 @@
+#pragma once
+
+#ifndef RAZ_GJK_HPP
+#define RAZ_GJK_HPP
+
+#include <array>
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+/// Narrow-phase algorithms working on any convex shape able to give its support point, that is its farthest point in a given direction.
+/// Such a shape must provide a 'Vec3f computeSupportPoint(const Vec3f& direction) const' member function.
+/// The algorithms work on the Minkowski difference of both shapes, which contains the origin if & only if the shapes intersect.
+/// See: A fast procedure for computing the distance between complex objects in three-dimensional space (Gilbert, Johnson & Keerthi), 1988
+namespace Gjk {
+
+/// Point of the Minkowski difference, along with the shapes' points it comes from.
+struct SupportPoint {
+  Vec3f point {};
+  Vec3f firstPoint {};
+  Vec3f secondPoint {};
+  Vec3f direction {};
+};
+
+/// Information about the penetration of two intersecting shapes.
+struct PenetrationInfo {
+  Vec3f normal {};      ///< Direction in which the second shape must be moved to separate it from the first one.
+  float depth {};       ///< Distance by which the second shape must be moved along the normal.
+  Vec3f firstPoint {};  ///< Deepest point of the first shape inside the second one.
+  Vec3f secondPoint {}; ///< Deepest point of the second shape inside the first one.
+};
+
+/// Set of up to 4 points of the Minkowski difference, forming a point, a line, a triangle or a tetrahedron.
+/// Keeping the simplex of a query & giving it back to the next one on the same shapes warm-starts it:
+///   the directions used to find its points are reused, which generally makes the query converge in very few iterations if the shapes moved little.
+class Simplex {
+public:
+  std::size_t getSize() const { return m_size; }
+  const SupportPoint& operator[](std::size_t index) const { return m_points[index]; }
+
+  bool isEmpty() const { return (m_size == 0); }
+  /// Adds a point to the simplex, which must not already contain 4 points.
+  /// \param point Point to be added.
+  void addPoint(const SupportPoint& point) { m_points[m_size++] = point; }
+  /// Replaces the point at the given index.
+  /// \param index Index of the point to be replaced.
+  /// \param point New point.
+  void setPoint(std::size_t index, const SupportPoint& point) { m_points[index] = point; }
+  /// Finds the point of the simplex closest to the origin, keeping only the simplex's points needed to define it.
+  /// \return Closest point to the origin; if the simplex is a tetrahedron containing the origin, it is kept as is & the origin is returned.
+  Vec3f reduce();
+  /// Computes the points of both shapes from which the simplex's closest point to the origin comes from; reduce() must have been called before.
+  /// \param firstPoint Computed closest point of the first shape.
+  /// \param secondPoint Computed closest point of the second shape.
+  void computeClosestPoints(Vec3f& firstPoint, Vec3f& secondPoint) const;
+  /// Removes all points from the simplex.
+  void clear() { m_size = 0; }
+
+private:
+  std::array<SupportPoint, 4> m_points {};
+  std::array<float, 4> m_weights {};
+  std::size_t m_size = 0;
+};
+
+namespace Detail {
+
+/// Convex polytope enclosing the origin, expanded by the EPA toward the boundary of the Minkowski difference.
+class ExpandingPolytope {
+public:
+  /// Creates the polytope from a tetrahedron enclosing the origin.
+  /// \param simplex Tetrahedron to create the polytope from.
+  explicit ExpandingPolytope(const Simplex& simplex);
+
+  /// Finds the face of the polytope closest to the origin.
+  /// \param distance Distance of the closest face to the origin.
+  /// \return Outward normal of the closest face.
+  Vec3f findClosestFace(float& distance) const;
+  /// Adds a point to the polytope, replacing all the faces it can see by new ones joining it to the remaining faces.
+  /// \param point Point to be added.
+  /// \return True if the polytope has been expanded, false if the point is not outside of it.
+  bool expand(const SupportPoint& point);
+  /// Computes the penetration information from the face closest to the origin.
+  /// \param penetration Penetration information to be filled.
+  void computePenetration(PenetrationInfo& penetration) const;
+
+private:
+  struct Face {
+    std::array<std::size_t, 3> indices {};
+    Vec3f normal {};
+    float distance {};
+  };
+
+  void addFace(std::size_t firstIndex, std::size_t secondIndex, std::size_t thirdIndex);
+  std::size_t findClosestFaceIndex() const;
+
+  std::vector<SupportPoint> m_points {};
+  std::vector<Face> m_faces {};
+  std::vector<std::pair<std::size_t, std::size_t>> m_edges {};
+  Vec3f m_innerPoint {};
+};
+
+} // namespace Detail
+
+/// Computes the point of the Minkowski difference of two shapes farthest in a given direction.
+/// \tparam ShapeT1 Type of the first shape.
+/// \tparam ShapeT2 Type of the second shape.
+/// \param firstShape First shape.
+/// \param secondShape Second shape.
+/// \param direction Direction in which to find the point.
+/// \return Support point of the Minkowski difference.
+template <typename ShapeT1, typename ShapeT2>
+SupportPoint computeSupportPoint(const ShapeT1& firstShape, const ShapeT2& secondShape, const Vec3f& direction);
+/// Checks if two convex shapes intersect each other.
+/// \tparam ShapeT1 Type of the first shape.
+/// \tparam ShapeT2 Type of the second shape.
+/// \param firstShape First shape to be checked.
+/// \param secondShape Second shape to be checked.
+/// \param simplex Optional simplex to warm-start the check from, updated with the final simplex; if the shapes intersect, it contains the origin.
+/// \return True if the shapes intersect each other, false otherwise.
+template <typename ShapeT1, typename ShapeT2>
+bool intersects(const ShapeT1& firstShape, const ShapeT2& secondShape, Simplex* simplex = nullptr);
+/// Computes the distance between two convex shapes, along with their closest points.
+/// \tparam ShapeT1 Type of the first shape.
+/// \tparam ShapeT2 Type of the second shape.
+/// \param firstShape First shape.
+/// \param secondShape Second shape.
+/// \param firstPoint Optional point of the first shape closest to the second one.
+/// \param secondPoint Optional point of the second shape closest to the first one.
+/// \param simplex Optional simplex to warm-start the computation from, updated with the final simplex.
+/// \return Distance between both shapes; 0 if they intersect.
+template <typename ShapeT1, typename ShapeT2>
+float computeDistance(const ShapeT1& firstShape, const ShapeT2& secondShape,
+                      Vec3f* firstPoint = nullptr, Vec3f* secondPoint = nullptr, Simplex* simplex = nullptr);
+/// Computes how much two convex shapes penetrate each other, using the Expanding Polytope Algorithm (EPA) from the simplex enclosing the origin.
+/// See: Proximity Queries and Penetration Depth Computation on 3D Game Objects (Gino van den Bergen), 2001
+/// \tparam ShapeT1 Type of the first shape.
+/// \tparam ShapeT2 Type of the second shape.
+/// \param firstShape First shape.
+/// \param secondShape Second shape.
+/// \param penetration Penetration information, filled if the shapes intersect.
+/// \param simplex Optional simplex to warm-start the intersection check from, updated with its final simplex.
+/// \return True if the shapes intersect each other, false otherwise. If they are only touching, the depth is 0 & the normal may be null.
+template <typename ShapeT1, typename ShapeT2>
+bool computePenetration(const ShapeT1& firstShape, const ShapeT2& secondShape, PenetrationInfo& penetration, Simplex* simplex = nullptr);
+
+} // namespace Gjk
+
+} // namespace Raz
+
+#include "RaZ/Physics/Gjk.inl"
+
+#endif // RAZ_GJK_HPP
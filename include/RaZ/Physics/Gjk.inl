@@ -0,0 +1,189 @@
+namespace Raz {
+
+namespace Gjk {
+
+namespace Detail {
+
+constexpr std::size_t MaxIterationCount = 64;
+constexpr float IntersectionTolerance   = 1e-10f;
+constexpr float ConvergenceTolerance    = 1e-6f;
+constexpr float PenetrationTolerance    = 1e-4f;
+
+/// Runs the GJK algorithm, iteratively finding the point of the Minkowski difference closest to the origin.
+/// \param stopOnSeparation True to stop as soon as the shapes are known not to intersect, false to find their actual closest points.
+/// \return True if the shapes intersect each other, false otherwise.
+template <typename ShapeT1, typename ShapeT2>
+bool runGjk(const ShapeT1& firstShape, const ShapeT2& secondShape, Simplex& simplex, Vec3f& closestPoint, bool stopOnSeparation) {
+  if (simplex.isEmpty()) {
+    simplex.addPoint(computeSupportPoint(firstShape, secondShape, Axis::X));
+  } else {
+    // Warm-starting from the previous simplex, whose points are recomputed since the shapes may have moved
+    for (std::size_t pointIndex = 0; pointIndex < simplex.getSize(); ++pointIndex)
+      simplex.setPoint(pointIndex, computeSupportPoint(firstShape, secondShape, simplex[pointIndex].direction));
+  }
+
+  for (std::size_t iterationIndex = 0; iterationIndex < MaxIterationCount; ++iterationIndex) {
+    closestPoint = simplex.reduce();
+
+    const float sqDist = closestPoint.computeSquaredLength();
+
+    if (simplex.getSize() == 4 || sqDist <= IntersectionTolerance)
+      return true;
+
+    const Vec3f direction      = -closestPoint;
+    const SupportPoint support = computeSupportPoint(firstShape, secondShape, direction);
+    const float supportDist    = support.point.dot(direction);
+
+    // If the farthest point in the origin's direction does not reach it, the direction separates both shapes
+    if (stopOnSeparation && supportDist < 0.f)
+      return false;
+
+    // If the new point does not get significantly closer to the origin, the closest point has been found
+    if (sqDist + supportDist <= sqDist * ConvergenceTolerance)
+      return false;
+
+    simplex.addPoint(support);
+  }
+
+  return (closestPoint.computeSquaredLength() <= IntersectionTolerance);
+}
+
+/// Adds points to a simplex enclosing the origin until it forms a non-flat tetrahedron.
+/// \return True if a tetrahedron has been formed, false if the Minkowski difference is flat in the searched directions.
+template <typename ShapeT1, typename ShapeT2>
+bool completeTetrahedron(const ShapeT1& firstShape, const ShapeT2& secondShape, Simplex& simplex) {
+  while (simplex.getSize() < 4) {
+    const Vec3f& firstPoint = simplex[0].point;
+    std::array<Vec3f, 6> directions {};
+    Vec3f referenceVec;
+
+    if (simplex.getSize() == 1) {
+      directions = {{ Axis::X, -Axis::X, Axis::Y, -Axis::Y, Axis::Z, -Axis::Z }};
+    } else if (simplex.getSize() == 2) {
+      referenceVec = simplex[1].point - firstPoint;
+
+      const Vec3f firstOrtho = referenceVec.cross(std::abs(referenceVec[0]) < std::abs(referenceVec[1]) ? Axis::X : Axis::Y);
+      const Vec3f secondOrtho = referenceVec.cross(firstOrtho);
+
+      directions = {{ firstOrtho, -firstOrtho, secondOrtho, -secondOrtho, firstOrtho + secondOrtho, -firstOrtho - secondOrtho }};
+    } else {
+      referenceVec = (simplex[1].point - firstPoint).cross(simplex[2].point - firstPoint);
+      directions   = {{ referenceVec, -referenceVec, referenceVec, -referenceVec, referenceVec, -referenceVec }};
+    }
+
+    bool hasAddedPoint = false;
+
+    for (const Vec3f& direction : directions) {
+      const SupportPoint support = computeSupportPoint(firstShape, secondShape, direction);
+      const Vec3f pointDir       = support.point - firstPoint;
+
+      bool isDegenerate = false;
+
+      if (simplex.getSize() == 1)
+        isDegenerate = (pointDir.computeSquaredLength() <= IntersectionTolerance);
+      else if (simplex.getSize() == 2)
+        isDegenerate = (pointDir.cross(referenceVec).computeSquaredLength() <= IntersectionTolerance * referenceVec.computeSquaredLength());
+      else
+        isDegenerate = (std::abs(pointDir.dot(referenceVec)) <= IntersectionTolerance * referenceVec.computeLength());
+
+      if (!isDegenerate) {
+        simplex.addPoint(support);
+        hasAddedPoint = true;
+        break;
+      }
+    }
+
+    if (!hasAddedPoint)
+      return false;
+  }
+
+  return true;
+}
+
+} // namespace Detail
+
+template <typename ShapeT1, typename ShapeT2>
+SupportPoint computeSupportPoint(const ShapeT1& firstShape, const ShapeT2& secondShape, const Vec3f& direction) {
+  SupportPoint support;
+
+  support.firstPoint  = firstShape.computeSupportPoint(direction);
+  support.secondPoint = secondShape.computeSupportPoint(-direction);
+  support.point       = support.firstPoint - support.secondPoint;
+  support.direction   = direction;
+
+  return support;
+}
+
+template <typename ShapeT1, typename ShapeT2>
+bool intersects(const ShapeT1& firstShape, const ShapeT2& secondShape, Simplex* simplex) {
+  Simplex localSimplex;
+  Vec3f closestPoint;
+
+  return Detail::runGjk(firstShape, secondShape, (simplex ? *simplex : localSimplex), closestPoint, true);
+}
+
+template <typename ShapeT1, typename ShapeT2>
+float computeDistance(const ShapeT1& firstShape, const ShapeT2& secondShape, Vec3f* firstPoint, Vec3f* secondPoint, Simplex* simplex) {
+  Simplex localSimplex;
+  Simplex& usedSimplex = (simplex ? *simplex : localSimplex);
+  Vec3f closestPoint;
+
+  if (Detail::runGjk(firstShape, secondShape, usedSimplex, closestPoint, false))
+    return 0.f;
+
+  if (firstPoint || secondPoint) {
+    Vec3f firstClosestPoint, secondClosestPoint;
+    usedSimplex.computeClosestPoints(firstClosestPoint, secondClosestPoint);
+
+    if (firstPoint)
+      *firstPoint = firstClosestPoint;
+
+    if (secondPoint)
+      *secondPoint = secondClosestPoint;
+  }
+
+  return closestPoint.computeLength();
+}
+
+template <typename ShapeT1, typename ShapeT2>
+bool computePenetration(const ShapeT1& firstShape, const ShapeT2& secondShape, PenetrationInfo& penetration, Simplex* simplex) {
+  Simplex localSimplex;
+  Simplex& usedSimplex = (simplex ? *simplex : localSimplex);
+  Vec3f closestPoint;
+
+  if (!Detail::runGjk(firstShape, secondShape, usedSimplex, closestPoint, true))
+    return false;
+
+  // The polytope must start from a tetrahedron; the shapes merely touching each other or being flat may have given a smaller simplex
+  Simplex tetrahedron = usedSimplex;
+
+  if (!Detail::completeTetrahedron(firstShape, secondShape, tetrahedron)) {
+    penetration = PenetrationInfo();
+    usedSimplex.computeClosestPoints(penetration.firstPoint, penetration.secondPoint);
+
+    return true;
+  }
+
+  Detail::ExpandingPolytope polytope(tetrahedron);
+
+  for (std::size_t iterationIndex = 0; iterationIndex < Detail::MaxIterationCount; ++iterationIndex) {
+    float faceDist {};
+    const Vec3f faceNormal     = polytope.findClosestFace(faceDist);
+    const SupportPoint support = computeSupportPoint(firstShape, secondShape, faceNormal);
+
+    // If the farthest point in the face's direction is not significantly beyond it, the face is on the Minkowski difference's boundary
+    if (support.point.dot(faceNormal) - faceDist <= Detail::PenetrationTolerance)
+      break;
+
+    if (!polytope.expand(support))
+      break;
+  }
+
+  polytope.computePenetration(penetration);
+
+  return true;
+}
+
+} // namespace Gjk
+
+} // namespace Raz
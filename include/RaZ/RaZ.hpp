@@ -14,27 +14,53 @@
 #include "Math/Quaternion.hpp"
 #include "Math/Transform.hpp"
 #include "Math/Vector.hpp"
+#include "Physics/CollisionSystem.hpp"
+#include "Physics/ConvexHull.hpp"
+#include "Physics/Gjk.hpp"
 #include "Render/Camera.hpp"
 #include "Render/Cubemap.hpp"
+#include "Render/DeferredRenderer.hpp"
 #include "Render/Framebuffer.hpp"
+#include "Render/FrameGraph.hpp"
+#include "Render/GeometryArena.hpp"
+#include "Render/GpuProfiler.hpp"
 #include "Render/GraphicObjects.hpp"
-#include "Render/RenderSystem.hpp"
 #include "Render/Light.hpp"
+#include "Render/LightBuffer.hpp"
+#include "Render/LightClusterGrid.hpp"
+#include "Render/LodSelector.hpp"
 #include "Render/Material.hpp"
 #include "Render/Mesh.hpp"
+#include "Render/MeshInstance.hpp"
+#include "Render/MeshOptimizer.hpp"
+#include "Render/MeshSimplifier.hpp"
+#include "Render/OcclusionBuffer.hpp"
+#include "Render/RayTracer.hpp"
+#include "Render/RenderQueue.hpp"
+#include "Render/RenderSystem.hpp"
+#include "Render/RingBuffer.hpp"
 #include "Render/Shader.hpp"
 #include "Render/ShaderProgram.hpp"
+#include "Render/StateCache.hpp"
 #include "Render/Submesh.hpp"
 #include "Render/Texture.hpp"
+#include "Render/TextureStreamer.hpp"
 #include "Render/UniformBuffer.hpp"
+#include "Render/VertexLayout.hpp"
 #include "Utils/Bitset.hpp"
+#include "Utils/BoundingVolumeHierarchy.hpp"
 #include "Utils/FileUtils.hpp"
+#include "Utils/Frustum.hpp"
 #include "Utils/Image.hpp"
 #include "Utils/Input.hpp"
 #include "Utils/Overlay.hpp"
+#include "Utils/RangeAllocator.hpp"
 #include "Utils/Ray.hpp"
+#include "Utils/RayPacket.hpp"
 #include "Utils/Shape.hpp"
+#include "Utils/Simd.hpp"
 #include "Utils/StrUtils.hpp"
+#include "Utils/ThreadPool.hpp"
 #include "Utils/Window.hpp"
 
 #endif // RAZ_RAZ_HPP
@@ -21,7 +21,10 @@ public:
          float fieldOfViewDegrees = 45.f,
          float nearPlane = 0.1f, float farPlane = 100.f);
 
+  float getFieldOfViewRadians() const { return m_fieldOfView; }
   float getFieldOfViewDegrees() const { return m_fieldOfView * 180.f / PI<float>; }
+  float getNearPlane() const { return m_nearPlane; }
+  float getFarPlane() const { return m_farPlane; }
   const Mat4f& getViewMatrix() const { return m_viewMat; }
   const Mat4f& getInverseViewMatrix() const { return m_invViewMat; }
   const Mat4f& getProjectionMatrix() const { return m_projMat; }
@@ -35,8 +35,8 @@ public:
   void load(const std::string& rightTexturePath, const std::string& leftTexturePath,
             const std::string& topTexturePath, const std::string& bottomTexturePath,
             const std::string& frontTexturePath, const std::string& backTexturePath);
-  void bind() const { glBindTexture(GL_TEXTURE_CUBE_MAP, m_index); }
-  void unbind() const { glBindTexture(GL_TEXTURE_CUBE_MAP, 0); }
+  void bind() const { StateCache::get().bindTexture(GL_TEXTURE_CUBE_MAP, m_index); }
+  void unbind() const { StateCache::get().bindTexture(GL_TEXTURE_CUBE_MAP, 0); }
   void draw(const Camera& camera) const;
 
 private:
@@ -0,0 +1,89 @@
+#pragma once
+
+#ifndef RAZ_DEFERREDRENDERER_HPP
+#define RAZ_DEFERREDRENDERER_HPP
+
+#include <vector>
+
+#include "GL/glew.h"
+#include "RaZ/Render/ShaderProgram.hpp"
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+class DeferredRenderer;
+using DeferredRendererPtr = std::unique_ptr<DeferredRenderer>;
+
+/// Deferred shading, in which the scene's surfaces are first written to a G-buffer, lights then being applied once per lit pixel.
+/// The geometry pass' program writes the albedo & metallic factor, the world-space normal & roughness, the depth & the ambient lighting,
+/// respectively to its outputs 0 to 3 (see shaders/gbuffer.glsl). The depth is written to a color attachment, as the depth attachment
+/// cannot be read while it bounds the light volumes.
+/// Each light is then additively blended into the lighting buffer: lights with a finite range are drawn as the back faces of the box
+/// enclosing their range, only where the scene is in front of them; the others cover the whole screen. The lighting buffer, in high dynamic
+/// range, is finally tone mapped to the screen.
+class DeferredRenderer {
+public:
+  /// Location of the outputs of the geometry pass.
+  static constexpr GLuint AlbedoMetallicLocation  = 0;
+  static constexpr GLuint NormalRoughnessLocation = 1;
+  static constexpr GLuint DepthLocation           = 2;
+  static constexpr GLuint LightLocation           = 3;
+
+  /// Creates a deferred renderer.
+  /// \param width Width of the G-buffer, which should be the window's one.
+  /// \param height Height of the G-buffer, which should be the window's one.
+  /// \param lightingFragShaderPath Path to the fragment shader applying a single light (see shaders/deferred-cook-torrance.glsl).
+  /// \param framebufferIndex Index of the window's framebuffer, bound back once the G-buffer is created (see Window::getFramebufferIndex()).
+  DeferredRenderer(unsigned int width, unsigned int height, const std::string& lightingFragShaderPath, GLuint framebufferIndex = 0);
+  DeferredRenderer(const DeferredRenderer&) = delete;
+  DeferredRenderer(DeferredRenderer&&) = delete;
+
+  unsigned int getWidth() const { return m_width; }
+  unsigned int getHeight() const { return m_height; }
+  const TexturePtr& getDepthBuffer() const { return m_depthBuffer; }
+  const TexturePtr& getAlbedoMetallicBuffer() const { return m_albedoMetallicBuffer; }
+  const TexturePtr& getNormalRoughnessBuffer() const { return m_normalRoughnessBuffer; }
+  const TexturePtr& getDepthCopyBuffer() const { return m_depthCopyBuffer; }
+  const TexturePtr& getLightBuffer() const { return m_lightBuffer; }
+  const ShaderProgram& getLightingProgram() const { return m_lightingProgram; }
+
+  template <typename... Args>
+  static DeferredRendererPtr create(Args&&... args) { return std::make_unique<DeferredRenderer>(std::forward<Args>(args)...); }
+
+  /// Assigns the G-buffer's texture units to the programs' samplers.
+  void initBuffers() const;
+  /// Reloads the lighting program's shaders, assigning its samplers again.
+  void updateShaders() const;
+  /// Binds & clears the G-buffer, to be rendered into by the geometry pass.
+  void bindGeometryPass() const;
+  /// Adds the lights' contributions to the lighting buffer, reading the G-buffer. The lights' data must be bound.
+  /// \param lightVolumes Spheres of influence of the lights, whose indices are the ones of the lights' data; an infinite radius covers the whole screen.
+  /// \param cameraPos Position of the camera; volumes containing it cover the whole screen, their back faces possibly being beyond the far plane.
+  void applyLights(const std::vector<Sphere>& lightVolumes, const Vec3f& cameraPos) const;
+  /// Tone maps the lighting buffer to the window's framebuffer, also restoring the scene's depth so that it can be drawn over.
+  /// Pixels with nothing drawn are left untouched.
+  /// \param framebufferIndex Index of the window's framebuffer (see Window::getFramebufferIndex()).
+  void resolve(GLuint framebufferIndex = 0) const;
+
+  DeferredRenderer& operator=(const DeferredRenderer&) = delete;
+  DeferredRenderer& operator=(DeferredRenderer&&) = delete;
+
+  ~DeferredRenderer() { StateCache::get().deleteFramebuffer(m_index); }
+
+private:
+  unsigned int m_width {};
+  unsigned int m_height {};
+  GLuint m_index {};
+  TexturePtr m_depthBuffer {};
+  TexturePtr m_albedoMetallicBuffer {};
+  TexturePtr m_normalRoughnessBuffer {};
+  TexturePtr m_depthCopyBuffer {};
+  TexturePtr m_lightBuffer {};
+  ShaderProgram m_lightingProgram {};
+  ShaderProgram m_resolveProgram {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_DEFERREDRENDERER_HPP
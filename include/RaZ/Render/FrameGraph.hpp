@@ -0,0 +1,167 @@
+#pragma once
+
+#ifndef RAZ_FRAMEGRAPH_HPP
+#define RAZ_FRAMEGRAPH_HPP
+
+#include <array>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+#include "RaZ/Render/Texture.hpp"
+
+namespace Raz {
+
+/// Properties of a texture created by a frame graph; transient textures sharing the same properties can be aliased.
+struct FrameGraphTextureDescriptor {
+  bool operator==(const FrameGraphTextureDescriptor& descriptor) const {
+    return (width == descriptor.width && height == descriptor.height && colorspace == descriptor.colorspace && dataType == descriptor.dataType);
+  }
+  bool operator!=(const FrameGraphTextureDescriptor& descriptor) const { return !(*this == descriptor); }
+
+  unsigned int width {};
+  unsigned int height {};
+  ImageColorspace colorspace = ImageColorspace::RGBA;
+  ImageDataType dataType = ImageDataType::BYTE;
+};
+
+class FrameGraph;
+class GpuProfiler;
+
+/// Render pass of a frame graph, reading & writing textures.
+struct FrameGraphPass {
+  using ExecuteFunc = std::function<void(const FrameGraph&)>;
+
+  std::string name {};
+  ExecuteFunc execute {};
+  std::vector<std::size_t> inputs {};
+  std::vector<std::size_t> outputs {};
+  /// If true, the pass has effects outside of the graph (like drawing to the screen) & is never culled.
+  bool hasSideEffects {};
+};
+
+/// Graph of render passes declaring the textures they read & write, from which their order & the textures' allocation are deduced.
+/// Passes whose outputs are not used, directly or not, by a pass having side effects or by an output texture are culled. The remaining
+/// ones are ordered so that each pass runs after those writing its inputs, or writing the same outputs before it; passes otherwise keep
+/// their declaration order. Transient textures are only needed from the first to the last pass using them: those whose lifetimes do not
+/// overlap & sharing the same properties are aliased onto the same texture, taken from a pool kept between frames.
+/// Imported textures are owned outside of the graph; they are never aliased, & the passes writing them are considered as having side effects.
+class FrameGraph {
+public:
+  static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+  FrameGraph() = default;
+  FrameGraph(const FrameGraph&) = delete;
+  FrameGraph(FrameGraph&&) = delete;
+
+  std::size_t getPassCount() const { return m_passes.size(); }
+  const FrameGraphPass& getPass(std::size_t passIndex) const { return m_passes[passIndex]; }
+  std::size_t getTextureCount() const { return m_textures.size(); }
+  /// Gets the indices of the passes to be executed, in their execution order. The graph must have been compiled.
+  const std::vector<std::size_t>& getExecutionOrder() const { return m_executionOrder; }
+  /// Gets the number of distinct textures the transient ones are aliased onto. The graph must have been compiled.
+  std::size_t getPhysicalTextureCount() const { return m_physicalDescriptors.size(); }
+  /// Gets the index of the physical texture a transient texture is aliased onto. The graph must have been compiled.
+  /// \param textureIndex Index of the transient texture.
+  /// \return Index of the physical texture, or InvalidIndex if the texture is imported or unused.
+  std::size_t getPhysicalTextureIndex(std::size_t textureIndex) const { return m_textures[textureIndex].physicalIndex; }
+  /// Checks if a pass has been culled. The graph must have been compiled.
+  /// \param passIndex Index of the pass to be checked.
+  /// \return True if the pass will not be executed, false otherwise.
+  bool isPassCulled(std::size_t passIndex) const;
+  /// Recovers the texture a graph texture currently refers to, either the imported one or a pooled one. It is only valid during the execution.
+  /// \param textureIndex Index of the graph texture.
+  /// \return Texture to be read or written.
+  const Texture& getTexture(std::size_t textureIndex) const;
+
+  /// Sets the framebuffer the passes without outputs render into, along with the viewport restored when binding it.
+  /// \param framebufferIndex Index of the framebuffer; 0 by default, or the window's one if it is headless (see Window::getFramebufferIndex()).
+  /// \param width Width of the framebuffer's viewport; if either dimension is 0, the viewport set before the execution is restored.
+  /// \param height Height of the framebuffer's viewport.
+  void setDefaultFramebuffer(GLuint framebufferIndex, unsigned int width = 0, unsigned int height = 0) {
+    m_defaultFramebufferIndex = framebufferIndex;
+    m_defaultViewportWidth    = width;
+    m_defaultViewportHeight   = height;
+  }
+  /// Declares a texture created by the graph, only valid during the passes using it.
+  /// \param name Name of the texture.
+  /// \param descriptor Properties of the texture.
+  /// \return Index of the texture.
+  std::size_t addTexture(std::string name, const FrameGraphTextureDescriptor& descriptor);
+  /// Declares a texture owned outside of the graph.
+  /// \param name Name of the texture.
+  /// \param texture Texture to be imported.
+  /// \param descriptor Properties of the texture, setting the viewport when it is written.
+  /// \return Index of the texture.
+  std::size_t importTexture(std::string name, TexturePtr texture, const FrameGraphTextureDescriptor& descriptor);
+  /// Marks a texture as being used after the graph's execution, preventing the passes writing it from being culled.
+  /// \param textureIndex Index of the texture.
+  void markOutput(std::size_t textureIndex) { m_textures[textureIndex].isOutput = true; }
+  /// Adds a pass. Its execution function is called with the pass' outputs bound as the framebuffer's attachments, in their declaration
+  /// order (depth textures being bound as the depth attachment), & the viewport covering them; passes without output render to the screen.
+  /// \param name Name of the pass.
+  /// \param execute Function issuing the pass' draws.
+  /// \param hasSideEffects True if the pass has effects outside of the graph, preventing it from being culled.
+  /// \return Index of the pass.
+  std::size_t addPass(std::string name, FrameGraphPass::ExecuteFunc execute, bool hasSideEffects = false);
+  /// Declares a texture as being read by a pass.
+  /// \param passIndex Index of the pass.
+  /// \param textureIndex Index of the texture.
+  void addPassInput(std::size_t passIndex, std::size_t textureIndex) { m_passes[passIndex].inputs.emplace_back(textureIndex); }
+  /// Declares a texture as being written by a pass.
+  /// \param passIndex Index of the pass.
+  /// \param textureIndex Index of the texture.
+  void addPassOutput(std::size_t passIndex, std::size_t textureIndex) { m_passes[passIndex].outputs.emplace_back(textureIndex); }
+  /// Culls the unneeded passes, orders the others & aliases the transient textures. Throws an exception if the passes depend on each other.
+  void compile();
+  /// Executes the compiled passes in order, allocating the physical textures which are missing from the pool beforehand.
+  /// The default framebuffer & its viewport are bound back afterward.
+  /// \param gpuProfiler Optional GPU profiler timing each pass in a scope named after it.
+  void execute(GpuProfiler* gpuProfiler = nullptr);
+  /// Removes all passes & textures, to declare the next frame's ones. The pooled textures are kept to be reused.
+  void clear();
+
+  FrameGraph& operator=(const FrameGraph&) = delete;
+  FrameGraph& operator=(FrameGraph&&) = delete;
+
+  ~FrameGraph();
+
+private:
+  struct TextureResource {
+    std::string name {};
+    FrameGraphTextureDescriptor descriptor {};
+    TexturePtr importedTexture {};
+    bool isOutput {};
+    std::size_t physicalIndex = InvalidIndex;
+  };
+
+  struct PooledTexture {
+    FrameGraphTextureDescriptor descriptor {};
+    TexturePtr texture {};
+  };
+
+  /// Binds the framebuffer with a pass' outputs as attachments, or the screen's framebuffer if the pass has no output.
+  /// \param pass Pass to bind the outputs of.
+  void bindOutputs(const FrameGraphPass& pass);
+  /// Binds the default framebuffer & restores its viewport.
+  void bindDefaultFramebuffer() const;
+
+  std::vector<FrameGraphPass> m_passes {};
+  std::vector<TextureResource> m_textures {};
+  std::vector<bool> m_culledPasses {};
+  std::vector<std::size_t> m_executionOrder {};
+  std::vector<FrameGraphTextureDescriptor> m_physicalDescriptors {};
+  std::vector<PooledTexture> m_texturePool {};
+  GLuint m_framebufferIndex {};
+  GLuint m_defaultFramebufferIndex {};
+  unsigned int m_defaultViewportWidth {};
+  unsigned int m_defaultViewportHeight {};
+  std::array<GLint, 4> m_defaultViewport {};
+  std::size_t m_boundColorAttachmentCount {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_FRAMEGRAPH_HPP
@@ -29,14 +29,17 @@ public:
   static FramebufferPtr create(Args&&... args) { return std::make_unique<Framebuffer>(std::forward<Args>(args)...); }
 
   void initBuffers() const;
+  /// Binds & clears the framebuffer, remembering the one which was bound before.
   void bind() const;
-  void unbind() const { glBindFramebuffer(GL_FRAMEBUFFER, 0); }
+  /// Binds back the framebuffer which was bound before the last call to bind(), like the window's one if it is headless.
+  void unbind() const { StateCache::get().bindFramebuffer(m_previousIndex); }
   void display() const;
 
-  ~Framebuffer() { glDeleteFramebuffers(1, &m_index); }
+  ~Framebuffer() { StateCache::get().deleteFramebuffer(m_index); }
 
 private:
   GLuint m_index;
+  mutable GLuint m_previousIndex {};
   TexturePtr m_depthBuffer;
   TexturePtr m_colorBuffer;
   TexturePtr m_normalBuffer;
@@ -0,0 +1,98 @@
+#pragma once
+
+#ifndef RAZ_GEOMETRYARENA_HPP
+#define RAZ_GEOMETRYARENA_HPP
+
+#include <vector>
+
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Utils/RangeAllocator.hpp"
+
+namespace Raz {
+
+/// Location of a geometry in an arena's buffers, in number of vertices & indices. Indices are relative to the first vertex.
+struct GeometryRange {
+  std::size_t firstVertex {};
+  std::size_t vertexCount {};
+  std::size_t firstIndex {};
+  std::size_t indexCount {};
+};
+
+/// Shared vertex & index buffers holding many geometries, drawn through a single vertex array.
+/// Geometries are sub-allocated in the buffers, which are defragmented when a geometry does not fit in any free range
+/// despite there being enough space overall, and grown otherwise. Geometries are thus referred to by handles, their ranges possibly moving.
+/// As their indices are relative to their first vertex, they must be drawn with a base vertex; this also lets 16-bit indices address
+/// any geometry of up to 65536 vertices, regardless of its location.
+class GeometryArena {
+public:
+  /// Creates a geometry arena.
+  /// \param layout Layout of the vertices; positions cannot be quantized, as their bounds would differ for each geometry.
+  /// \param indexType Type of the indices, either GL_UNSIGNED_INT or GL_UNSIGNED_SHORT.
+  /// \param vertexCapacity Initial number of vertices the vertex buffer can hold.
+  /// \param indexCapacity Initial number of indices the index buffer can hold.
+  explicit GeometryArena(const VertexLayout& layout = VertexLayout(), GLenum indexType = GL_UNSIGNED_INT,
+                         std::size_t vertexCapacity = 65536, std::size_t indexCapacity = 196608);
+  GeometryArena(const GeometryArena&) = delete;
+  GeometryArena(GeometryArena&&) = delete;
+
+  const VertexArray& getVao() const { return m_vao; }
+  const VertexBuffer& getVbo() const { return m_vbo; }
+  const VertexLayout& getLayout() const { return m_layout; }
+  GLenum getIndexType() const { return m_indexType; }
+  std::size_t getIndexSize() const { return (m_indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t)); }
+  /// Gets the maximum number of vertices a single geometry can have, which depends on the index type.
+  /// \return Maximum vertex count of a geometry.
+  std::size_t getMaxGeometryVertexCount() const;
+  const RangeAllocator& getVertexAllocator() const { return m_vertexAllocator; }
+  const RangeAllocator& getIndexAllocator() const { return m_indexAllocator; }
+  std::size_t getGeometryCount() const { return m_ranges.size() - m_freeHandles.size(); }
+  /// Gets the current range of a geometry, which may change whenever another one is added.
+  /// \param handle Handle of the geometry, as returned by add().
+  /// \return Range of the geometry.
+  const GeometryRange& getRange(std::size_t handle) const { return m_ranges[handle]; }
+
+  /// Uploads a geometry into the buffers.
+  /// \param vertices Vertices of the geometry; must not be empty, nor exceed the maximum vertex count.
+  /// \param indices Indices of the geometry, relative to its first vertex; must not be empty.
+  /// \return Handle of the geometry.
+  std::size_t add(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices);
+  /// Releases a geometry's ranges, making them available again. The handle becomes invalid & may be reused.
+  /// \param handle Handle of the geometry to be removed.
+  void remove(std::size_t handle);
+  /// Packs all the geometries at the beginning of the buffers, removing the gaps left by the removed ones.
+  void defragment();
+  void bind() const { m_vao.bind(); }
+  void unbind() const { m_vao.unbind(); }
+
+  GeometryArena& operator=(const GeometryArena&) = delete;
+  GeometryArena& operator=(GeometryArena&&) = delete;
+
+private:
+  /// Allocates a range in a buffer, defragmenting or growing it beforehand if needed.
+  /// \param allocator Allocator of the buffer.
+  /// \param bufferIndex Index of the buffer.
+  /// \param elementSize Size in bytes of the buffer's elements.
+  /// \param count Number of elements to be allocated.
+  /// \param isVertexBuffer True if the buffer holds the vertices, false if it holds the indices.
+  /// \return Offset in number of elements of the allocated range.
+  std::size_t allocate(RangeAllocator& allocator, GLuint bufferIndex, std::size_t elementSize, std::size_t count, bool isVertexBuffer);
+  /// Defragments a buffer, moving its data & updating the geometries' ranges accordingly.
+  /// \param allocator Allocator of the buffer.
+  /// \param bufferIndex Index of the buffer.
+  /// \param elementSize Size in bytes of the buffer's elements.
+  /// \param isVertexBuffer True if the buffer holds the vertices, false if it holds the indices.
+  void defragment(RangeAllocator& allocator, GLuint bufferIndex, std::size_t elementSize, bool isVertexBuffer);
+
+  VertexArray m_vao {};
+  VertexBuffer m_vbo {};
+  VertexLayout m_layout {};
+  GLenum m_indexType {};
+  RangeAllocator m_vertexAllocator {};
+  RangeAllocator m_indexAllocator {};
+  std::vector<GeometryRange> m_ranges {};
+  std::vector<std::size_t> m_freeHandles {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_GEOMETRYARENA_HPP
@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef RAZ_GPUPROFILER_HPP
+#define RAZ_GPUPROFILER_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace Raz {
+
+/// Time spent by the GPU executing the commands of a scope.
+struct GpuScopeTiming {
+  std::string name {};
+  std::size_t depth {}; ///< Number of scopes the scope is nested in.
+  double duration {};   ///< Duration in milliseconds, including the nested scopes' ones.
+};
+
+/// Profiler measuring the time the GPU spends on each frame & on scopes of commands, with timestamp queries.
+/// Timestamps being used rather than GL_TIME_ELAPSED queries, which cannot be nested, scopes can be nested freely.
+/// Queries are recorded into a pool of FrameLatency frames, a frame's results being read only when its queries are about to be reused.
+/// Reading them never stalls the pipeline: if the GPU is still that many frames behind, the frame's results are skipped instead.
+class GpuProfiler {
+public:
+  static constexpr std::size_t FrameLatency = 4;
+
+  GpuProfiler() = default;
+  GpuProfiler(const GpuProfiler&) = delete;
+  GpuProfiler(GpuProfiler&&) = delete;
+
+  /// Gets the time the GPU spent on the last frame whose results have been read, in milliseconds.
+  double getFrameTime() const { return m_frameTime; }
+  /// Gets the scopes' timings of the last frame whose results have been read, in the order they have been begun.
+  const std::vector<GpuScopeTiming>& getScopeTimings() const { return m_scopeTimings; }
+  /// Gets the number of frames whose results were not available yet when their queries had to be reused.
+  std::size_t getSkippedFrameCount() const { return m_skippedFrameCount; }
+
+  /// Computes the total duration of the scopes having a given name, in the last frame whose results have been read.
+  /// \param name Name of the scopes.
+  /// \return Duration in milliseconds, or 0 if no scope has this name.
+  double computeScopeTime(const std::string& name) const;
+  /// Begins a frame, reading the results of the frame recorded FrameLatency frames ago if they are available.
+  void beginFrame();
+  /// Ends the current frame, closing its scopes still opened.
+  void endFrame();
+  /// Begins a scope, which must be ended in the same frame.
+  /// \param name Name of the scope.
+  void beginScope(std::string name);
+  /// Ends the last scope begun, if it has not been closed by the end of the frame already.
+  void endScope();
+
+  GpuProfiler& operator=(const GpuProfiler&) = delete;
+  GpuProfiler& operator=(GpuProfiler&&) = delete;
+
+  ~GpuProfiler();
+
+private:
+  struct ScopeQueries {
+    std::string name {};
+    std::size_t depth {};
+    std::size_t beginQueryIndex {};
+    std::size_t endQueryIndex {};
+  };
+
+  struct FrameQueries {
+    std::vector<GLuint> queries {};
+    std::size_t usedQueryCount {};
+    std::size_t endQueryIndex {};
+    std::vector<ScopeQueries> scopes {};
+    bool isPending {};
+  };
+
+  /// Records the current GPU time into the next query of the current frame, creating one if needed.
+  /// \return Index of the query in the frame.
+  std::size_t recordTimestamp();
+  /// Reads the results of a frame's queries, which must all be available.
+  /// \param frame Frame to read the results of.
+  void readResults(const FrameQueries& frame);
+
+  std::array<FrameQueries, FrameLatency> m_frames {};
+  std::size_t m_currentFrameIndex {};
+  std::vector<std::size_t> m_openedScopes {};
+  double m_frameTime {};
+  std::vector<GpuScopeTiming> m_scopeTimings {};
+  std::size_t m_skippedFrameCount {};
+};
+
+/// Scope timed by a GPU profiler from its construction to its destruction. Nothing is timed if no profiler is given.
+class GpuProfilerScope {
+public:
+  GpuProfilerScope(GpuProfiler* profiler, std::string name) : m_profiler{ profiler } {
+    if (m_profiler)
+      m_profiler->beginScope(std::move(name));
+  }
+  GpuProfilerScope(const GpuProfilerScope&) = delete;
+  GpuProfilerScope(GpuProfilerScope&&) = delete;
+
+  GpuProfilerScope& operator=(const GpuProfilerScope&) = delete;
+  GpuProfilerScope& operator=(GpuProfilerScope&&) = delete;
+
+  ~GpuProfilerScope() {
+    if (m_profiler)
+      m_profiler->endScope();
+  }
+
+private:
+  GpuProfiler* m_profiler {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_GPUPROFILER_HPP
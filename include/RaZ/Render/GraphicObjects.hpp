@@ -7,6 +7,8 @@
 
 #include "GL/glew.h"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/StateCache.hpp"
+#include "RaZ/Render/VertexLayout.hpp"
 
 namespace Raz {
 
@@ -31,10 +33,10 @@ public:
   const std::vector<unsigned int>& getIndices() const { return m_indices; }
   std::vector<unsigned int>& getIndices() { return m_indices; }
 
-  void bind() const { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_index); }
-  void unbind() const { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); }
+  void bind() const { StateCache::get().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_index); }
+  void unbind() const { StateCache::get().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); }
 
-  ~ElementBuffer() { glDeleteBuffers(1, &m_index); }
+  ~ElementBuffer() { StateCache::get().deleteBuffer(m_index); }
 
 private:
   GLuint m_index {};
@@ -49,10 +51,13 @@ public:
   const std::vector<Vertex>& getVertices() const { return m_vertices; }
   std::vector<Vertex>& getVertices() { return m_vertices; }
 
-  void bind() const { glBindBuffer(GL_ARRAY_BUFFER, m_index); }
-  void unbind() const { glBindBuffer(GL_ARRAY_BUFFER, 0); }
+  void bind() const { StateCache::get().bindBuffer(GL_ARRAY_BUFFER, m_index); }
+  void unbind() const { StateCache::get().bindBuffer(GL_ARRAY_BUFFER, 0); }
+  /// Defines the vertex attributes of the currently bound vertex array as read from this buffer, binding it beforehand.
+  /// \param layout Layout of the vertices stored in the buffer.
+  void setupAttributes(const VertexLayout& layout = VertexLayout()) const;
 
-  ~VertexBuffer() { glDeleteBuffers(1, &m_index); }
+  ~VertexBuffer() { StateCache::get().deleteBuffer(m_index); }
 
 private:
   GLuint m_index {};
@@ -67,10 +72,11 @@ public:
   const ElementBuffer& getEbo() const { return m_ebo; }
   ElementBuffer& getEbo() { return m_ebo; }
 
-  void bind() const { glBindVertexArray(m_index); m_ebo.bind(); }
-  void unbind() const { glBindVertexArray(0); m_ebo.unbind(); }
+  /// Binds the vertex array, which also restores its element buffer's binding.
+  void bind() const { StateCache::get().bindVertexArray(m_index); }
+  void unbind() const { StateCache::get().bindVertexArray(0); }
 
-  ~VertexArray() { glDeleteVertexArrays(1, &m_index); }
+  ~VertexArray() { StateCache::get().deleteVertexArray(m_index); }
 
 private:
   GLuint m_index {};
@@ -3,6 +3,8 @@
 #ifndef RAZ_LIGHT_HPP
 #define RAZ_LIGHT_HPP
 
+#include <cmath>
+#include <limits>
 #include <memory>
 
 #include "RaZ/Math/Vector.hpp"
@@ -31,6 +33,16 @@ public:
   float getEnergy() const { return m_energy; }
   float getAngle() const { return m_angle; }
 
+  /// Computes the distance beyond which the light's attenuation, being its energy divided by the squared distance, falls under a threshold.
+  /// \param attenuationThreshold Attenuation under which the light is considered negligible.
+  /// \return Range of the light; infinite for directional lights, which are not attenuated.
+  float computeRange(float attenuationThreshold) const {
+    if (m_type == LightType::DIRECTIONAL)
+      return std::numeric_limits<float>::infinity();
+
+    return std::sqrt(m_energy / attenuationThreshold);
+  }
+
   void setType(LightType type) { m_type = type; }
   void setDirection(const Vec3f& direction) { m_direction = direction; }
   void setEnergy(float energy) { m_energy = energy; }
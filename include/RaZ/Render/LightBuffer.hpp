@@ -0,0 +1,92 @@
+#pragma once
+
+#ifndef RAZ_LIGHTBUFFER_HPP
+#define RAZ_LIGHTBUFFER_HPP
+
+#include <limits>
+#include <vector>
+
+#include "GL/glew.h"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/Light.hpp"
+#include "RaZ/Render/LightClusterGrid.hpp"
+#include "RaZ/Render/ShaderProgram.hpp"
+
+namespace Raz {
+
+/// GPU storage of the lights & of their assignment to clusters, read by the shaders through buffer textures.
+/// Each light takes 3 RGBA texels: its position (W being 0 for directional lights), its direction & energy, then its color & angle.
+/// Lights are only uploaded if their data has changed since their last upload.
+class LightBuffer {
+public:
+  static constexpr uint8_t LightDataUnit     = 13;
+  static constexpr uint8_t ClusterRangesUnit = 14;
+  static constexpr uint8_t LightIndicesUnit  = 15;
+
+  LightBuffer();
+  LightBuffer(const LightBuffer&) = delete;
+  LightBuffer(LightBuffer&&) = delete;
+
+  std::size_t getLightCount() const { return m_lightCount; }
+
+  /// Sets the number of lights; added lights must then be set.
+  /// \param lightCount New number of lights.
+  void setLightCount(std::size_t lightCount);
+  /// Sets the data of a light, marking it to be uploaded if it differs from the current one.
+  /// \param lightIndex Index of the light; must be lower than the light count.
+  /// \param light Light to be stored.
+  /// \param position Position of the light.
+  void setLight(std::size_t lightIndex, const Light& light, const Vec3f& position);
+  /// Uploads the lights which have changed since the last upload.
+  void uploadLights();
+  /// Uploads the clusters' ranges & light indices.
+  /// \param clusterGrid Grid whose lights have been assigned.
+  void uploadClusters(const LightClusterGrid& clusterGrid);
+  /// Assigns the buffer textures' units to the program's samplers. This is only needed once for each program.
+  /// \param program Program to initialize the samplers of.
+  void initProgram(const ShaderProgram& program) const;
+  /// Binds the buffer textures to their units.
+  void bind() const;
+
+  LightBuffer& operator=(const LightBuffer&) = delete;
+  LightBuffer& operator=(LightBuffer&&) = delete;
+
+  ~LightBuffer();
+
+private:
+  struct BufferTexture {
+    GLuint bufferIndex {};
+    GLuint textureIndex {};
+    std::size_t capacity {};
+  };
+
+  static constexpr std::size_t LightFloatCount = 12;
+
+  /// Creates a buffer & its texture.
+  /// \param bufferTexture Buffer texture to be created.
+  /// \param format Format of the texture's texels.
+  static void create(BufferTexture& bufferTexture, GLenum format);
+  /// Uploads a range of data to a buffer; if its capacity is insufficient, the buffer is reallocated & all the data is uploaded.
+  /// \param bufferTexture Buffer texture to upload the data to.
+  /// \param data All the data the buffer holds.
+  /// \param dataSize Size in bytes of all the data.
+  /// \param offset Offset in bytes of the range to be uploaded.
+  /// \param size Size in bytes of the range to be uploaded.
+  static void upload(BufferTexture& bufferTexture, const void* data, std::size_t dataSize, std::size_t offset, std::size_t size);
+  /// Destroys a buffer & its texture.
+  /// \param bufferTexture Buffer texture to be destroyed.
+  static void destroy(BufferTexture& bufferTexture);
+
+  std::vector<float> m_lightData {};
+  std::size_t m_lightCount {};
+  std::size_t m_firstChangedLight = std::numeric_limits<std::size_t>::max();
+  std::size_t m_changedLightEnd {};
+
+  BufferTexture m_lightDataBuffer {};
+  BufferTexture m_clusterRangesBuffer {};
+  BufferTexture m_lightIndicesBuffer {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_LIGHTBUFFER_HPP
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef RAZ_LIGHTCLUSTERGRID_HPP
+#define RAZ_LIGHTCLUSTERGRID_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Grid of clusters subdividing the camera's frustum, each listing the lights which may affect it, so that only those are shaded.
+/// Tiles evenly divide the screen, while depth slices are distributed exponentially between the near & far planes to keep clusters
+/// roughly as deep as they are wide. Lights with an infinite radius (like directional ones) are global, affecting every cluster.
+class LightClusterGrid {
+public:
+  /// Creates a cluster grid.
+  /// \param tileCountX Number of tiles along the screen's width.
+  /// \param tileCountY Number of tiles along the screen's height.
+  /// \param sliceCount Number of depth slices.
+  LightClusterGrid(unsigned int tileCountX = 16, unsigned int tileCountY = 9, unsigned int sliceCount = 24);
+
+  unsigned int getTileCountX() const { return m_tileCountX; }
+  unsigned int getTileCountY() const { return m_tileCountY; }
+  unsigned int getSliceCount() const { return m_sliceCount; }
+  std::size_t getClusterCount() const { return static_cast<std::size_t>(m_tileCountX) * m_tileCountY * m_sliceCount; }
+  float getNearPlane() const { return m_nearPlane; }
+  /// Gets the factor converting the logarithm of the ratio between a depth & the near plane into a slice index.
+  float getSliceScale() const { return m_sliceScale; }
+  std::size_t getGlobalLightCount() const { return m_globalLightCount; }
+  /// Gets the range of each cluster in the light indices, stored as pairs of offset & count.
+  /// A cluster at a given tile & slice is at index (slice * tileCountY + tileY) * tileCountX + tileX.
+  const std::vector<uint32_t>& getClusterRanges() const { return m_clusterRanges; }
+  /// Gets the light indices, starting with the global lights' ones, followed by each cluster's.
+  const std::vector<uint32_t>& getLightIndices() const { return m_lightIndices; }
+
+  /// Computes the index of a cluster.
+  /// \param tileX Index of the tile along the screen's width.
+  /// \param tileY Index of the tile along the screen's height.
+  /// \param sliceIndex Index of the depth slice.
+  /// \return Index of the cluster.
+  std::size_t computeClusterIndex(unsigned int tileX, unsigned int tileY, unsigned int sliceIndex) const {
+    return (static_cast<std::size_t>(sliceIndex) * m_tileCountY + tileY) * m_tileCountX + tileX;
+  }
+  /// Computes the depth slice containing a given view depth; depths outside of the planes are clamped to the first & last slices.
+  /// The slices must have been built beforehand.
+  /// \param depth View depth to find the slice of.
+  /// \return Index of the slice.
+  unsigned int computeSliceIndex(float depth) const;
+  /// Assigns the lights to the clusters their volume overlaps, replacing the previous assignment.
+  /// \param viewProjMat View-projection matrix of the camera, whose W coordinate after projection is the view depth.
+  /// \param nearPlane Distance to the camera's near plane.
+  /// \param farPlane Distance to the camera's far plane.
+  /// \param lightVolumes Spheres of influence of the lights, whose indices in this list are the ones stored; an infinite radius makes a light global.
+  void build(const Mat4f& viewProjMat, float nearPlane, float farPlane, const std::vector<Sphere>& lightVolumes);
+
+private:
+  unsigned int m_tileCountX {};
+  unsigned int m_tileCountY {};
+  unsigned int m_sliceCount {};
+  float m_nearPlane {};
+  float m_sliceScale {};
+  std::size_t m_globalLightCount {};
+  std::vector<uint32_t> m_clusterRanges {};
+  std::vector<uint32_t> m_lightIndices {};
+  std::vector<std::pair<uint32_t, uint32_t>> m_assignments {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_LIGHTCLUSTERGRID_HPP
@@ -0,0 +1,49 @@
+#pragma once
+
+#ifndef RAZ_LODSELECTOR_HPP
+#define RAZ_LODSELECTOR_HPP
+
+#include <vector>
+
+namespace Raz {
+
+/// Selection of a level of detail from the size an object takes on screen.
+/// The screen size is the ratio between the projected radius of the object's bounding sphere & half the viewport's height; 1 thus
+/// roughly means that the object fills the screen's height. Each threshold is the screen size under which the next level is used.
+/// To prevent objects around a threshold from switching level every frame, a level is only left once the screen size has crossed
+/// the threshold by a given ratio (hysteresis).
+class LodSelector {
+public:
+  /// Creates a level of detail selector.
+  /// \param screenSizeThresholds Screen sizes under which each level is replaced by the next one; must be decreasing.
+  /// \param hysteresis Ratio by which the screen size must cross a threshold to change level.
+  explicit LodSelector(std::vector<float> screenSizeThresholds = { 0.5f, 0.25f, 0.125f, 0.0625f }, float hysteresis = 0.1f)
+    : m_screenSizeThresholds{ std::move(screenSizeThresholds) }, m_hysteresis{ hysteresis } {}
+
+  const std::vector<float>& getScreenSizeThresholds() const { return m_screenSizeThresholds; }
+  float getHysteresis() const { return m_hysteresis; }
+
+  void setScreenSizeThresholds(std::vector<float> screenSizeThresholds) { m_screenSizeThresholds = std::move(screenSizeThresholds); }
+  void setHysteresis(float hysteresis) { m_hysteresis = hysteresis; }
+
+  /// Computes the screen size of a sphere seen through a perspective projection.
+  /// \param radius Radius of the sphere.
+  /// \param distance Distance from the camera to the sphere's center.
+  /// \param fieldOfView Vertical field of view of the camera, in radians.
+  /// \return Screen size of the sphere; it is infinite if the camera is inside the sphere.
+  static float computeScreenSize(float radius, float distance, float fieldOfView);
+  /// Selects the level of detail to be used, starting from the current one.
+  /// \param screenSize Screen size of the object.
+  /// \param currentLod Level of detail used so far.
+  /// \param lodCount Number of levels of detail available, including the full-detail one.
+  /// \return Index of the level of detail to be used.
+  std::size_t select(float screenSize, std::size_t currentLod, std::size_t lodCount) const;
+
+private:
+  std::vector<float> m_screenSizeThresholds {};
+  float m_hysteresis {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_LODSELECTOR_HPP
@@ -9,6 +9,7 @@
 #include "RaZ/Render/Shader.hpp"
 #include "RaZ/Render/ShaderProgram.hpp"
 #include "RaZ/Render/Texture.hpp"
+#include "RaZ/Render/UniformBuffer.hpp"
 
 namespace Raz {
 
@@ -33,21 +34,56 @@ enum class MaterialPreset : uint16_t {
   PRESET_COUNT
 };
 
+/// Base class of materials, whose parameters are stored in a std140 uniform block named "uboMaterialParams".
+/// The block is only uploaded when the parameters have changed, & is bound at a fixed binding point when the material is used.
 class Material {
 public:
-  Material(const Material&) = default;
+  /// Binding point of the materials' parameter blocks.
+  static constexpr unsigned int ParametersBindingIndex = 2;
+
+  /// Copies a material; the copy gets its own parameter block.
+  Material(const Material&) : Material() {}
 
   virtual MaterialType getType() const = 0;
+  /// Gets the texture defining the material's main color, allowing to group the materials sharing it.
+  /// \return Diffuse or albedo map, depending on the material's type.
+  virtual const TexturePtr& getBaseTexture() const = 0;
 
   static MaterialCookTorrancePtr recoverMaterial(MaterialPreset preset, float roughnessFactor);
   virtual MaterialPtr clone() const = 0;
+  /// Assigns the texture units to the program's samplers & the binding point to its parameter block.
+  /// This is only needed once for each program.
+  /// \param program Program to initialize the material's uniforms of.
   virtual void initTextures(const ShaderProgram& program) const = 0;
-  virtual void bindAttributes(const ShaderProgram& program) const = 0;
+  /// Binds the material's parameter block & textures.
+  /// \param program Program to be drawn with the material.
+  /// \param textureBindings Textures already bound, allowing to skip binding them again; if null, all textures are bound.
+  virtual void bindAttributes(const ShaderProgram& program, TextureBindings* textureBindings) const = 0;
+  void bindAttributes(const ShaderProgram& program) const { bindAttributes(program, nullptr); }
 
   virtual ~Material() = default;
 
 protected:
   Material() = default;
+
+  /// Assigns the parameters' binding point to the program's material block, if it has one.
+  /// \param program Program to assign the binding point for.
+  static void initParametersBlock(const ShaderProgram& program);
+  /// Binds a texture to a unit, through the given bindings if any.
+  /// \param texture Texture to be bound.
+  /// \param unit Unit to bind the texture to.
+  /// \param textureBindings Textures already bound; may be null.
+  static void bindTexture(const Texture& texture, uint8_t unit, TextureBindings* textureBindings);
+  /// Marks the parameters as changed, to be uploaded on the next binding.
+  void invalidateParameters() { m_areParametersUpToDate = false; }
+  /// Binds the material's parameter block, uploading the given parameters beforehand if they have changed.
+  /// \param parameters Parameters laid out following the std140 rules.
+  /// \param size Size in bytes of the parameters.
+  void bindParameters(const void* parameters, std::size_t size) const;
+
+private:
+  mutable std::unique_ptr<UniformBuffer> m_parametersUbo {};
+  mutable bool m_areParametersUpToDate = false;
 };
 
 class MaterialStandard : public Material {
@@ -57,6 +93,7 @@ public:
   explicit MaterialStandard(const std::string& fileName) { m_diffuseMap = Texture::create(fileName); }
 
   MaterialType getType() const override { return MaterialType::STANDARD; }
+  const TexturePtr& getBaseTexture() const override { return m_diffuseMap; }
   const Vec3f& getAmbient() const { return m_ambient; }
   const Vec3f& getDiffuse() const { return m_diffuse; }
   const Vec3f& getSpecular() const { return m_specular; }
@@ -71,14 +108,14 @@ public:
   const TexturePtr& getBumpMap() const { return m_bumpMap; }
 
   void setDiffuse(float red, float green, float blue) { setDiffuse(Vec3f({ red, green, blue })); }
-  void setDiffuse(const Vec3f& val) { m_diffuse = val; }
+  void setDiffuse(const Vec3f& val) { m_diffuse = val; invalidateParameters(); }
   void setAmbient(float red, float green, float blue) { setAmbient(Vec3f({ red, green, blue })); }
-  void setAmbient(const Vec3f& val) { m_ambient = val; }
+  void setAmbient(const Vec3f& val) { m_ambient = val; invalidateParameters(); }
   void setSpecular(float red, float green, float blue) { setSpecular(Vec3f({ red, green, blue })); }
-  void setSpecular(const Vec3f& val) { m_specular = val; }
+  void setSpecular(const Vec3f& val) { m_specular = val; invalidateParameters(); }
   void setEmissive(float red, float green, float blue) { setEmissive(Vec3f({ red, green, blue })); }
-  void setEmissive(const Vec3f& val) { m_emissive = val; }
-  void setTransparency(float transparency) { m_transparency = transparency; }
+  void setEmissive(const Vec3f& val) { m_emissive = val; invalidateParameters(); }
+  void setTransparency(float transparency) { m_transparency = transparency; invalidateParameters(); }
 
   void setAmbientMap(const TexturePtr& ambientMap) { m_ambientMap = ambientMap; }
   void setDiffuseMap(const TexturePtr& diffuseMap) { m_diffuseMap = diffuseMap; }
@@ -99,7 +136,8 @@ public:
 
   MaterialPtr clone() const override { return MaterialStandard::create(*this); }
   void initTextures(const ShaderProgram& program) const override;
-  void bindAttributes(const ShaderProgram& program) const override;
+  using Material::bindAttributes;
+  void bindAttributes(const ShaderProgram& program, TextureBindings* textureBindings) const override;
 
 private:
   Vec3f m_ambient      = Vec3f(1.f);
@@ -125,6 +163,7 @@ public:
     : m_baseColor{ baseColor }, m_metallicFactor{ metallicFactor }, m_roughnessFactor{ roughnessFactor } {}
 
   MaterialType getType() const override { return MaterialType::COOK_TORRANCE; }
+  const TexturePtr& getBaseTexture() const override { return m_albedoMap; }
   const Vec3f& getBaseColor() const { return m_baseColor; }
   float getMetallicFactor() const { return m_metallicFactor; }
   float getRoughnessFactor() const { return m_roughnessFactor; }
@@ -136,9 +175,9 @@ public:
   const TexturePtr& getAmbientOcclusionMap() const { return m_ambientOcclusionMap; }
 
   void setBaseColor(float red, float green, float blue) { setBaseColor(Vec3f({ red, green, blue })); }
-  void setBaseColor(const Vec3f& color) { m_baseColor = color; }
-  void setMetallicFactor(float metallicFactor) { m_metallicFactor = metallicFactor; }
-  void setRoughnessFactor(float roughnessFactor) { m_roughnessFactor = roughnessFactor; }
+  void setBaseColor(const Vec3f& color) { m_baseColor = color; invalidateParameters(); }
+  void setMetallicFactor(float metallicFactor) { m_metallicFactor = metallicFactor; invalidateParameters(); }
+  void setRoughnessFactor(float roughnessFactor) { m_roughnessFactor = roughnessFactor; invalidateParameters(); }
 
   void setAlbedoMap(const TexturePtr& albedoMap) { m_albedoMap = albedoMap; }
   void setNormalMap(const TexturePtr& normalMap) { m_normalMap = normalMap; }
@@ -157,7 +196,8 @@ public:
 
   MaterialPtr clone() const override { return MaterialCookTorrance::create(*this); }
   void initTextures(const ShaderProgram& program) const override;
-  void bindAttributes(const ShaderProgram& program) const override;
+  using Material::bindAttributes;
+  void bindAttributes(const ShaderProgram& program, TextureBindings* textureBindings) const override;
 
 private:
   Vec3f m_baseColor       = Vec3f(1.f);
@@ -20,7 +20,9 @@ using MeshPtr = std::unique_ptr<Mesh>;
 class Mesh : public Component {
 public:
   Mesh() { m_submeshes.emplace_back(Submesh::create()); }
-  explicit Mesh(const std::string& filePath) : Mesh() { import(filePath); }
+  explicit Mesh(const std::string& filePath, bool optimizeGeometry = false, std::size_t lodCount = 0) : Mesh() {
+    import(filePath, optimizeGeometry, lodCount);
+  }
   explicit Mesh(const Triangle& triangle);
   explicit Mesh(const Quad& quad);
   explicit Mesh(const AABB& box);
@@ -29,6 +31,8 @@ public:
   std::vector<SubmeshPtr>& getSubmeshes() { return m_submeshes; }
   const std::vector<MaterialPtr>& getMaterials() const { return m_materials; }
   std::vector<MaterialPtr>& getMaterials() { return m_materials; }
+  const AABB& getBoundingBox() const { return m_boundingBox; }
+  const Sphere& getBoundingSphere() const { return m_boundingSphere; }
   std::size_t recoverVertexCount() const;
   std::size_t recoverTriangleCount() const;
 
@@ -36,14 +40,55 @@ public:
   static void drawUnitQuad();
   static void drawUnitCube();
 
-  void import(const std::string& filePath);
+  /// Imports a mesh from a file, replacing the current submeshes & materials.
+  /// \param filePath Path to the file to be imported.
+  /// \param optimizeGeometry True to optimize the submeshes once imported, false to keep their triangles & vertices in the file's order.
+  /// \param lodCount Number of levels of detail to be generated for each submesh once imported; see Submesh::generateLods().
+  void import(const std::string& filePath, bool optimizeGeometry = false, std::size_t lodCount = 0);
   void setMaterial(MaterialPreset materialPreset, float roughnessFactor);
   void addSubmesh(SubmeshPtr submesh) { m_submeshes.emplace_back(std::move(submesh)); }
   void addMaterial(MaterialPtr material) { m_materials.emplace_back(std::move(material)); }
-  void load() const;
-  void load(const ShaderProgram& program) const;
+  /// Computes & stores the local-space bounds of all the submeshes, and the mesh's ones enclosing them.
+  /// They are computed on import & on creation from a shape; they must be recomputed if any submesh is modified.
+  void computeBounds();
+  /// Computes the bounding volume hierarchies of all the submeshes, speeding up the ray intersection checks.
+  void computeBvh();
+  /// Reorders the triangles & vertices of all the submeshes to make better use of the GPU's caches; see Submesh::optimize().
+  /// \param overdrawThreshold Maximum ratio by which the overdraw optimization may degrade the vertex cache's efficiency.
+  void optimize(float overdrawThreshold = 1.05f);
+  /// Generates simplified versions of all the submeshes, each submesh being simplified on its own; see Submesh::generateLods().
+  /// \param lodCount Number of levels of detail to be generated, excluding the full-detail one.
+  /// \param reductionRatio Ratio of triangles each level of detail should keep from the previous one.
+  /// \param maxError Maximum error of a level of detail, relative to the extent of its submesh.
+  void generateLods(std::size_t lodCount, float reductionRatio = 0.5f, float maxError = 0.05f);
+  /// Ray-mesh intersection check, finding the closest triangle hit among all submeshes.
+  /// \param ray Ray to check if there is an intersection with.
+  /// \param hit Optional hit information, filled with the closest hit & its submesh & triangle indices if an intersection is found.
+  /// \param maxDistance Distance beyond which hits are ignored.
+  /// \return True if the ray intersects the mesh, false otherwise.
+  bool intersects(const Ray& ray, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Loads all the submeshes into their own buffers.
+  /// \param layout Layout of the vertices in the buffers.
+  void load(const VertexLayout& layout = VertexLayout()) const;
+  /// Loads all the submeshes into their own buffers & initializes the materials' textures.
+  /// \param program Shader program to initialize the materials' textures for.
+  /// \param layout Layout of the vertices in the buffers.
+  void load(const ShaderProgram& program, const VertexLayout& layout = VertexLayout()) const;
+  /// Loads all the submeshes into a shared arena, letting them be drawn without changing the vertex array.
+  /// \param arena Arena to load the submeshes into.
+  void load(GeometryArena& arena) const;
+  /// Loads all the submeshes into a shared arena & initializes the materials' textures.
+  /// \param program Shader program to initialize the materials' textures for.
+  /// \param arena Arena to load the submeshes into.
+  void load(const ShaderProgram& program, GeometryArena& arena) const;
+  /// Removes all the submeshes from their arena, if any.
+  void unload() const;
   void draw() const;
   void draw(const ShaderProgram& program) const;
+  /// Draws a single submesh, binding its material's attributes & sending its position dequantization beforehand.
+  /// \param submeshIndex Index of the submesh to be drawn.
+  /// \param program Shader program to bind the material's attributes to.
+  void drawSubmesh(std::size_t submeshIndex, const ShaderProgram& program) const;
   void save(const std::string& filePath) const;
 
 private:
@@ -57,6 +102,8 @@ private:
 
   std::vector<SubmeshPtr> m_submeshes {};
   std::vector<MaterialPtr> m_materials {};
+  AABB m_boundingBox = AABB(Vec3f(0.f), Vec3f(0.f));
+  Sphere m_boundingSphere = Sphere(Vec3f(0.f), 0.f);
 };
 
 } // namespace Raz
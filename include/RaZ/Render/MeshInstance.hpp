@@ -0,0 +1,34 @@
+#pragma once
+
+#ifndef RAZ_MESHINSTANCE_HPP
+#define RAZ_MESHINSTANCE_HPP
+
+#include <memory>
+#include <stdexcept>
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Render/Mesh.hpp"
+
+namespace Raz {
+
+using SharedMeshPtr = std::shared_ptr<Mesh>;
+
+/// Component referencing a mesh shared between several entities, each drawn at its own transformation.
+/// The visible instances of a same mesh are drawn together with a single instanced draw call per submesh.
+class MeshInstance : public Component {
+public:
+  explicit MeshInstance(SharedMeshPtr mesh) : m_mesh{ std::move(mesh) } {
+    if (m_mesh == nullptr)
+      throw std::runtime_error("Error: A mesh instance must reference a mesh.");
+  }
+
+  const Mesh& getMesh() const { return *m_mesh; }
+  const SharedMeshPtr& getSharedMesh() const { return m_mesh; }
+
+private:
+  SharedMeshPtr m_mesh {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_MESHINSTANCE_HPP
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifndef RAZ_MESHOPTIMIZER_HPP
+#define RAZ_MESHOPTIMIZER_HPP
+
+#include <vector>
+
+#include "RaZ/Render/GraphicObjects.hpp"
+
+namespace Raz {
+
+/// Reordering of a geometry's triangles & vertices to make better use of the GPU's caches; the geometry itself is left unchanged.
+/// The functions are meant to be applied in order: vertex cache optimization, overdraw optimization, then vertex fetch optimization.
+namespace MeshOptimizer {
+
+/// Number of entries of the post-transform vertex cache assumed by default, which is representative of most GPUs.
+constexpr std::size_t DefaultCacheSize = 16;
+
+/// Computes the average number of vertices transformed per triangle (ACMR), as simulated with a FIFO post-transform cache.
+/// It ranges from 0.5 for the best possible orders on large meshes to 3 if no vertex is ever reused.
+/// \param indices Indices of the triangles.
+/// \param vertexCount Number of vertices the indices refer to.
+/// \param cacheSize Number of entries of the simulated cache.
+/// \return Average number of cache misses per triangle; 0 if there is no triangle.
+float computeAcmr(const std::vector<unsigned int>& indices, std::size_t vertexCount, std::size_t cacheSize = DefaultCacheSize);
+/// Reorders the triangles so that consecutive ones share as many vertices as possible, following Sander et al.'s Tipsify algorithm.
+/// Triangles are emitted by fanning around vertices, the next one being chosen among those which are still in the cache.
+/// \param indices Indices of the triangles to be reordered.
+/// \param vertexCount Number of vertices the indices refer to.
+/// \param cacheSize Number of entries of the cache to optimize for.
+void optimizeVertexCache(std::vector<unsigned int>& indices, std::size_t vertexCount, std::size_t cacheSize = DefaultCacheSize);
+/// Reorders clusters of triangles so that those facing outward are drawn first, occluding the others & thus reducing overdraw.
+/// Clusters are split where the cache would be flushed, then where doing so would not raise the ACMR beyond the given threshold.
+/// The triangles must have been optimized for the vertex cache beforehand.
+/// \param indices Indices of the triangles to be reordered.
+/// \param vertices Vertices the indices refer to.
+/// \param threshold Maximum ratio by which the ACMR may be raised; the higher, the smaller the clusters & the less overdraw.
+/// \param cacheSize Number of entries of the cache the triangles have been optimized for.
+void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices,
+                      float threshold = 1.05f, std::size_t cacheSize = DefaultCacheSize);
+/// Reorders the vertices in the order they are first referenced by the triangles, so that they are fetched as linearly as possible.
+/// Vertices which are not referenced by any triangle are removed.
+/// \param vertices Vertices to be reordered.
+/// \param indices Indices of the triangles, which are remapped to the new vertices' order.
+void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+} // namespace MeshOptimizer
+
+} // namespace Raz
+
+#endif // RAZ_MESHOPTIMIZER_HPP
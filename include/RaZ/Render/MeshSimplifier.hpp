@@ -0,0 +1,34 @@
+#pragma once
+
+#ifndef RAZ_MESHSIMPLIFIER_HPP
+#define RAZ_MESHSIMPLIFIER_HPP
+
+#include <vector>
+
+#include "RaZ/Render/GraphicObjects.hpp"
+
+namespace Raz {
+
+/// Reduction of a geometry's triangle count, following Garland & Heckbert's quadric error metric.
+/// Vertices are collapsed onto one of their neighbours, the error of a collapse being the area-weighted average squared distance
+/// from the new position to the planes of the triangles merged into the remaining vertex. As no vertex is created, the simplified
+/// triangles index the original vertices, which can thus be shared by all the levels of detail.
+/// Vertices on a border (edges having a single triangle) & on a seam (several vertices at the same position, differing by their
+/// texcoords or normal) are never moved, preserving the geometry's outline & attribute discontinuities.
+namespace MeshSimplifier {
+
+/// Simplifies a geometry, collapsing the vertices with the lowest error first until the target is reached.
+/// \param vertices Vertices of the geometry.
+/// \param indices Indices of the triangles to be simplified.
+/// \param targetIndexCount Number of indices to reduce the triangles to; it may not be reached if the error gets too high.
+/// \param maxError Maximum error of a collapse, relative to the largest extent of the geometry's bounding box.
+/// \param resultError Optional error of the simplified geometry, relative to the largest extent of the geometry's bounding box.
+/// \return Indices of the simplified triangles.
+std::vector<unsigned int> simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                                   std::size_t targetIndexCount, float maxError = 0.01f, float* resultError = nullptr);
+
+} // namespace MeshSimplifier
+
+} // namespace Raz
+
+#endif // RAZ_MESHSIMPLIFIER_HPP
@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef RAZ_OCCLUSIONBUFFER_HPP
+#define RAZ_OCCLUSIONBUFFER_HPP
+
+#include <vector>
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+class Mesh;
+
+/// Component marking an entity's mesh as an occluder, which is rasterized into the occlusion buffer to hide the entities behind it.
+/// Occluders should be large & closed meshes with few triangles, like walls or terrain.
+class Occluder : public Component {
+public:
+  Occluder() = default;
+};
+
+/// Low-resolution depth buffer rasterized on the CPU from occluders, allowing to find which boxes are entirely hidden behind them.
+/// Depths are stored as the inverse of the view depth (1 / w), which varies linearly in screen space; greater values are thus closer.
+/// Once the occluders are rasterized, a hierarchy keeping the farthest depth of each 2x2 block is built, to check boxes with few reads.
+class OcclusionBuffer {
+public:
+  /// Creates an empty occlusion buffer.
+  /// \param width Width of the buffer; must be a multiple of 4, as rows are rasterized by packs of 4 pixels.
+  /// \param height Height of the buffer.
+  OcclusionBuffer(unsigned int width = 256, unsigned int height = 128);
+
+  unsigned int getWidth() const { return m_width; }
+  unsigned int getHeight() const { return m_height; }
+  const Mat4f& getViewProjectionMatrix() const { return m_viewProjMat; }
+  std::size_t getLevelCount() const { return m_levels.size(); }
+  /// Gets the inverse depths of a level of the hierarchy, the first one being the full-resolution buffer.
+  /// \param levelIndex Index of the level to get the depths of.
+  /// \return Inverse depths of the level, stored by rows; 0 where no occluder has been rasterized.
+  const std::vector<float>& getLevel(std::size_t levelIndex) const { return m_levels[levelIndex].depths; }
+
+  /// Empties the buffer & sets the matrix the occluders & boxes will be projected with.
+  /// \param viewProjMat View-projection matrix of the camera.
+  void clear(const Mat4f& viewProjMat);
+  /// Rasterizes a triangle, given in world space, into the buffer.
+  /// Triangles having a vertex behind the camera are skipped, which is conservative: they just hide nothing.
+  /// \param firstPos First vertex of the triangle.
+  /// \param secondPos Second vertex of the triangle.
+  /// \param thirdPos Third vertex of the triangle.
+  void rasterizeTriangle(const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos);
+  /// Rasterizes all the triangles of a mesh into the buffer.
+  /// \param mesh Mesh to be rasterized.
+  /// \param modelMat Transformation matrix of the mesh.
+  void rasterizeMesh(const Mesh& mesh, const Mat4f& modelMat);
+  /// Builds the hierarchy of depths from the rasterized occluders; must be called before checking boxes.
+  void buildHierarchy();
+  /// Checks if a box is entirely hidden by the rasterized occluders.
+  /// Boxes crossing the camera's plane or outside of the screen are never considered occluded, the latter being left to frustum culling.
+  /// \param box Box to be checked, in world space.
+  /// \return True if the box is hidden, false if it may be visible.
+  bool isOccluded(const AABB& box) const;
+
+private:
+  struct Level {
+    unsigned int width {};
+    unsigned int height {};
+    std::vector<float> depths {};
+  };
+
+  void rasterizeClipTriangle(const Vec4f& firstPos, const Vec4f& secondPos, const Vec4f& thirdPos);
+
+  unsigned int m_width {};
+  unsigned int m_height {};
+  Mat4f m_viewProjMat = Mat4f::identity();
+  std::vector<Level> m_levels {};
+  std::vector<Vec4f> m_clipPositions {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_OCCLUSIONBUFFER_HPP
@@ -0,0 +1,67 @@
+#pragma once
+
+#ifndef RAZ_RAYTRACER_HPP
+#define RAZ_RAYTRACER_HPP
+
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Image.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
+
+namespace Raz {
+
+class Entity;
+class World;
+
+/// CPU renderer, casting rays from a camera into a world & shading what they hit with the entities' materials & the world's lights.
+/// The image is rendered by tiles spread across a thread pool; each render adds a jittered sample per pixel, progressively refining the result.
+/// Since textures live on the GPU, only the materials' constant factors are used.
+class RayTracer {
+public:
+  /// Creates a ray tracer rendering images of the given dimensions.
+  /// \param width Width of the rendered images.
+  /// \param height Height of the rendered images.
+  /// \param threadCount Number of threads to render with; if 0, as many threads as the system can run concurrently are used.
+  RayTracer(unsigned int width, unsigned int height, std::size_t threadCount = 0);
+
+  unsigned int getWidth() const { return m_width; }
+  unsigned int getHeight() const { return m_height; }
+  std::size_t getThreadCount() const { return m_threadPool.getThreadCount(); }
+  /// Gets the number of samples per pixel accumulated so far.
+  std::size_t getSampleCount() const { return m_sampleCount; }
+  /// Gets the number of rays (primary & shadow ones) cast by the last render.
+  std::size_t getRayCount() const { return m_rayCount; }
+  /// Gets the time taken by the last render, in seconds.
+  float getRenderTime() const { return m_renderTime; }
+
+  /// Computes the throughput of the last render.
+  /// \return Number of millions of rays cast per second.
+  float computeMegaRaysPerSecond() const { return (m_renderTime > 0.f ? static_cast<float>(m_rayCount) / (m_renderTime * 1000000.f) : 0.f); }
+  /// Renders one more sample per pixel, accumulated with the previous ones.
+  /// \param world World to be rendered; its entities' shapes & meshes are hit by the rays, and its lights illuminate them.
+  /// \param cameraEntity Entity to render the world from, which must have a Camera & a Transform component.
+  void render(World& world, const Entity& cameraEntity);
+  /// Discards all the accumulated samples; must be called when the world or the camera have changed.
+  void reset();
+  /// Recovers the image from the samples accumulated so far, tone-mapped & gamma-corrected like the engine's shaders.
+  /// Its first row is the top of the image, so that it can directly be saved.
+  /// \return RGB image of the render.
+  Image recoverImage() const;
+
+private:
+  static constexpr unsigned int TileSize = 16;
+
+  unsigned int m_width {};
+  unsigned int m_height {};
+  ThreadPool m_threadPool;
+
+  std::vector<Vec3f> m_accumulatedColors {};
+  std::size_t m_sampleCount = 0;
+  std::size_t m_rayCount = 0;
+  float m_renderTime = 0.f;
+};
+
+} // namespace Raz
+
+#endif // RAZ_RAYTRACER_HPP
@@ -0,0 +1,181 @@
+#pragma once
+
+#ifndef RAZ_RENDERQUEUE_HPP
+#define RAZ_RENDERQUEUE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GL/glew.h"
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Render/Material.hpp"
+#include "RaZ/Render/RingBuffer.hpp"
+#include "RaZ/Render/Texture.hpp"
+
+namespace Raz {
+
+class ShaderProgram;
+class Submesh;
+
+/// Draw of a single submesh, along with the states it requires.
+/// An instanced command draws the submesh once for each of its consecutive transformations, starting from the given index.
+struct RenderCommand {
+  uint64_t sortKey {};
+  const ShaderProgram* program {};
+  const Material* material {};
+  const Submesh* submesh {};
+  std::size_t transformIndex {};
+  std::size_t instanceCount {};
+  std::size_t lodIndex {};
+};
+
+/// Number of draw calls issued during the last submission, and how many times each state had to be changed for them.
+/// Commands merged into multi-draw calls are counted apart, each multi-draw counting as a single draw call.
+struct RenderQueueStats {
+  std::size_t drawCount {};
+  std::size_t multiDrawCommandCount {};
+  std::size_t instanceCount {};
+  std::size_t programChangeCount {};
+  std::size_t materialChangeCount {};
+  std::size_t textureChangeCount {};
+  std::size_t vertexArrayChangeCount {};
+  std::size_t transformChangeCount {};
+};
+
+/// Indirect draw command, laid out as read by glMultiDrawElementsIndirect().
+struct DrawElementsIndirectCommand {
+  GLuint indexCount {};
+  GLuint instanceCount {};
+  GLuint firstIndex {};
+  GLint baseVertex {};
+  GLuint baseInstance {};
+};
+
+/// List of draw commands, sorted by keys packing their states so that consecutive commands share as many of them as possible.
+/// From the most to the least significant bits, a key holds the shader program, the material, its base texture, the vertex array & the depth.
+/// The submission only changes the states differing from the previous command's ones. Commands without material are drawn with a default one,
+/// never keeping the previous command's material bound.
+/// Transformations are streamed at once to a ring buffer on each submission, and read by every draw through a per-instance vertex attribute.
+/// Consecutive commands sharing all their states & drawing submeshes from the same geometry arena are merged into a single multi-draw indirect call
+/// if supported (OpenGL 4.3 or ARB_multi_draw_indirect); otherwise, they are drawn one by one with a base vertex.
+class RenderQueue {
+public:
+  /// Location of the per-instance transformation matrix attribute, taking this location & the 3 following ones.
+  static constexpr GLuint InstanceMatrixLocation = 4;
+
+  static constexpr unsigned int ProgramBitCount     = 8;
+  static constexpr unsigned int MaterialBitCount    = 16;
+  static constexpr unsigned int TextureBitCount     = 12;
+  static constexpr unsigned int VertexArrayBitCount = 12;
+  static constexpr unsigned int DepthBitCount       = 16;
+
+  RenderQueue() = default;
+  RenderQueue(const RenderQueue&) = delete;
+  RenderQueue(RenderQueue&&) = delete;
+
+  std::size_t getCommandCount() const { return m_commands.size(); }
+  const std::vector<RenderCommand>& getCommands() const { return m_commands; }
+  std::size_t getTransformCount() const { return m_transforms.size(); }
+  const RenderQueueStats& getStats() const { return m_stats; }
+  /// Gets the material bound for the commands having none, creating a default Cook-Torrance one if none has been set.
+  /// \return Default material.
+  const Material& recoverDefaultMaterial();
+
+  /// Packs the given states into a sort key. Indices exceeding their bit count are wrapped, which only affects the grouping.
+  /// \param programIndex Index of the shader program.
+  /// \param materialIndex Index of the material.
+  /// \param textureIndex Index of the material's base texture.
+  /// \param vertexArrayIndex Index of the vertex array.
+  /// \param depth Distance to the camera; negative values are considered as 0. Closer commands are sorted first.
+  /// \return Sort key of the states.
+  static uint64_t computeSortKey(uint32_t programIndex, uint32_t materialIndex, uint32_t textureIndex, uint32_t vertexArrayIndex, float depth);
+  /// Computes the sort key of a command from its states, without modifying the queue; it can thus be called from several threads at once.
+  /// The material must have been registered beforehand, otherwise it is grouped with the commands having none.
+  /// \param program Shader program to draw with.
+  /// \param material Material to draw with; if null, the default material is used.
+  /// \param submesh Submesh to be drawn.
+  /// \param depth Distance of the command to the camera.
+  /// \return Sort key of the command.
+  uint64_t computeSortKey(const ShaderProgram& program, const Material* material, const Submesh& submesh, float depth) const;
+  /// Sets the material bound for the commands having none; it must match the type of the materials expected by the commands' programs.
+  /// \param material Default material.
+  void setDefaultMaterial(MaterialPtr material) { m_defaultMaterial = std::move(material); }
+  /// Gives an index to a material if it has none yet, so that sort keys can then be computed with it.
+  /// \param material Material to be registered; may be null, in which case nothing is done.
+  void registerMaterial(const Material* material) { recoverMaterialIndex(material); }
+  /// Adds a transformation matrix to be referenced by commands, allowing them to share it.
+  /// \param modelMat Transformation matrix to be added.
+  /// \return Index of the transformation.
+  std::size_t addTransform(const Mat4f& modelMat);
+  /// Adds a command with an already computed sort key.
+  /// \param sortKey Sort key of the command.
+  /// \param program Shader program to draw with.
+  /// \param material Material to draw with; if null, the default material is used.
+  /// \param submesh Submesh to be drawn.
+  /// \param transformIndex Index of the command's transformation, as returned by addTransform().
+  /// \param lodIndex Index of the submesh's level of detail to be drawn.
+  void addCommand(uint64_t sortKey, const ShaderProgram* program, const Material* material, const Submesh* submesh,
+                  std::size_t transformIndex, std::size_t lodIndex = 0);
+  /// Adds a command, computing its sort key from its states.
+  /// \param program Shader program to draw with.
+  /// \param material Material to draw with; if null, the default material is used.
+  /// \param submesh Submesh to be drawn.
+  /// \param transformIndex Index of the command's transformation, as returned by addTransform().
+  /// \param depth Distance of the command to the camera.
+  /// \param lodIndex Index of the submesh's level of detail to be drawn.
+  void addCommand(const ShaderProgram& program, const Material* material, const Submesh& submesh,
+                  std::size_t transformIndex, float depth, std::size_t lodIndex = 0);
+  /// Adds a command drawing several instances of a submesh at once.
+  /// \param program Shader program to draw with.
+  /// \param material Material to draw with; if null, the default material is used.
+  /// \param submesh Submesh to be drawn.
+  /// \param firstTransformIndex Index of the first instance's transformation; the others must directly follow it.
+  /// \param instanceCount Number of instances to be drawn.
+  /// \param depth Distance of the closest instance to the camera.
+  /// \param lodIndex Index of the submesh's level of detail to be drawn.
+  void addInstancedCommand(const ShaderProgram& program, const Material* material, const Submesh& submesh,
+                           std::size_t firstTransformIndex, std::size_t instanceCount, float depth, std::size_t lodIndex = 0);
+  /// Appends commands prepared apart, along with the transformations they reference.
+  /// \param commands Commands to be added, whose transformation indices are relative to the given transformations.
+  /// \param transforms Transformations referenced by the commands.
+  void addCommands(const std::vector<RenderCommand>& commands, const std::vector<Mat4f>& transforms);
+  /// Sorts the commands by increasing keys, keeping the insertion order of commands with equal keys.
+  /// A radix sort is used, skipping the key's bytes shared by all commands.
+  void sort();
+  /// Draws all commands in their current order, only changing the states which differ from the previous command's ones.
+  /// \param viewProjMat View-projection matrix, combined with the commands' transformations.
+  void submit(const Mat4f& viewProjMat);
+  /// Removes all commands & transformations. The materials' indices are kept, so that their order remains stable between frames.
+  void clear();
+
+  RenderQueue& operator=(const RenderQueue&) = delete;
+  RenderQueue& operator=(RenderQueue&&) = delete;
+
+  ~RenderQueue() = default;
+
+private:
+  /// Recovers the index of a material, giving a new one to those not encountered yet.
+  /// \param material Material to recover the index of; may be null, in which case the index is 0.
+  /// \return Index of the material.
+  uint32_t recoverMaterialIndex(const Material* material);
+  /// Writes the indirect draw commands of all the commands in their current order to the indirect buffer.
+  /// \return Offset in bytes from the buffer's beginning at which the commands have been written.
+  std::size_t writeIndirectCommands();
+
+  std::vector<RenderCommand> m_commands {};
+  std::vector<RenderCommand> m_sortBuffer {};
+  std::vector<Mat4f> m_transforms {};
+  std::unordered_map<const Material*, uint32_t> m_materialIndices {};
+  RenderQueueStats m_stats {};
+  std::unique_ptr<RingBuffer> m_transformBuffer {};
+  std::vector<DrawElementsIndirectCommand> m_indirectCommands {};
+  std::unique_ptr<RingBuffer> m_indirectBuffer {};
+  TextureBindings m_textureBindings {};
+  MaterialPtr m_defaultMaterial {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_RENDERQUEUE_HPP
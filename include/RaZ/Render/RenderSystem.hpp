@@ -3,19 +3,55 @@
 #ifndef RAZ_RENDERSYSTEM_HPP
 #define RAZ_RENDERSYSTEM_HPP
 
+#include <functional>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+
 #include "RaZ/Entity.hpp"
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
 #include "RaZ/Render/Cubemap.hpp"
+#include "RaZ/Render/DeferredRenderer.hpp"
+#include "RaZ/Render/GeometryArena.hpp"
+#include "RaZ/Render/GpuProfiler.hpp"
+#include "RaZ/Render/LightBuffer.hpp"
+#include "RaZ/Render/LightClusterGrid.hpp"
+#include "RaZ/Render/LodSelector.hpp"
+#include "RaZ/Render/OcclusionBuffer.hpp"
+#include "RaZ/Render/RenderQueue.hpp"
+#include "RaZ/Render/StateCache.hpp"
+#include "RaZ/Render/TextureStreamer.hpp"
 #include "RaZ/Render/UniformBuffer.hpp"
 #include "RaZ/System.hpp"
+#include "RaZ/Utils/Frustum.hpp"
+#include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
 #include "RaZ/Utils/Window.hpp"
 
 namespace Raz {
 
+/// Number of entities & submeshes tested against the camera's frustum during the last update, and how many of them were visible.
+/// Entities inside the frustum but hidden behind occluders are counted as occluded instead of visible.
+struct CullingStats {
+  std::size_t entityCount {};
+  std::size_t visibleEntityCount {};
+  std::size_t occludedEntityCount {};
+  std::size_t submeshCount {};
+  std::size_t visibleSubmeshCount {};
+};
+
 class RenderSystem : public System {
 public:
-  RenderSystem(unsigned int windowWidth, unsigned int windowHeight, const std::string& windowTitle = "");
+  /// Number of entities prepared by each task; the draws of scenes having up to this many mesh entities are prepared on the calling thread.
+  static constexpr std::size_t PrepareTaskItemCount = 256;
+
+  /// Creates the render system along with its window.
+  /// \param windowWidth Width of the window.
+  /// \param windowHeight Height of the window.
+  /// \param windowTitle Title of the window.
+  /// \param isHeadless True to render offscreen into a hidden window, whose frames can be read back with Window::captureFrame().
+  RenderSystem(unsigned int windowWidth, unsigned int windowHeight, const std::string& windowTitle = "", bool isHeadless = false);
 
   const Window& getWindow() const { return m_window; }
   Window& getWindow() { return m_window; }
@@ -23,11 +59,65 @@ public:
   Entity& getCameraEntity() { return m_camera; }
   const ShaderProgram& getProgram() const { return m_program; }
   const CubemapPtr& getCubemap() const { return m_cubemap; }
+  bool isFrustumCullingEnabled() const { return m_isFrustumCullingEnabled; }
+  bool isOcclusionCullingEnabled() const { return m_isOcclusionCullingEnabled; }
+  const OcclusionBuffer& getOcclusionBuffer() const { return m_occlusionBuffer; }
+  const CullingStats& getCullingStats() const { return m_cullingStats; }
+  const RenderQueueStats& getRenderQueueStats() const { return m_renderQueue.getStats(); }
+  /// Gets the number of state changes issued to & elided from OpenGL during the last update.
+  const StateCacheStats& getStateCacheStats() const { return StateCache::get().getStats(); }
+  const VertexLayout& getVertexLayout() const { return m_vertexLayout; }
+  /// Gets the arena the meshes are loaded into.
+  /// \return Geometry arena, or null if the vertex layout quantizes positions, in which case each submesh is loaded into its own buffers.
+  const GeometryArena* getGeometryArena() const { return m_geometryArena.get(); }
+  const LightClusterGrid& getLightClusterGrid() const { return m_lightClusterGrid; }
+  float getLightAttenuationThreshold() const { return m_lightAttenuationThreshold; }
+  bool isDeferredShadingEnabled() const { return (m_deferredRenderer != nullptr); }
+  /// Gets the deferred renderer holding the G-buffer.
+  /// \return Deferred renderer, or null if the deferred shading is disabled.
+  const DeferredRenderer* getDeferredRenderer() const { return m_deferredRenderer.get(); }
+  const LodSelector& getLodSelector() const { return m_lodSelector; }
+  bool isGpuProfilingEnabled() const { return m_isGpuProfilingEnabled; }
+  /// Gets the GPU profiler timing the frames & their passes (geometry, lighting, cubemap & overlay) when the GPU profiling is enabled.
+  const GpuProfiler& getGpuProfiler() const { return m_gpuProfiler; }
+  LodSelector& getLodSelector() { return m_lodSelector; }
 
-  void setProgram(ShaderProgram&& program) { m_program = std::move(program); }
+  void setProgram(ShaderProgram&& program);
   void setCubemap(CubemapPtr cubemap) { m_cubemap = std::move(cubemap); }
+  /// Sets the layout the meshes' vertices are stored with, reloading all the meshes already linked.
+  /// \param layout New vertex layout.
+  void setVertexLayout(const VertexLayout& layout);
 
+  /// Enables or disables the frustum culling, which skips drawing the entities & submeshes located outside of the camera's view.
+  /// \param enabled True to enable the culling, false to draw everything.
+  void enableFrustumCulling(bool enabled = true) { m_isFrustumCullingEnabled = enabled; }
+  void disableFrustumCulling() { enableFrustumCulling(false); }
+  /// Enables or disables the occlusion culling, which skips drawing the entities hidden behind those having an Occluder component.
+  /// Occlusion culling is only performed along with frustum culling.
+  /// \param enabled True to enable the culling, false otherwise.
+  void enableOcclusionCulling(bool enabled = true) { m_isOcclusionCullingEnabled = enabled; }
+  void disableOcclusionCulling() { enableOcclusionCulling(false); }
+  /// Enables the deferred shading, in which the scene is first rendered into a G-buffer, lights then being applied on the lit pixels only.
+  /// The program must then write the G-buffer (see shaders/gbuffer.glsl) instead of computing the lighting; see DeferredRenderer.
+  /// \param lightingFragShaderPath Path to the fragment shader applying a single light (see shaders/deferred-cook-torrance.glsl).
+  void enableDeferredShading(const std::string& lightingFragShaderPath);
+  /// Disables the deferred shading, going back to the forward rendering; the program must then compute the lighting again.
+  void disableDeferredShading() { m_deferredRenderer.reset(); }
+  /// Enables or disables the GPU profiling, timing each frame & its passes with queries whose results are read a few frames later.
+  /// \param enabled True to enable the profiling, false otherwise.
+  void enableGpuProfiling(bool enabled = true) { m_isGpuProfilingEnabled = enabled; }
+  void disableGpuProfiling() { enableGpuProfiling(false); }
+  /// Enables or disables the streaming of the textures loaded when importing meshes, which are then uploaded progressively on each update.
+  /// Until their images are uploaded, the streamed textures are plain white. See TextureStreamer.
+  /// \param enabled True to stream the textures, false to load them synchronously.
+  void enableTextureStreaming(bool enabled = true) { TextureStreamer::get().enable(enabled); }
+  void disableTextureStreaming() { enableTextureStreaming(false); }
+  /// Sets the attenuation under which point & spot lights are considered negligible, defining the range of the clusters they affect.
+  /// The lights must be updated afterward for it to be taken into account.
+  /// \param attenuationThreshold Attenuation threshold; the lower, the more clusters each light affects.
+  void setLightAttenuationThreshold(float attenuationThreshold) { m_lightAttenuationThreshold = attenuationThreshold; }
   void linkEntity(const EntityPtr& entity) override;
+  void unlinkEntity(const EntityPtr& entity) override;
   bool update(float deltaTime) override;
   void sendViewMatrix(const Mat4f& viewMat) const { m_cameraUbo.sendData(viewMat, 0); }
   void sendInverseViewMatrix(const Mat4f& invViewMat) const { m_cameraUbo.sendData(invViewMat, sizeof(Mat4f)); }
@@ -37,18 +127,127 @@ public:
   void sendCameraPosition(const Vec3f& cameraPos) const { m_cameraUbo.sendData(cameraPos, sizeof(Mat4f) * 5); }
   void sendCameraMatrices(const Mat4f& viewProjMat) const;
   void sendCameraMatrices() const;
-  void updateLight(const Entity* entity, std::size_t lightIndex) const;
-  void updateLights() const;
+  /// Updates a light's data, which is uploaded on the next update if it has changed.
+  /// \param entity Entity holding the light.
+  /// \param lightIndex Index of the light, which must be lower than the number of lights known since the last call to updateLights().
+  void updateLight(const Entity* entity, std::size_t lightIndex);
+  /// Updates all the lights' data, only the changed ones being uploaded on the next update.
+  void updateLights();
   void removeCubemap() { m_cubemap.reset(); }
-  void updateShaders() const;
+  void updateShaders();
   void destroy() override { m_window.setShouldClose(); }
 
 private:
+  /// World-space bounds of a mesh entity & of each of its submeshes, along with the transformation they have been computed with.
+  /// The level of detail the entity has last been drawn with is kept alongside, to be selected with hysteresis.
+  struct MeshBounds {
+    Mat4f transform {};
+    AABB box = AABB(Vec3f(0.f), Vec3f(0.f));
+    std::vector<AABB> submeshBoxes {};
+    std::size_t lodIndex {};
+  };
+
+  /// Visible instance of a shared mesh found while preparing the draws, to be added to the mesh's instances afterward.
+  struct PreparedInstance {
+    const Mesh* mesh {};
+    const Mat4f* transform {};
+    float depth {};
+    std::size_t lodIndex {};
+  };
+
+  /// Draws prepared by a single task, whose transformation indices are relative to its own transformations.
+  struct PreparedDraws {
+    std::vector<RenderCommand> commands {};
+    std::vector<Mat4f> transforms {};
+    std::vector<PreparedInstance> instances {};
+    CullingStats cullingStats {};
+  };
+
+  /// Instances of a shared mesh at a given level of detail, gathered during each update to be drawn at once.
+  struct LodInstances {
+    std::vector<Mat4f> visibleTransforms {};
+    float closestDepth = std::numeric_limits<float>::max();
+  };
+
+  /// Instances of a shared mesh, grouped by level of detail.
+  struct SharedMeshInstances {
+    std::size_t linkedCount {};
+    std::vector<LodInstances> lodInstances {};
+  };
+
+  /// Recovers the mesh an entity is drawn with, which may be its own or a shared one.
+  /// \param entity Entity to recover the mesh of.
+  /// \return Entity's mesh, or null if it has none.
+  static const Mesh* recoverMesh(const Entity& entity);
+  /// Recovers the material a submesh is drawn with.
+  /// \param mesh Mesh containing the submesh.
+  /// \param submesh Submesh to recover the material of.
+  /// \return Submesh's material, or null if the mesh has none.
+  static const Material* recoverMaterial(const Mesh& mesh, const Submesh& submesh);
+  /// Updates the world-space bounds of an entity's mesh, which are recomputed only if its transformation or submeshes' count have changed.
+  /// \param bounds Bounds to be updated.
+  /// \param mesh Mesh of the entity, either its own or a shared one.
+  /// \param modelMat Current transformation matrix of the entity.
+  static void updateMeshBounds(MeshBounds& bounds, const Mesh& mesh, const Mat4f& modelMat);
+  /// Selects the level of detail an entity's mesh is to be drawn with, from the screen size of its bounds, & stores it in them.
+  /// \param bounds Up-to-date bounds of the entity's mesh.
+  /// \param mesh Mesh of the entity, either its own or a shared one.
+  /// \param camPos Position of the camera.
+  /// \param fieldOfView Vertical field of view of the camera, in radians.
+  /// \return Index of the selected level of detail.
+  std::size_t updateLod(MeshBounds& bounds, const Mesh& mesh, const Vec3f& camPos, float fieldOfView) const;
+  /// Splits items into ranges processed in parallel by the thread pool, or directly on this thread if there is a single one.
+  /// \param itemCount Number of items to be processed.
+  /// \param task Task processing a range of items, given the range's index, its first item & one past its last item.
+  void runPrepareTasks(std::size_t itemCount, const std::function<void(std::size_t, std::size_t, std::size_t)>& task);
+  /// Culls the mesh entities, selects their levels of detail & computes their commands' sort keys across the worker threads,
+  /// then adds the resulting commands & instances to the render queue. No OpenGL call is made while preparing them.
+  /// \param viewProjMat View-projection matrix of the camera.
+  /// \param camPos Position of the camera.
+  /// \param fieldOfView Vertical field of view of the camera, in radians.
+  void prepareDraws(const Mat4f& viewProjMat, const Vec3f& camPos, float fieldOfView);
+  /// Adds a visible instance of a shared mesh, to be drawn along with the mesh's other instances at the same level of detail.
+  /// \param mesh Shared mesh to add an instance of.
+  /// \param modelMat Transformation matrix of the instance.
+  /// \param depth Distance of the instance to the camera.
+  /// \param lodIndex Level of detail of the instance.
+  void addSharedMeshInstance(const Mesh& mesh, const Mat4f& modelMat, float depth, std::size_t lodIndex);
+  /// Loads a mesh into the geometry arena, or into its own buffers if there is none.
+  /// \param mesh Mesh to be loaded.
+  void loadMesh(const Mesh& mesh);
+  /// Assigns the lights to the clusters they affect & sends the latter to the program.
+  /// \param viewProjMat View-projection matrix of the camera.
+  void updateLightClusters(const Mat4f& viewProjMat);
+
   Window m_window;
   Entity m_camera = Entity(0);
   ShaderProgram m_program {};
   CubemapPtr m_cubemap {};
   UniformBuffer m_cameraUbo = UniformBuffer(sizeof(Mat4f) * 5 + sizeof(Vec4f), 0);
+
+  bool m_isFrustumCullingEnabled = true;
+  bool m_isOcclusionCullingEnabled = false;
+  OcclusionBuffer m_occlusionBuffer {};
+  DeferredRendererPtr m_deferredRenderer {};
+  CullingStats m_cullingStats {};
+  bool m_isGpuProfilingEnabled = false;
+  GpuProfiler m_gpuProfiler {};
+  std::unordered_map<const Entity*, MeshBounds> m_meshBounds {};
+  std::vector<std::pair<const Entity*, MeshBounds*>> m_culledEntities {};
+  BoxArray m_culledEntityBoxes {};
+  std::vector<uint32_t> m_entityVisibilityMasks {};
+  std::vector<PreparedDraws> m_preparedDraws {};
+  ThreadPool m_threadPool {};
+  RenderQueue m_renderQueue {};
+  LodSelector m_lodSelector {};
+  VertexLayout m_vertexLayout {};
+  // Indices in the arena being relative to each geometry, they fit on 16 bits for all submeshes having up to 65536 vertices
+  std::unique_ptr<GeometryArena> m_geometryArena = std::make_unique<GeometryArena>(VertexLayout(), GL_UNSIGNED_SHORT);
+  std::unordered_map<const Mesh*, SharedMeshInstances> m_sharedMeshes {};
+  LightBuffer m_lightBuffer {};
+  LightClusterGrid m_lightClusterGrid {};
+  std::vector<Sphere> m_lightVolumes {};
+  float m_lightAttenuationThreshold = 1.f / 256.f;
 };
 
 } // namespace Raz
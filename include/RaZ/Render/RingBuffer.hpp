@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef RAZ_RINGBUFFER_HPP
+#define RAZ_RINGBUFFER_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "GL/glew.h"
+#include "RaZ/Render/StateCache.hpp"
+
+namespace Raz {
+
+/// Buffer streaming data written by the CPU on each frame, split into several regions used in turn.
+/// The GPU can thus still be reading the previous frames' data while the current one is written, without any synchronization stall.
+/// If persistent mapping is available (OpenGL 4.4 or ARB_buffer_storage), the buffer remains mapped & each region is guarded by a fence;
+/// otherwise, the buffer's storage is orphaned on each write, letting the driver provide a new one while the previous is still in use.
+class RingBuffer {
+public:
+  /// Creates a ring buffer.
+  /// \param target Target the buffer is bound to (GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER, ...).
+  /// \param regionSize Initial size in bytes of each region; it is increased when more data is written at once.
+  /// \param regionCount Number of regions, which is the number of frames the CPU can be ahead of the GPU.
+  explicit RingBuffer(GLenum target, std::size_t regionSize = 65536, std::size_t regionCount = 3);
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer(RingBuffer&&) = delete;
+
+  GLuint getIndex() const { return m_index; }
+  GLenum getTarget() const { return m_target; }
+  std::size_t getRegionSize() const { return m_regionSize; }
+  std::size_t getRegionCount() const { return m_regionCount; }
+  bool isPersistentlyMapped() const { return (m_mappedData != nullptr); }
+
+  void bind() const { StateCache::get().bindBuffer(m_target, m_index); }
+  void unbind() const { StateCache::get().bindBuffer(m_target, 0); }
+  /// Moves to the next region & writes the given data into it, waiting for the GPU to be done with it beforehand if needed.
+  /// The buffer is left bound to its target.
+  /// \param data Data to be written.
+  /// \param size Size in bytes of the data. If greater than the regions' size, the buffer is reallocated.
+  /// \return Offset in bytes from the buffer's beginning at which the data has been written.
+  std::size_t write(const void* data, std::size_t size);
+  /// Marks the current region as in use by the commands issued so far; it must be called after the draws reading the written data.
+  void fence();
+
+  RingBuffer& operator=(const RingBuffer&) = delete;
+  RingBuffer& operator=(RingBuffer&&) = delete;
+
+  ~RingBuffer() { release(); }
+
+private:
+  /// Creates the buffer's storage for regions of the given size, mapping it if persistent mapping is available.
+  /// \param regionSize Size in bytes of each region.
+  void allocate(std::size_t regionSize);
+  /// Waits for the GPU to be done reading a region.
+  /// \param regionIndex Index of the region to wait for.
+  void waitForRegion(std::size_t regionIndex);
+  /// Waits for all regions to be unused, then destroys the buffer.
+  void release();
+
+  GLenum m_target {};
+  GLuint m_index {};
+  std::size_t m_regionSize {};
+  std::size_t m_regionCount {};
+  std::size_t m_regionIndex {};
+  uint8_t* m_mappedData {};
+  std::vector<GLsync> m_fences {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_RINGBUFFER_HPP
@@ -9,6 +9,7 @@
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
 #include "RaZ/Render/Shader.hpp"
+#include "RaZ/Render/StateCache.hpp"
 
 namespace Raz {
 
@@ -27,7 +28,7 @@ public:
 
   void link() const;
   void updateShaders() const;
-  void use() const { glUseProgram(m_index); }
+  void use() const { StateCache::get().useProgram(m_index); }
   void createUniform(const std::string& uniformName);
   int recoverUniformLocation(const std::string& uniformName) const;
   template <typename T> void sendUniform(int uniformIndex, T value) const;
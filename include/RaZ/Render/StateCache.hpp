@@ -0,0 +1,139 @@
+#pragma once
+
+#ifndef RAZ_STATECACHE_HPP
+#define RAZ_STATECACHE_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include "GL/glew.h"
+
+namespace Raz {
+
+/// Number of OpenGL calls which went through the state cache, and how many of them were skipped for not changing anything.
+struct StateCacheStats {
+  std::size_t issuedCallCount {};
+  std::size_t elidedCallCount {};
+};
+
+/// Tracker of the OpenGL context's current bindings & states, skipping the calls which would set them to their current values.
+/// All binds & state changes made by the engine go through it; if they are made by other means, invalidate() must be called afterward.
+/// States are unknown until set for the first time, the corresponding calls then being always issued.
+/// Bindings to targets, units & capabilities which are not tracked are always issued.
+class StateCache {
+public:
+  static constexpr std::size_t TextureUnitCount = 32;
+
+  StateCache() { invalidate(); }
+  StateCache(const StateCache&) = delete;
+  StateCache(StateCache&&) = delete;
+
+  /// Gets the state cache of the OpenGL context; the engine using a single context, there is only one.
+  /// \return Reference to the state cache.
+  static StateCache& get();
+
+  const StateCacheStats& getStats() const { return m_stats; }
+
+  void resetStats() { m_stats = StateCacheStats(); }
+  void useProgram(GLuint programIndex);
+  /// Binds a vertex array. As the element buffer's binding is part of the vertex array's state, it becomes unknown when the latter changes.
+  /// \param vertexArrayIndex Index of the vertex array to be bound.
+  void bindVertexArray(GLuint vertexArrayIndex);
+  void bindBuffer(GLenum target, GLuint bufferIndex);
+  /// Binds a range of a buffer to an indexed binding point, which also binds the buffer to the target. It is always issued.
+  /// \param target Target of the binding point (GL_UNIFORM_BUFFER, ...).
+  /// \param bindingIndex Index of the binding point.
+  /// \param bufferIndex Index of the buffer to be bound.
+  /// \param offset Offset in bytes of the range.
+  /// \param size Size in bytes of the range.
+  void bindBufferRange(GLenum target, GLuint bindingIndex, GLuint bufferIndex, GLintptr offset, GLsizeiptr size);
+  /// Binds a whole buffer to an indexed binding point, which also binds the buffer to the target. It is always issued.
+  /// \param target Target of the binding point (GL_UNIFORM_BUFFER, ...).
+  /// \param bindingIndex Index of the binding point.
+  /// \param bufferIndex Index of the buffer to be bound.
+  void bindBufferBase(GLenum target, GLuint bindingIndex, GLuint bufferIndex);
+  void activateTextureUnit(uint8_t unit);
+  /// Binds a texture to the active texture unit.
+  /// \param target Target of the texture (GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP or GL_TEXTURE_BUFFER being tracked).
+  /// \param textureIndex Index of the texture to be bound.
+  void bindTexture(GLenum target, GLuint textureIndex);
+  /// Binds a texture to a given unit, activating the latter beforehand.
+  /// \param target Target of the texture (GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP or GL_TEXTURE_BUFFER being tracked).
+  /// \param textureIndex Index of the texture to be bound.
+  /// \param unit Texture unit to bind the texture to.
+  void bindTexture(GLenum target, GLuint textureIndex, uint8_t unit) { activateTextureUnit(unit); bindTexture(target, textureIndex); }
+  void bindFramebuffer(GLuint framebufferIndex);
+  /// Enables or disables a capability (GL_DEPTH_TEST, GL_CULL_FACE, GL_BLEND, GL_STENCIL_TEST & GL_SCISSOR_TEST being tracked).
+  /// \param capability Capability to be changed.
+  /// \param enabled True to enable the capability, false to disable it.
+  void setCapability(GLenum capability, bool enabled);
+  /// Checks if a capability is enabled. If its state is unknown or not tracked, it is queried; a tracked state is then remembered.
+  /// \param capability Capability to be checked.
+  /// \return True if the capability is enabled, false otherwise.
+  bool isCapabilityEnabled(GLenum capability);
+  void setDepthFunction(GLenum function);
+  void setDepthMask(bool enabled);
+  void setCullFace(GLenum face);
+  void setBlendFunction(GLenum sourceFactor, GLenum destinationFactor);
+  /// Deletes a buffer, forgetting the bindings it had.
+  /// \param bufferIndex Index of the buffer to be deleted; it is reset to 0.
+  void deleteBuffer(GLuint& bufferIndex);
+  /// Deletes a texture, forgetting the bindings it had.
+  /// \param textureIndex Index of the texture to be deleted; it is reset to 0.
+  void deleteTexture(GLuint& textureIndex);
+  /// Deletes a vertex array, forgetting its binding.
+  /// \param vertexArrayIndex Index of the vertex array to be deleted; it is reset to 0.
+  void deleteVertexArray(GLuint& vertexArrayIndex);
+  /// Deletes a framebuffer, forgetting its binding.
+  /// \param framebufferIndex Index of the framebuffer to be deleted; it is reset to 0.
+  void deleteFramebuffer(GLuint& framebufferIndex);
+  /// Forgets all the states, making them unknown. It must be called after changing them without going through the cache.
+  void invalidate();
+
+  StateCache& operator=(const StateCache&) = delete;
+  StateCache& operator=(StateCache&&) = delete;
+
+private:
+  static constexpr GLuint UnknownValue = std::numeric_limits<GLuint>::max();
+  static constexpr std::size_t UntrackedSlot = std::numeric_limits<std::size_t>::max();
+
+  static constexpr std::size_t BufferTargetCount  = 8;
+  static constexpr std::size_t TextureTargetCount = 3;
+  static constexpr std::size_t CapabilityCount    = 5;
+
+  /// Recovers the slot in which a buffer target's binding is stored.
+  /// \param target Buffer target.
+  /// \return Slot of the target, or UntrackedSlot if it is not tracked.
+  static std::size_t recoverBufferSlot(GLenum target);
+  /// Recovers the slot in which a texture target's binding is stored for each unit.
+  /// \param target Texture target.
+  /// \return Slot of the target, or UntrackedSlot if it is not tracked.
+  static std::size_t recoverTextureSlot(GLenum target);
+  /// Recovers the slot in which a capability's state is stored.
+  /// \param capability Capability.
+  /// \return Slot of the capability, or UntrackedSlot if it is not tracked.
+  static std::size_t recoverCapabilitySlot(GLenum capability);
+  /// Stores a state's new value, counting the call as issued if it differs from the current one, or as elided otherwise.
+  /// \param currentValue Current value of the state; if null, the state is not tracked & the call is always issued.
+  /// \param newValue New value of the state.
+  /// \return True if the call must be issued, false if it can be skipped.
+  bool update(GLuint* currentValue, GLuint newValue);
+
+  GLuint m_program {};
+  GLuint m_vertexArray {};
+  GLuint m_framebuffer {};
+  GLuint m_activeTextureUnit {};
+  GLuint m_depthFunction {};
+  GLuint m_depthMask {};
+  GLuint m_cullFace {};
+  GLuint m_blendFunction {}; ///< Source factor in the upper 16 bits, destination factor in the lower ones.
+  std::array<GLuint, BufferTargetCount> m_buffers {};
+  std::array<std::array<GLuint, TextureTargetCount>, TextureUnitCount> m_textures {};
+  std::array<GLuint, CapabilityCount> m_capabilities {};
+  StateCacheStats m_stats {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_STATECACHE_HPP
@@ -3,12 +3,17 @@
 #ifndef RAZ_SUBMESH_HPP
 #define RAZ_SUBMESH_HPP
 
+#include <limits>
 #include <memory>
 
+#include "RaZ/Render/GeometryArena.hpp"
 #include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Utils/BoundingVolumeHierarchy.hpp"
+#include "RaZ/Utils/Ray.hpp"
 
 namespace Raz {
 
+class ShaderProgram;
 class Submesh;
 using SubmeshPtr = std::unique_ptr<Submesh>;
 
@@ -29,20 +34,115 @@ public:
   std::size_t getMaterialIndex() const { return m_materialIndex; }
   std::size_t getVertexCount() const { return m_vbo.getVertices().size(); }
   std::size_t getIndexCount() const { return getEbo().getIndices().size(); }
+  const BoundingVolumeHierarchy& getBvh() const { return m_bvh; }
+  const AABB& getBoundingBox() const { return m_boundingBox; }
+  const Sphere& getBoundingSphere() const { return m_boundingSphere; }
+  /// Gets the number of levels of detail, including the full-detail one.
+  /// \return Number of levels of detail, always at least 1.
+  std::size_t getLodCount() const { return m_lodIndices.size() + 1; }
+  /// Gets the indices of a level of detail, which index the submesh's vertices.
+  /// \param lodIndex Index of the level of detail; 0 is the submesh's own indices.
+  /// \return Indices of the level of detail.
+  const std::vector<unsigned int>& getLodIndices(std::size_t lodIndex) const { return (lodIndex == 0 ? getIndices() : m_lodIndices[lodIndex - 1]); }
+  /// Gets the error of a level of detail, relative to the extent of the submesh; see MeshSimplifier.
+  /// \param lodIndex Index of the level of detail; 0 is the submesh's own indices, whose error is always 0.
+  /// \return Error of the level of detail.
+  float getLodError(std::size_t lodIndex) const { return (lodIndex == 0 ? 0.f : m_lodErrors[lodIndex - 1]); }
+  /// Computes the offset of a level of detail's indices in the loaded index buffer, in which all levels are stored one after the other.
+  /// \param lodIndex Index of the level of detail.
+  /// \return Number of indices preceding the level of detail.
+  std::size_t computeLodFirstIndex(std::size_t lodIndex) const;
+  /// Recovers the vertex array the submesh is drawn with, which is its arena's one if it has been loaded into an arena.
+  /// \return Vertex array to be bound to draw the submesh.
+  const VertexArray& recoverVertexArray() const { return (m_arena ? m_arena->getVao() : m_vao); }
+  /// Recovers the current range of the submesh in its arena.
+  /// \return Range of the submesh, or null if it has not been loaded into an arena.
+  const GeometryRange* recoverGeometryRange() const { return (m_arena ? &m_arena->getRange(m_arenaHandle) : nullptr); }
+  /// Recovers the type of the indices the submesh is drawn with, which is its arena's one if it has been loaded into an arena.
+  /// \return Type of the loaded indices, either GL_UNSIGNED_INT or GL_UNSIGNED_SHORT.
+  GLenum recoverIndexType() const { return (m_arena ? m_arena->getIndexType() : m_indexType); }
 
   template <typename... Args>
   static SubmeshPtr create(Args&&... args) { return std::make_unique<Submesh>(std::forward<Args>(args)...); }
 
   void setMaterialIndex(std::size_t materialIndex) { m_materialIndex = materialIndex; }
 
-  void load() const;
+  /// Computes & stores the local-space bounding box & sphere enclosing all the submesh's vertices.
+  /// They are computed on import & on creation from a shape; they must be recomputed if the vertices are modified.
+  /// If the submesh has no vertex, both are null & centered on the origin.
+  void computeBounds();
+  /// Computes the bounding volume hierarchy of the submesh's triangles, speeding up the ray intersection checks.
+  /// It must be recomputed if the vertices or indices are modified.
+  void computeBvh();
+  /// Ray-submesh intersection check, finding the closest triangle hit.
+  /// If the bounding volume hierarchy has not been computed, every triangle is checked.
+  /// \param ray Ray to check if there is an intersection with.
+  /// \param hit Optional hit information, filled with the closest hit & its triangle index if an intersection is found.
+  /// \param maxDistance Distance beyond which hits are ignored.
+  /// \return True if the ray intersects the submesh, false otherwise.
+  bool intersects(const Ray& ray, RayHit* hit = nullptr, float maxDistance = std::numeric_limits<float>::max()) const;
+  /// Reorders the triangles for the GPU's vertex cache & to reduce overdraw, then the vertices to be fetched linearly; see MeshOptimizer.
+  /// The geometry is unchanged, but unreferenced vertices are removed. It must be done before loading the submesh.
+  /// The bounding volume hierarchy is recomputed if it has already been.
+  /// \param overdrawThreshold Maximum ratio by which the overdraw optimization may degrade the vertex cache's efficiency.
+  /// The levels of detail are removed, as they would no longer index the right vertices; they must be generated afterward.
+  void optimize(float overdrawThreshold = 1.05f);
+  /// Generates simplified versions of the submesh's triangles, each one from the previous; see MeshSimplifier.
+  /// They share the submesh's vertices & are loaded along with its indices. Generation stops early when the triangles cannot be
+  /// simplified anymore within the allowed error. Previous levels of detail are replaced. It must be done before loading the submesh.
+  /// \param lodCount Number of levels of detail to be generated, excluding the full-detail one.
+  /// \param reductionRatio Ratio of triangles each level of detail should keep from the previous one.
+  /// \param maxError Maximum error of a level of detail, relative to the extent of the submesh.
+  void generateLods(std::size_t lodCount, float reductionRatio = 0.5f, float maxError = 0.05f);
+  /// Uploads the submesh's vertices & indices into its own buffers, replacing its previous location.
+  /// Indices are stored as unsigned shorts if the submesh has no more than 65536 vertices.
+  /// \param layout Layout of the vertices in the buffer. If it quantizes the positions, the bounds must be up to date.
+  void load(const VertexLayout& layout = VertexLayout()) const;
+  /// Uploads the submesh's vertices & indices into a shared arena instead of its own buffers, replacing its previous location.
+  /// Empty submeshes & those having more vertices than the arena can index are loaded into their own buffers with the arena's vertex layout.
+  /// The arena must outlive the submesh, or the latter must be unloaded beforehand.
+  /// \param arena Arena to load the submesh into.
+  void load(GeometryArena& arena) const;
+  /// Removes the submesh from its arena, if any.
+  void unload() const;
+  void bind() const { recoverVertexArray().bind(); }
+  /// Sends to a program the offset & scale restoring the loaded positions (uniPositionOffset & uniPositionScale).
+  /// They are respectively 0 & 1 unless the positions have been quantized.
+  /// \param program Program to send the uniforms to, which must be in use.
+  void sendPositionDequantization(const ShaderProgram& program) const;
+  /// Issues the draw call of the submesh's triangles, which requires its vertex array to be bound.
+  /// \param lodIndex Index of the level of detail to be drawn.
+  void drawElements(std::size_t lodIndex = 0) const;
+  /// Issues an instanced draw call of the submesh's triangles, which requires its vertex array & instance attributes to be bound.
+  /// \param instanceCount Number of instances to be drawn.
+  /// \param baseInstance Index of the first instance to be read from the instance attributes; requires ARB_base_instance if not 0.
+  /// \param lodIndex Index of the level of detail to be drawn.
+  void drawElementsInstanced(std::size_t instanceCount, std::size_t baseInstance = 0, std::size_t lodIndex = 0) const;
   void draw() const;
 
+  ~Submesh() { unload(); }
+
 private:
+  /// Gathers the indices of all levels of detail one after the other, as they are loaded.
+  /// \return Indices of all levels of detail.
+  std::vector<unsigned int> gatherLodIndices() const;
+
   VertexArray m_vao {};
   VertexBuffer m_vbo {};
+  BoundingVolumeHierarchy m_bvh {};
+  AABB m_boundingBox = AABB(Vec3f(0.f), Vec3f(0.f));
+  Sphere m_boundingSphere = Sphere(Vec3f(0.f), 0.f);
 
   std::size_t m_materialIndex {};
+  std::vector<std::vector<unsigned int>> m_lodIndices {};
+  std::vector<float> m_lodErrors {};
+
+  // Like the buffers' content, the geometry's location is part of the loaded state
+  mutable GeometryArena* m_arena {};
+  mutable std::size_t m_arenaHandle {};
+  mutable GLenum m_indexType = GL_UNSIGNED_INT;
+  mutable Vec3f m_positionOffset = Vec3f(0.f);
+  mutable Vec3f m_positionScale = Vec3f(1.f);
 };
 
 } // namespace Raz
@@ -3,11 +3,13 @@
 #ifndef RAZ_TEXTURE_HPP
 #define RAZ_TEXTURE_HPP
 
+#include <array>
 #include <memory>
 #include <string>
 
 #include "GL/glew.h"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Render/StateCache.hpp"
 #include "RaZ/Utils/Image.hpp"
 
 namespace Raz {
@@ -26,7 +28,12 @@ class Texture {
 public:
   Texture() { glGenTextures(1, &m_index); }
   explicit Texture(uint8_t value) : Texture() { makePlainColored(Vec3b(value)); }
-  Texture(unsigned int width, unsigned int height, ImageColorspace colorspace = ImageColorspace::RGB);
+  /// Creates an empty texture, typically to be rendered into.
+  /// \param width Width of the texture.
+  /// \param height Height of the texture.
+  /// \param colorspace Colorspace of the texture.
+  /// \param dataType Type of the texture's values; floating-point color textures are stored on 16 bits, except gray ones which take 32 bits.
+  Texture(unsigned int width, unsigned int height, ImageColorspace colorspace = ImageColorspace::RGB, ImageDataType dataType = ImageDataType::BYTE);
   explicit Texture(const std::string& fileName) : Texture() { load(fileName); }
 
   GLuint getIndex() const { return m_index; }
@@ -34,22 +41,52 @@ public:
   template <typename... Args>
   static TexturePtr create(Args&&... args) { return std::make_shared<Texture>(std::forward<Args>(args)...); }
   static TexturePtr recoverTexture(TexturePreset preset);
-  static void activate(uint8_t index) { glActiveTexture(GL_TEXTURE0 + index); }
-
-  void load(const std::string& fileName);
+  static void activate(uint8_t index) { StateCache::get().activateTextureUnit(index); }
+
+  void load(const std::string& fileName) { load(Image::create(fileName)); }
+  /// Loads an already decoded image, uploading its data; an empty image makes the texture plain white.
+  /// \param image Image to be loaded.
+  void load(ImagePtr image);
+  /// Loads an already decoded image, whose data are read from the currently bound pixel unpack buffer instead of the image itself.
+  /// \param image Image to be loaded, which must not be empty.
+  /// \param bufferOffset Offset in bytes of the image's data in the pixel unpack buffer.
+  void loadFromUnpackBuffer(ImagePtr image, std::size_t bufferOffset);
   void save(const std::string& fileName, bool reverse = false) const { m_image->save(fileName, reverse); }
-  void bind() const { glBindTexture(GL_TEXTURE_2D, m_index); }
-  void unbind() const { glBindTexture(GL_TEXTURE_2D, 0); }
+  void bind() const { StateCache::get().bindTexture(GL_TEXTURE_2D, m_index); }
+  void unbind() const { StateCache::get().bindTexture(GL_TEXTURE_2D, 0); }
 
-  ~Texture() { glDeleteTextures(1, &m_index); }
+  ~Texture() { StateCache::get().deleteTexture(m_index); }
 
 private:
   void makePlainColored(const Vec3b& color) const;
+  /// Sets the texture's parameters according to its image & uploads the latter's pixels.
+  /// \param pixels Pixels to be uploaded, or offset in the pixel unpack buffer if one is bound.
+  void uploadImage(const void* pixels) const;
 
   GLuint m_index {};
   ImagePtr m_image {};
 };
 
+/// Textures bound to each unit, allowing to skip binding those which already are.
+/// It is only valid as long as textures are not bound by other means; it must be reset otherwise.
+class TextureBindings {
+public:
+  static constexpr std::size_t UnitCount = 16;
+
+  std::size_t getBindCount() const { return m_bindCount; }
+
+  /// Binds a texture to a unit, unless it already is.
+  /// \param texture Texture to be bound.
+  /// \param unit Unit to bind the texture to; must be lower than the unit count.
+  void bind(const Texture& texture, uint8_t unit);
+  /// Forgets all the bound textures & resets the bind count.
+  void reset();
+
+private:
+  std::array<GLuint, UnitCount> m_textureIndices {};
+  std::size_t m_bindCount {};
+};
+
 } // namespace Raz
 
 #endif // RAZ_TEXTURE_HPP
@@ -0,0 +1,103 @@
+#pragma once
+
+#ifndef RAZ_TEXTURESTREAMER_HPP
+#define RAZ_TEXTURESTREAMER_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+#include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
+
+namespace Raz {
+
+/// Loader of textures decoding their images on worker threads, then uploading them progressively from the OpenGL thread.
+/// A streamed texture can be used right away, holding the color of a placeholder preset until its image has been uploaded into it.
+/// The image replacing the placeholder in the same OpenGL texture, everything referencing the texture (materials, ...) shows it as soon as it is ready.
+/// Uploads are made by update(), which must be called once per frame, within a byte budget so that a frame is never stalled by many of them.
+/// Each upload goes through a pixel unpack buffer, which is reused only once a fence signals that the texture has read it.
+/// The threads & buffers are released once all the requested textures have been uploaded, or when the window is closed.
+class TextureStreamer {
+public:
+  static constexpr std::size_t DefaultUploadBudget = 16 * 1024 * 1024;
+
+  TextureStreamer() = default;
+  TextureStreamer(const TextureStreamer&) = delete;
+  TextureStreamer(TextureStreamer&&) = delete;
+
+  /// Gets the texture streamer of the OpenGL context; the engine using a single context, there is only one.
+  /// \return Reference to the texture streamer.
+  static TextureStreamer& get();
+
+  /// Checks if the textures loaded by the meshes' importers are streamed; if not, they are loaded synchronously.
+  /// \return True if the textures are streamed, false otherwise.
+  bool isEnabled() const { return m_isEnabled; }
+  std::size_t getUploadBudget() const { return m_uploadBudget; }
+  /// Gets the number of textures requested whose image has not been uploaded yet.
+  std::size_t getPendingCount() const;
+
+  /// Enables or disables the streaming of the textures loaded by the meshes' importers.
+  /// \param enabled True to stream the textures, false to load them synchronously.
+  void enable(bool enabled = true) { m_isEnabled = enabled; }
+  void disable() { enable(false); }
+  /// Sets the maximum number of bytes uploaded by each update. A single image exceeding it is uploaded alone.
+  /// \param uploadBudget Upload budget in bytes.
+  void setUploadBudget(std::size_t uploadBudget) { m_uploadBudget = uploadBudget; }
+  /// Requests a texture to be streamed, its image starting to be decoded in the background.
+  /// \param filePath Path to the image to be loaded.
+  /// \param placeholder Preset whose color the texture has until its image is uploaded.
+  /// \return Texture, immediately usable.
+  TexturePtr load(const std::string& filePath, TexturePreset placeholder = TexturePreset::WHITE);
+  /// Uploads the images decoded so far, as long as the upload budget allows it. Must be called from the OpenGL thread.
+  void update();
+  /// Waits for all the requested images to be decoded & uploads them, regardless of the budget. Must be called from the OpenGL thread.
+  void flush();
+  /// Destroys the threads & the unpack buffers; the textures still pending keep their placeholder until the next update.
+  /// As it is a singleton outliving the OpenGL context, this must be called from the OpenGL thread before the context is destroyed,
+  /// which the window does when closing.
+  void release();
+
+  TextureStreamer& operator=(const TextureStreamer&) = delete;
+  TextureStreamer& operator=(TextureStreamer&&) = delete;
+
+  /// Only joins the threads: the OpenGL objects must have been released beforehand, as the context is already destroyed.
+  ~TextureStreamer() { m_threadPool.reset(); }
+
+private:
+  /// Texture whose image has been decoded, waiting to be uploaded. The texture is not kept alive if nothing else references it.
+  struct DecodedTexture {
+    std::weak_ptr<Texture> texture {};
+    ImagePtr image {};
+  };
+
+  /// Pixel unpack buffer, along with the fence signaled once the texture it has been uploaded to has read it.
+  struct UnpackBuffer {
+    GLuint index {};
+    std::size_t size {};
+    GLsync fence {};
+  };
+
+  /// Uploads decoded images in their decoding order.
+  /// \param uploadBudget Maximum number of bytes to be uploaded; the first image is always uploaded.
+  void uploadDecodedTextures(std::size_t uploadBudget);
+  /// Recovers an unpack buffer which is not being read anymore, creating one if none is available, & binds it.
+  /// \param size Minimum size of the buffer in bytes.
+  /// \return Available buffer.
+  UnpackBuffer& recoverUnpackBuffer(std::size_t size);
+
+  bool m_isEnabled = false;
+  std::size_t m_uploadBudget = DefaultUploadBudget;
+  std::unique_ptr<ThreadPool> m_threadPool {};
+  std::vector<UnpackBuffer> m_unpackBuffers {};
+
+  mutable std::mutex m_mutex {};
+  std::vector<DecodedTexture> m_decodedTextures {};
+  std::size_t m_pendingCount {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_TEXTURESTREAMER_HPP
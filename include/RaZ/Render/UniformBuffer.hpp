@@ -7,6 +7,7 @@
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
 #include "RaZ/Render/ShaderProgram.hpp"
+#include "RaZ/Render/StateCache.hpp"
 
 namespace Raz {
 
@@ -20,14 +21,14 @@ public:
 
   void bindUniformBlock(const ShaderProgram& program, unsigned int uboIndex, unsigned int bindingIndex) const;
   void bindUniformBlock(const ShaderProgram& program, const std::string& uboName, unsigned int bindingIndex) const;
-  void bindBufferBase(unsigned int bindingIndex) const { glBindBufferBase(GL_UNIFORM_BUFFER, bindingIndex, m_index); }
-  void bind() const { glBindBuffer(GL_UNIFORM_BUFFER, m_index); }
-  void unbind() const { glBindBuffer(GL_UNIFORM_BUFFER, 0); }
+  void bindBufferBase(unsigned int bindingIndex) const { StateCache::get().bindBufferBase(GL_UNIFORM_BUFFER, bindingIndex, m_index); }
+  void bind() const { StateCache::get().bindBuffer(GL_UNIFORM_BUFFER, m_index); }
+  void unbind() const { StateCache::get().bindBuffer(GL_UNIFORM_BUFFER, 0); }
   template <typename T> void sendData(T data, unsigned int offset) const;
   template <typename T, std::size_t Size> void sendData(const Vector<T, Size>& vec, unsigned int offset) const;
   template <typename T, std::size_t W, std::size_t H> void sendData(const Matrix<T, W, H>& mat, unsigned int offset) const;
 
-  ~UniformBuffer() { glDeleteBuffers(1, &m_index); }
+  ~UniformBuffer() { StateCache::get().deleteBuffer(m_index); }
 
 private:
   GLuint m_index {};
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef RAZ_VERTEXLAYOUT_HPP
+#define RAZ_VERTEXLAYOUT_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "GL/glew.h"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+struct Vertex;
+
+enum class PositionFormat : uint8_t {
+  FLOAT = 0,        ///< 3 floats (12 bytes).
+  QUANTIZED_UNORM16 ///< 3 normalized unsigned shorts relative to the geometry's bounding box, padded to 8 bytes.
+};
+
+enum class TexcoordsFormat : uint8_t {
+  FLOAT = 0, ///< 2 floats (8 bytes).
+  HALF_FLOAT ///< 2 half floats (4 bytes).
+};
+
+enum class DirectionFormat : uint8_t {
+  FLOAT = 0,        ///< 3 floats for each of the normal & the tangent (24 bytes).
+  PACKED_10_10_10_2 ///< 10 normalized signed bits per component for each of the normal & the tangent, the latter's 2 remaining bits holding its handedness (8 bytes).
+};
+
+/// Format of the vertices as stored in GPU buffers, each attribute being converted from the vertices' floating point values on upload.
+/// The default layout stores every attribute as floats, 44 bytes per vertex; the most compact one takes 20 bytes.
+/// Quantized positions must be dequantized by the vertex shader, the offset & scale to apply being computed from the geometry's bounding box.
+struct VertexLayout {
+  PositionFormat positionFormat   = PositionFormat::FLOAT;
+  TexcoordsFormat texcoordsFormat = TexcoordsFormat::FLOAT;
+  DirectionFormat directionFormat = DirectionFormat::FLOAT;
+
+  /// Creates a layout compressing the texcoords & directions, keeping full precision positions.
+  /// \param quantizePositions True to also quantize the positions relative to their bounding box, false otherwise.
+  /// \return Compressed vertex layout.
+  static VertexLayout compressed(bool quantizePositions = false);
+
+  bool isCompressed() const { return (*this != VertexLayout()); }
+  std::size_t computePositionSize() const { return (positionFormat == PositionFormat::FLOAT ? sizeof(float) * 3 : sizeof(uint16_t) * 4); }
+  std::size_t computeTexcoordsSize() const { return (texcoordsFormat == TexcoordsFormat::FLOAT ? sizeof(float) * 2 : sizeof(uint16_t) * 2); }
+  std::size_t computeDirectionSize() const { return (directionFormat == DirectionFormat::FLOAT ? sizeof(float) * 3 : sizeof(uint32_t)); }
+  /// Computes the size in bytes of a vertex stored with this layout.
+  /// \return Vertex' stride.
+  std::size_t computeStride() const { return computePositionSize() + computeTexcoordsSize() + computeDirectionSize() * 2; }
+  /// Converts vertices to this layout.
+  /// \param vertices Vertices to be converted.
+  /// \param bounds Bounding box of the vertices, to which the positions are made relative if quantized.
+  /// \return Bytes of the converted vertices, to be uploaded as is.
+  std::vector<uint8_t> packVertices(const std::vector<Vertex>& vertices, const AABB& bounds) const;
+  /// Defines the vertex attributes of the currently bound vertex array, read from the buffer currently bound to GL_ARRAY_BUFFER.
+  void setupAttributes() const;
+
+  bool operator==(const VertexLayout& layout) const { return (positionFormat == layout.positionFormat)
+                                                          && (texcoordsFormat == layout.texcoordsFormat)
+                                                          && (directionFormat == layout.directionFormat); }
+  bool operator!=(const VertexLayout& layout) const { return !(*this == layout); }
+};
+
+namespace VertexPacking {
+
+/// Quantizes a position relative to a bounding box, each component being mapped from the box's range to [0; 65535].
+/// \param position Position to be quantized, which must be located inside the box.
+/// \param bounds Bounding box the position is relative to.
+/// \return Quantized components of the position, followed by a padding value.
+std::array<uint16_t, 4> quantizePosition(const Vec3f& position, const AABB& bounds);
+/// Computes the offset & scale restoring positions quantized relative to a bounding box: position = offset + quantizedPosition * scale.
+/// \param bounds Bounding box the positions are relative to.
+/// \param offset Offset to be added to the normalized quantized positions.
+/// \param scale Scale to be applied to the normalized quantized positions.
+void computeDequantization(const AABB& bounds, Vec3f& offset, Vec3f& scale);
+/// Packs a direction into 10 bits per component & a 2 bits value, all normalized & signed, as read by the GL_INT_2_10_10_10_REV type.
+/// \param direction Direction to be packed, whose components must be in [-1; 1].
+/// \param w Value of the 4th component, which must be either -1, 0 or 1.
+/// \return Packed direction.
+uint32_t packDirection(const Vec3f& direction, float w = 1.f);
+/// Unpacks a direction packed by packDirection().
+/// \param packedDirection Packed direction.
+/// \param w Optional unpacked 4th component.
+/// \return Unpacked direction.
+Vec3f unpackDirection(uint32_t packedDirection, float* w = nullptr);
+
+} // namespace VertexPacking
+
+} // namespace Raz
+
+#endif // RAZ_VERTEXLAYOUT_HPP
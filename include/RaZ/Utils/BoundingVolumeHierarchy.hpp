@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
+#define RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
+
+#include <vector>
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/RayPacket.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+/// Binary tree of axis-aligned bounding boxes, allowing to find quickly which primitives (triangles, entities, ...) may be hit.
+/// The hierarchy only knows the primitives' boxes & indices; the actual checks against them are made by the callers.
+class BoundingVolumeHierarchy {
+public:
+  BoundingVolumeHierarchy() = default;
+  explicit BoundingVolumeHierarchy(const std::vector<AABB>& primitiveBoxes) { build(primitiveBoxes); }
+
+  bool isEmpty() const { return m_nodes.empty(); }
+  std::size_t getNodeCount() const { return m_nodes.size(); }
+  std::size_t getPrimitiveCount() const { return m_primitiveIndices.size(); }
+
+  /// Recovers the box enclosing all the primitives.
+  /// The hierarchy must not be empty.
+  /// \return Root box of the hierarchy.
+  AABB recoverRootBox() const;
+  /// Builds the hierarchy from the given primitives' boxes, by recursively splitting them on their centroids' largest axis.
+  /// \param primitiveBoxes Bounding boxes of the primitives, whose indices are those given back by the queries.
+  void build(const std::vector<AABB>& primitiveBoxes);
+  /// Updates the nodes' boxes from the given primitives' ones, keeping the tree's structure.
+  /// This is much cheaper than rebuilding, but the hierarchy's quality decreases as the primitives move away from their original positions.
+  /// \param primitiveBoxes Updated bounding boxes of the primitives; must be as many as when the hierarchy was built.
+  void refit(const std::vector<AABB>& primitiveBoxes);
+  /// Finds the primitives which may be hit by a ray, traversing the closest nodes first.
+  /// \tparam HitFuncT Type of the function called for each primitive to be checked.
+  /// \param ray Ray to check the hierarchy with.
+  /// \param maxDistance Distance beyond which nodes are skipped. Should be lowered by the hit function to the closest hit found;
+  ///   setting it to 0 stops the traversal, which allows to stop at the first hit.
+  /// \param hitPrimitive Function called with each primitive's index & the maximum distance, which must return true if it has been hit.
+  /// \return True if any primitive has been hit, false otherwise.
+  template <typename HitFuncT>
+  bool query(const Ray& ray, float& maxDistance, HitFuncT&& hitPrimitive) const;
+  /// Finds the primitives which may be hit by a packet of rays, traversing the nodes until none of the rays can hit them.
+  /// \tparam Size Number of rays in the packet.
+  /// \tparam HitFuncT Type of the function called for each primitive to be checked.
+  /// \param packet Packet of rays to check the hierarchy with.
+  /// \param maxDistances Distances for each ray beyond which nodes are skipped. Should be lowered by the hit function to the closest hits found.
+  /// \param hitPrimitive Function called with each primitive's index, the mask of rays reaching it & the maximum distances,
+  ///   which must return the mask of the rays having hit it.
+  /// \return Mask of the rays having hit any primitive.
+  template <std::size_t Size, typename HitFuncT>
+  uint32_t query(const RayPacket<Size>& packet, typename RayPacket<Size>::DistanceArray& maxDistances, HitFuncT&& hitPrimitive) const;
+  /// Finds the primitives whose boxes overlap a given box.
+  /// \tparam FuncT Type of the function called for each overlapping primitive.
+  /// \param box Box to check the hierarchy with.
+  /// \param overlapPrimitive Function called with each overlapping primitive's index.
+  template <typename FuncT>
+  void query(const AABB& box, FuncT&& overlapPrimitive) const;
+
+private:
+  // Nodes are stored depth-first: a node's first child directly follows it, the index pointing to the second one
+  // If the node is a leaf, the index is the one of its first primitive in the list of primitives' indices
+  struct Node {
+    Vec3f minPos {};
+    Vec3f maxPos {};
+    std::size_t index {};
+    std::size_t primitiveCount {};
+  };
+
+  static constexpr std::size_t MaxLeafPrimitiveCount = 4;
+  static constexpr std::size_t MaxDepth = 64;
+
+  std::size_t buildNode(const std::vector<AABB>& primitiveBoxes, const std::vector<Vec3f>& centroids,
+                        std::size_t firstIndex, std::size_t primitiveCount, std::size_t depth);
+  bool intersectsNode(const Node& node, const Ray& ray, float maxDistance, float& hitDistance) const;
+
+  std::vector<Node> m_nodes {};
+  std::vector<std::size_t> m_primitiveIndices {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/BoundingVolumeHierarchy.inl"
+
+#endif // RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
@@ -0,0 +1,135 @@
+#include <utility>
+
+namespace Raz {
+
+template <typename HitFuncT>
+bool BoundingVolumeHierarchy::query(const Ray& ray, float& maxDistance, HitFuncT&& hitPrimitive) const {
+  float rootHitDist {};
+
+  if (m_nodes.empty() || !intersectsNode(m_nodes.front(), ray, maxDistance, rootHitDist))
+    return false;
+
+  // Each node is stacked along with its hit distance, so that it can be skipped if a closer hit has been found meanwhile
+  std::pair<std::size_t, float> nodeStack[MaxDepth * 2];
+  std::size_t stackSize = 0;
+
+  nodeStack[stackSize++] = std::make_pair(0, rootHitDist);
+
+  bool hasHit = false;
+
+  while (stackSize > 0) {
+    const std::pair<std::size_t, float> stackedNode = nodeStack[--stackSize];
+
+    if (stackedNode.second >= maxDistance)
+      continue;
+
+    const Node& node = m_nodes[stackedNode.first];
+
+    if (node.primitiveCount > 0) {
+      for (std::size_t primIndex = node.index; primIndex < node.index + node.primitiveCount; ++primIndex)
+        hasHit = hitPrimitive(m_primitiveIndices[primIndex], maxDistance) || hasHit;
+
+      continue;
+    }
+
+    const std::size_t firstChildIndex  = stackedNode.first + 1;
+    const std::size_t secondChildIndex = node.index;
+
+    float firstHitDist {}, secondHitDist {};
+    const bool hitsFirstChild  = intersectsNode(m_nodes[firstChildIndex], ray, maxDistance, firstHitDist);
+    const bool hitsSecondChild = intersectsNode(m_nodes[secondChildIndex], ray, maxDistance, secondHitDist);
+
+    // The closest child is stacked last, to be traversed first
+    if (hitsFirstChild && hitsSecondChild) {
+      if (firstHitDist < secondHitDist) {
+        nodeStack[stackSize++] = std::make_pair(secondChildIndex, secondHitDist);
+        nodeStack[stackSize++] = std::make_pair(firstChildIndex, firstHitDist);
+      } else {
+        nodeStack[stackSize++] = std::make_pair(firstChildIndex, firstHitDist);
+        nodeStack[stackSize++] = std::make_pair(secondChildIndex, secondHitDist);
+      }
+    } else if (hitsFirstChild) {
+      nodeStack[stackSize++] = std::make_pair(firstChildIndex, firstHitDist);
+    } else if (hitsSecondChild) {
+      nodeStack[stackSize++] = std::make_pair(secondChildIndex, secondHitDist);
+    }
+  }
+
+  return hasHit;
+}
+
+template <std::size_t Size, typename HitFuncT>
+uint32_t BoundingVolumeHierarchy::query(const RayPacket<Size>& packet,
+                                        typename RayPacket<Size>::DistanceArray& maxDistances,
+                                        HitFuncT&& hitPrimitive) const {
+  if (m_nodes.empty())
+    return 0;
+
+  std::size_t nodeStack[MaxDepth * 2];
+  std::size_t stackSize = 0;
+
+  nodeStack[stackSize++] = 0;
+
+  uint32_t hitMask = 0;
+
+  while (stackSize > 0) {
+    const std::size_t nodeIndex = nodeStack[--stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    // Nodes are checked when popped, so that the closest hits found meanwhile are taken into account
+    const uint32_t rayMask = packet.intersects(AABB(node.maxPos, node.minPos), maxDistances);
+
+    if (rayMask == 0)
+      continue;
+
+    if (node.primitiveCount > 0) {
+      for (std::size_t primIndex = node.index; primIndex < node.index + node.primitiveCount; ++primIndex)
+        hitMask |= hitPrimitive(m_primitiveIndices[primIndex], rayMask, maxDistances);
+
+      continue;
+    }
+
+    nodeStack[stackSize++] = node.index;
+    nodeStack[stackSize++] = nodeIndex + 1;
+  }
+
+  return hitMask;
+}
+
+template <typename FuncT>
+void BoundingVolumeHierarchy::query(const AABB& box, FuncT&& overlapPrimitive) const {
+  if (m_nodes.empty())
+    return;
+
+  const Vec3f& boxMinPos = box.getLeftBottomBackPos();
+  const Vec3f& boxMaxPos = box.getRightTopFrontPos();
+
+  std::size_t nodeStack[MaxDepth * 2];
+  std::size_t stackSize = 0;
+
+  nodeStack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const std::size_t nodeIndex = nodeStack[--stackSize];
+    const Node& node = m_nodes[nodeIndex];
+
+    const bool overlaps = (node.minPos[0] <= boxMaxPos[0] && node.maxPos[0] >= boxMinPos[0])
+                       && (node.minPos[1] <= boxMaxPos[1] && node.maxPos[1] >= boxMinPos[1])
+                       && (node.minPos[2] <= boxMaxPos[2] && node.maxPos[2] >= boxMinPos[2]);
+
+    if (!overlaps)
+      continue;
+
+    if (node.primitiveCount > 0) {
+      for (std::size_t primIndex = node.index; primIndex < node.index + node.primitiveCount; ++primIndex)
+        overlapPrimitive(m_primitiveIndices[primIndex]);
+
+      continue;
+    }
+
+    nodeStack[stackSize++] = node.index;
+    nodeStack[stackSize++] = nodeIndex + 1;
+  }
+}
+
+} // namespace Raz
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
@@ -23,6 +25,68 @@ inline bool checkNearEquality(T val1, T val2) {
   return (absDiff <= std::numeric_limits<T>::epsilon() * std::max({ static_cast<T>(1), std::abs(val1), std::abs(val2) }));
 }
 
+/// Converts a single precision floating point value to half precision, rounding it to the nearest representable value.
+/// Values too large to be represented become infinite, & those too small to be represented become 0; NaNs are kept.
+/// \param value Value to be converted.
+/// \return Bits of the half precision value.
+inline uint16_t packHalfFloat(float value) {
+  uint32_t bits {};
+  std::memcpy(&bits, &value, sizeof(float));
+
+  const auto sign        = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+  const uint32_t absBits = bits & 0x7FFFFFFFu;
+
+  // Infinity & NaN, the latter keeping at least one bit of its mantissa
+  if (absBits >= 0x7F800000u)
+    return static_cast<uint16_t>(sign | 0x7C00u | (absBits > 0x7F800000u ? (0x200u | ((absBits >> 13) & 0x3FFu)) : 0u));
+
+  // Values rounding to 65520 or above overflow to infinity
+  if (absBits >= 0x477FF000u)
+    return static_cast<uint16_t>(sign | 0x7C00u);
+
+  // Values below the smallest normal half become denormals, or 0 if they are too small even for them
+  if (absBits < 0x38800000u) {
+    if (absBits < 0x33000000u)
+      return sign;
+
+    const uint32_t mantissa = (absBits & 0x7FFFFFu) | 0x800000u;
+    const uint32_t shift    = 126u - (absBits >> 23);
+    const uint32_t halfBits = mantissa >> shift;
+    const uint32_t rest     = mantissa & ((1u << shift) - 1u);
+    const uint32_t halfway  = 1u << (shift - 1u);
+
+    return static_cast<uint16_t>(sign | (halfBits + (rest > halfway || (rest == halfway && (halfBits & 1u)))));
+  }
+
+  // Rebiasing the exponent, then rounding the mantissa to nearest even; a carry correctly increments the exponent
+  const uint32_t halfBits = ((absBits - 0x38000000u) >> 13);
+  const uint32_t rest     = absBits & 0x1FFFu;
+
+  return static_cast<uint16_t>(sign | (halfBits + (rest > 0x1000u || (rest == 0x1000u && (halfBits & 1u)))));
+}
+
+/// Converts a half precision floating point value to single precision, which is exact.
+/// \param halfBits Bits of the half precision value.
+/// \return Single precision value.
+inline float unpackHalfFloat(uint16_t halfBits) {
+  const uint32_t sign     = static_cast<uint32_t>(halfBits & 0x8000u) << 16;
+  const uint32_t exponent = (halfBits >> 10) & 0x1Fu;
+  const uint32_t mantissa = halfBits & 0x3FFu;
+
+  float value {};
+
+  if (exponent == 0) {
+    value = std::ldexp(static_cast<float>(mantissa), -24);
+  } else if (exponent == 0x1F) {
+    value = (mantissa == 0 ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN());
+  } else {
+    const uint32_t bits = ((exponent + 112) << 23) | (mantissa << 13);
+    std::memcpy(&value, &bits, sizeof(float));
+  }
+
+  return (sign ? -value : value);
+}
+
 } // namespace FloatUtils
 
 } // namespace Raz
@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef RAZ_FRUSTUM_HPP
+#define RAZ_FRUSTUM_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+namespace Raz {
+
+class ThreadPool;
+
+/// Batch of axis-aligned boxes, stored as a structure of arrays to be checked several at once.
+/// Each box is defined by its centroid & half extents, each of their components being stored contiguously.
+/// The arrays are padded with null boxes up to a multiple of the SIMD width, so that they can always be loaded by full packs.
+class BoxArray {
+public:
+  static constexpr std::size_t PackSize = 8;
+
+  BoxArray() = default;
+
+  std::size_t getSize() const { return m_boxCount; }
+  /// Gets the centroids' components along a given axis.
+  /// \param axisIndex Index of the axis to get the components of (0 for X, 1 for Y, 2 for Z).
+  /// \return Contiguous components, padded up to a multiple of the pack size.
+  const std::vector<float>& getCentroids(std::size_t axisIndex) const { return m_centroids[axisIndex]; }
+  /// Gets the half extents' components along a given axis.
+  /// \param axisIndex Index of the axis to get the components of (0 for X, 1 for Y, 2 for Z).
+  /// \return Contiguous components, padded up to a multiple of the pack size.
+  const std::vector<float>& getHalfExtents(std::size_t axisIndex) const { return m_halfExtents[axisIndex]; }
+
+  /// Reserves memory for a given number of boxes.
+  /// \param boxCount Number of boxes to reserve memory for.
+  void reserve(std::size_t boxCount);
+  /// Appends a box to the batch.
+  /// \param box Box to be added.
+  void addBox(const AABB& box);
+  /// Replaces a box of the batch.
+  /// \param boxIndex Index of the box to be replaced.
+  /// \param box New box.
+  void setBox(std::size_t boxIndex, const AABB& box);
+  void clear();
+
+private:
+  std::size_t m_boxCount {};
+  std::array<std::vector<float>, 3> m_centroids {};
+  std::array<std::vector<float>, 3> m_halfExtents {};
+};
+
+/// Volume seen by a camera, delimited by six planes whose normals point inward.
+/// The planes are ordered as left, right, bottom, top, near & far.
+class Frustum {
+public:
+  /// Extracts the frustum's planes from a view-projection matrix, in which case they are expressed in world space.
+  /// If given a model-view-projection matrix instead, the planes are expressed in the model's local space.
+  /// See: Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix (Gil Gribb & Klaus Hartmann), 2001
+  /// \param viewProjMat View-projection matrix to extract the planes from.
+  explicit Frustum(const Mat4f& viewProjMat);
+
+  const std::array<Plane, 6>& getPlanes() const { return m_planes; }
+
+  /// Point containment check.
+  /// \param point Point to be checked.
+  /// \return True if the point is inside the frustum, false otherwise.
+  bool contains(const Vec3f& point) const;
+  /// Frustum-sphere intersection check.
+  /// \param sphere Sphere to be checked.
+  /// \return True if the sphere is at least partially inside the frustum, false otherwise.
+  bool intersects(const Sphere& sphere) const;
+  /// Frustum-AABB intersection check.
+  /// This check is conservative: boxes outside the frustum but near its corners can be considered intersecting.
+  /// \param box Box to be checked.
+  /// \return True if the box is at least partially inside the frustum, false otherwise.
+  bool intersects(const AABB& box) const;
+  /// Checks which boxes of a batch are at least partially inside the frustum, checking them against all the planes several at once.
+  /// The check is the same as for a single box.
+  /// \param boxes Boxes to be checked.
+  /// \param visibilityMasks Bitmasks of the visible boxes, the box i being visible if the bit (i % 32) of the mask (i / 32) is set.
+  ///   They are resized if needed to hold all the boxes.
+  /// \param firstIndex Index of the first box to be checked; must be a multiple of 32, so that ranges do not share masks.
+  /// \param boxCount Number of boxes to be checked from the first one. The range is clamped to the batch's size.
+  void computeVisibility(const BoxArray& boxes, std::vector<uint32_t>& visibilityMasks,
+                         std::size_t firstIndex = 0, std::size_t boxCount = std::numeric_limits<std::size_t>::max()) const;
+  /// Checks which boxes of a batch are at least partially inside the frustum, spreading the work among the threads of a pool.
+  /// \param boxes Boxes to be checked.
+  /// \param visibilityMasks Bitmasks of the visible boxes, the box i being visible if the bit (i % 32) of the mask (i / 32) is set.
+  /// \param threadPool Thread pool to execute the checks with; this function waits for them to be finished.
+  void computeVisibility(const BoxArray& boxes, std::vector<uint32_t>& visibilityMasks, ThreadPool& threadPool) const;
+
+private:
+  std::array<Plane, 6> m_planes;
+};
+
+} // namespace Raz
+
+#endif // RAZ_FRUSTUM_HPP
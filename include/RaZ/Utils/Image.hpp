@@ -71,13 +71,21 @@ enum class ImageColorspace { GRAY = GL_RED,
 class Image {
 public:
   Image() = default;
+  /// Creates an image of the given dimensions, its values all initialized to 0.
+  /// \param width Width of the image.
+  /// \param height Height of the image.
+  /// \param colorspace Colorspace of the image, defining its number of channels.
+  /// \param dataType Type of the image's values, either bytes or floating-point values.
+  Image(unsigned int width, unsigned int height, ImageColorspace colorspace = ImageColorspace::RGB, ImageDataType dataType = ImageDataType::BYTE);
   explicit Image(const std::string& fileName, bool reverse = false) { read(fileName, reverse); }
 
   unsigned int getWidth() const { return m_width; }
   unsigned int getHeight() const { return m_height; }
   ImageColorspace getColorspace() const { return m_colorspace; }
+  uint8_t getChannelCount() const { return m_channelCount; }
   ImageDataType getDataType() const { return m_data->getDataType(); }
   const void* getDataPtr() const { return m_data->getDataPtr(); }
+  void* getDataPtr() { return m_data->getDataPtr(); }
 
   template <typename... Args> static ImagePtr create(Args&&... args) { return std::make_unique<Image>(std::forward<Args>(args)...); }
 
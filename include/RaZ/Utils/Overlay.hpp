@@ -13,6 +13,7 @@
 
 namespace Raz {
 
+class GpuProfiler;
 class Overlay;
 using OverlayPtr = std::unique_ptr<Overlay>;
 
@@ -21,7 +22,8 @@ enum class OverlayElementType { TEXT,
                                 CHECKBOX,
                                 SEPARATOR,
                                 FRAME_TIME,
-                                FPS_COUNTER };
+                                FPS_COUNTER,
+                                GPU_PROFILER };
 
 using OverlayElements = std::vector<std::tuple<OverlayElementType, std::string, std::function<void()>, std::function<void()>>>;
 
@@ -40,6 +42,7 @@ public:
   void addSeparator();
   void addFrameTime(const std::string& formattedText);
   void addFpsCounter(const std::string& formattedText);
+  void addGpuProfiler(const GpuProfiler& profiler);
   void render();
 
   ~Overlay();
@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef RAZ_RANGEALLOCATOR_HPP
+#define RAZ_RANGEALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace Raz {
+
+/// Contiguous range, defined by its offset & size.
+struct Range {
+  std::size_t offset {};
+  std::size_t size {};
+};
+
+/// Move of an allocated range to another offset, as performed by a defragmentation.
+struct RangeRelocation {
+  std::size_t oldOffset {};
+  std::size_t newOffset {};
+  std::size_t size {};
+};
+
+/// Allocator of ranges within a linear space of a given capacity, like a buffer's storage; it only manages offsets, not any memory.
+/// Free ranges are kept sorted by offset & are merged with their neighbours when released. Allocations take the first free range large enough.
+class RangeAllocator {
+public:
+  static constexpr std::size_t InvalidOffset = std::numeric_limits<std::size_t>::max();
+
+  explicit RangeAllocator(std::size_t capacity = 0);
+
+  std::size_t getCapacity() const { return m_capacity; }
+  std::size_t getAllocatedSize() const { return m_allocatedSize; }
+  std::size_t getFreeSize() const { return m_capacity - m_allocatedSize; }
+  std::size_t getAllocationCount() const { return m_allocations.size(); }
+  const std::vector<Range>& getFreeRanges() const { return m_freeRanges; }
+
+  /// Computes the size of the largest free range, which is the largest allocation that can succeed.
+  /// \return Size of the largest free range.
+  std::size_t computeLargestFreeSize() const;
+  /// Allocates a range.
+  /// \param size Size of the range to be allocated; must not be 0.
+  /// \return Offset of the allocated range, or InvalidOffset if no free range is large enough.
+  std::size_t allocate(std::size_t size);
+  /// Releases an allocated range, making it available again.
+  /// \param offset Offset of the range, as returned by allocate().
+  void free(std::size_t offset);
+  /// Increases the capacity, the added space becoming free.
+  /// \param capacity New capacity; must not be lower than the current one.
+  void grow(std::size_t capacity);
+  /// Packs all the allocated ranges at the beginning while keeping their order, leaving a single free range at the end.
+  /// \return Relocations to be applied to the data, ordered by increasing offsets; ranges which have not moved are omitted.
+  ///   Applying them in that order never overwrites a range which has yet to be moved.
+  std::vector<RangeRelocation> defragment();
+
+private:
+  /// Adds a free range, merging it with the adjacent ones.
+  /// \param range Range to be released.
+  void addFreeRange(Range range);
+
+  std::size_t m_capacity {};
+  std::size_t m_allocatedSize {};
+  std::vector<Range> m_freeRanges {};
+  std::map<std::size_t, std::size_t> m_allocations {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_RANGEALLOCATOR_HPP
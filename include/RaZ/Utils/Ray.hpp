@@ -3,49 +3,81 @@
 #ifndef RAZ_RAY_HPP
 #define RAZ_RAY_HPP
 
+#include <limits>
+
 #include "RaZ/Math/Vector.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
 
+class Entity;
+
+/// Information about a ray's intersection, filled when a hit is found.
+/// The entity is only set by world queries, and the submesh & triangle indices only for mesh hits.
+struct RayHit {
+  Vec3f position {};
+  Vec3f normal {};
+  float distance = std::numeric_limits<float>::max();
+  Entity* entity = nullptr;
+  std::size_t submeshIndex  = std::numeric_limits<std::size_t>::max();
+  std::size_t triangleIndex = std::numeric_limits<std::size_t>::max();
+};
+
 /// Ray defined by an origin and a normalized direction.
 class Ray {
 public:
-  Ray(const Vec3f& origin, const Vec3f& direction) : m_origin{ origin }, m_direction{ direction } {}
+  Ray(const Vec3f& origin, const Vec3f& direction)
+    : m_origin{ origin },
+      m_direction{ direction },
+      m_invDirection({ 1.f / direction[0], 1.f / direction[1], 1.f / direction[2] }) {}
 
   const Vec3f& getOrigin() const { return m_origin; }
   const Vec3f& getDirection() const { return m_direction; }
+  /// Gets the inverse of the ray's direction, precomputed on construction to avoid divisions on each AABB test.
+  /// \return Per-component inverse direction.
+  const Vec3f& getInverseDirection() const { return m_invDirection; }
 
   /// Ray-point intersection check.
   /// \param point Point to check if there is an intersection with.
+  /// \param hit Optional hit information, filled if an intersection is found.
   /// \return True if the ray intersects the point, false otherwise.
-  bool intersects(const Vec3f& point) const;
+  bool intersects(const Vec3f& point, RayHit* hit = nullptr) const;
   /// Ray-line intersection check.
+  /// The line being infinitely thin, the ray must pass through it within a floating-point tolerance.
   /// \param line Line to check if there is an intersection with.
+  /// \param hit Optional hit information, filled if an intersection is found.
   /// \return True if the ray intersects the line, false otherwise.
-  bool intersects(const Line& line) const;
+  bool intersects(const Line& line, RayHit* hit = nullptr) const;
   /// Ray-plane intersection check.
   /// \param plane Plane to check if there is an intersection with.
+  /// \param hit Optional hit information, filled if an intersection is found.
   /// \return True if the ray intersects the plane, false otherwise.
-  bool intersects(const Plane& plane) const;
+  bool intersects(const Plane& plane, RayHit* hit = nullptr) const;
   /// Ray-sphere intersection check.
   /// The intersection is checked by calculating a quadratic equation to determine the hits distances.
+  /// If the ray's origin is inside the sphere, the hit is located where the ray exits it.
   /// \param sphere Sphere to check if there is an intersection with.
+  /// \param hit Optional hit information, filled if an intersection is found.
   /// \return True if the ray intersects the sphere, false otherwise.
-  bool intersects(const Sphere& sphere) const;
+  bool intersects(const Sphere& sphere, RayHit* hit = nullptr) const;
   /// Ray-triangle intersection check.
   /// The intersection is checked by calculating the barycentic coordinates at the intersection point.
   /// \param triangle Triangle to check if there is an intersection with.
+  /// \param hit Optional hit information, filled if an intersection is found.
   /// \return True if the ray intersects the triangle, false otherwise.
-  bool intersects(const Triangle& triangle) const;
+  bool intersects(const Triangle& triangle, RayHit* hit = nullptr) const;
   /// Ray-quad intersection check.
+  /// The quad is checked as the two triangles composing it.
   /// \param quad Quad to check if there is an intersection with.
+  /// \param hit Optional hit information, filled if an intersection is found.
   /// \return True if the ray intersects the quad, false otherwise.
-  bool intersects(const Quad& quad) const;
+  bool intersects(const Quad& quad, RayHit* hit = nullptr) const;
   /// Ray-AABB intersection check.
+  /// If the ray's origin is inside the AABB, the hit is located where the ray exits it.
   /// \param aabb AABB to check if there is an intersection with.
+  /// \param hit Optional hit information, filled if an intersection is found.
   /// \return True if the ray intersects the AABB, false otherwise.
-  bool intersects(const AABB& aabb) const;
+  bool intersects(const AABB& aabb, RayHit* hit = nullptr) const;
   /// Computes the projection of a point (closest point) onto the ray.
   /// The projected point is necessarily located between the ray's origin and towards infinity in the ray's direction.
   /// \param point Point to compute the projection from.
@@ -55,6 +87,7 @@ public:
 private:
   Vec3f m_origin {};
   Vec3f m_direction {};
+  Vec3f m_invDirection {};
 };
 
 } // namespace Raz
@@ -0,0 +1,93 @@
+#pragma once
+
+#ifndef RAZ_RAYPACKET_HPP
+#define RAZ_RAYPACKET_HPP
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+
+#include "RaZ/Utils/Ray.hpp"
+
+namespace Raz {
+
+/// Packet of rays laid out as a structure of arrays, allowing to check them simultaneously against a same shape.
+/// Each check returns a bitmask in which the Nth bit is set if the Nth ray hits the shape; unset rays never hit anything.
+/// \tparam Size Number of rays in the packet; 4 rays are processed with SSE, 8 with AVX (or twice SSE if unavailable).
+template <std::size_t Size>
+class RayPacket {
+  static_assert(Size == 4 || Size == 8, "Error: A ray packet can only contain 4 or 8 rays.");
+
+public:
+  using DistanceArray = std::array<float, Size>;
+
+  RayPacket() = default;
+  RayPacket(std::initializer_list<Ray> rays);
+
+  static constexpr std::size_t getSize() { return Size; }
+  /// Gets the mask of the rays that have been set, the Nth bit corresponding to the Nth ray.
+  /// \return Bitmask of the active rays.
+  uint32_t getActiveMask() const { return m_activeMask; }
+
+  /// Sets a ray in the packet, precomputing its inverse direction.
+  /// \param index Index of the ray in the packet.
+  /// \param ray Ray to be set.
+  void setRay(std::size_t index, const Ray& ray);
+  /// Recovers a ray from the packet.
+  /// \param index Index of the ray to recover.
+  /// \return Ray at the given index.
+  Ray recoverRay(std::size_t index) const;
+  /// Ray packet-sphere intersection check.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \return Bitmask of the rays intersecting the sphere.
+  uint32_t intersects(const Sphere& sphere) const;
+  /// Ray packet-sphere intersection check, keeping the closest hits.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \param hitDistances Maximum distances for each ray, replaced by the hit distances of the rays intersecting the sphere.
+  /// \return Bitmask of the rays intersecting the sphere closer than their given distance.
+  uint32_t intersects(const Sphere& sphere, DistanceArray& hitDistances) const;
+  /// Ray packet-triangle intersection check, using a vectorized Möller-Trumbore algorithm.
+  /// \param triangle Triangle to check if there is an intersection with.
+  /// \return Bitmask of the rays intersecting the triangle.
+  uint32_t intersects(const Triangle& triangle) const;
+  /// Ray packet-triangle intersection check, using a vectorized Möller-Trumbore algorithm and keeping the closest hits.
+  /// \param triangle Triangle to check if there is an intersection with.
+  /// \param hitDistances Maximum distances for each ray, replaced by the hit distances of the rays intersecting the triangle.
+  /// \return Bitmask of the rays intersecting the triangle closer than their given distance.
+  uint32_t intersects(const Triangle& triangle, DistanceArray& hitDistances) const;
+  /// Ray packet-AABB intersection check, using a vectorized slab test.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \return Bitmask of the rays intersecting the AABB.
+  uint32_t intersects(const AABB& aabb) const;
+  /// Ray packet-AABB intersection check, using a vectorized slab test.
+  /// This is typically used to traverse bounding volume hierarchies, the given distances being the closest hits found so far.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \param maxDistances Maximum distances for each ray, beyond which the AABB is considered not hit.
+  /// \return Bitmask of the rays entering the AABB before their given distance.
+  uint32_t intersects(const AABB& aabb, const DistanceArray& maxDistances) const;
+
+private:
+  static DistanceArray recoverInfiniteDistances();
+
+  alignas(32) DistanceArray m_originsX {};
+  alignas(32) DistanceArray m_originsY {};
+  alignas(32) DistanceArray m_originsZ {};
+  alignas(32) DistanceArray m_directionsX {};
+  alignas(32) DistanceArray m_directionsY {};
+  alignas(32) DistanceArray m_directionsZ {};
+  alignas(32) DistanceArray m_invDirectionsX {};
+  alignas(32) DistanceArray m_invDirectionsY {};
+  alignas(32) DistanceArray m_invDirectionsZ {};
+  uint32_t m_activeMask = 0;
+};
+
+using RayPacket4 = RayPacket<4>;
+using RayPacket8 = RayPacket<8>;
+
+extern template class RayPacket<4>;
+extern template class RayPacket<8>;
+
+} // namespace Raz
+
+#endif // RAZ_RAYPACKET_HPP
@@ -4,6 +4,7 @@
 #define RAZ_SHAPE_HPP
 
 #include "RaZ/Component.hpp"
+#include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
 
 namespace Raz {
@@ -45,6 +46,10 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
   virtual bool intersects(const AABB& aabb) const = 0;
+  /// Shape-shape intersection check, dispatched to the overload matching both shapes' actual types.
+  /// \param shape Shape to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  virtual bool intersects(const Shape& shape) const = 0;
   /// Computes the projection of a point (closest point) onto the shape.
   /// \param point Point to compute the projection from.
   /// \return Point projected onto the shape.
@@ -52,6 +57,14 @@ public:
   /// Computes the shape's centroid.
   /// \return Computed centroid.
   virtual Vec3f computeCentroid() const = 0;
+  /// Computes the shape's axis-aligned bounding box.
+  /// \return Computed bounding box.
+  virtual AABB computeBoundingBox() const = 0;
+  /// Computes the shape's support point, which is its farthest point in a given direction.
+  /// This allows any convex shape to be checked against any other using the GJK algorithm.
+  /// \param direction Direction in which to find the point; does not need to be normalized.
+  /// \return Computed support point.
+  virtual Vec3f computeSupportPoint(const Vec3f& direction) const = 0;
 };
 
 /// Line segment defined by its two extremities' positions.
@@ -90,6 +103,10 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
   bool intersects(const AABB& aabb) const override;
+  /// Line-shape intersection check, dispatched to the overload matching the given shape's actual type.
+  /// \param shape Shape to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Shape& shape) const override { return shape.intersects(*this); }
   /// Computes the projection of a point (closest point) onto the line.
   /// The projected point is necessarily located on the line.
   /// \param point Point to compute the projection from.
@@ -98,6 +115,13 @@ public:
   /// Computes the line's centroid, which is the point lying directly between the two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_beginPos + m_endPos) / 2.f; }
+  /// Computes the line's axis-aligned bounding box.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
+  /// Computes the line's support point, which is its extremity the farthest in a given direction.
+  /// \param direction Direction in which to find the point; does not need to be normalized.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override { return (m_beginPos.dot(direction) >= m_endPos.dot(direction) ? m_beginPos : m_endPos); }
   /// Line length computation.
   /// To be used if actual length is needed; otherwise, prefer computeSquaredLength().
   /// \return Line's length.
@@ -152,6 +176,10 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
   bool intersects(const AABB& aabb) const override;
+  /// Plane-shape intersection check, dispatched to the overload matching the given shape's actual type.
+  /// \param shape Shape to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Shape& shape) const override { return shape.intersects(*this); }
   /// Computes the projection of a point (closest point) onto the plane.
   /// The projected point is necessarily located on the plane.
   /// \param point Point to compute the projection from.
@@ -160,6 +188,14 @@ public:
   /// Computes the plane's centroid, which is the point lying onto the plane at its distance from the center in its normal direction.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_normal * m_distance; }
+  /// Computes the plane's axis-aligned bounding box.
+  /// A plane being infinite, its bounding box is infinite as well.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
+  /// Computes the plane's support point. A plane being infinite, it has none & an exception is always thrown.
+  /// \param direction Direction in which to find the point.
+  /// \return Nothing, an exception being thrown.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
 
 private:
   float m_distance {};
@@ -202,6 +238,10 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
   bool intersects(const AABB& aabb) const override;
+  /// Sphere-shape intersection check, dispatched to the overload matching the given shape's actual type.
+  /// \param shape Shape to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Shape& shape) const override { return shape.intersects(*this); }
   /// Computes the projection of a point (closest point) onto the sphere.
   /// The projected point may be inside the sphere itself or on its surface.
   /// \param point Point to compute the projection from.
@@ -210,6 +250,17 @@ public:
   /// Computes the sphere's centroid, which is its center. Strictly equivalent to getCenterPos().
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return m_centerPos; }
+  /// Computes the sphere's axis-aligned bounding box.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
+  /// Computes the sphere's support point, which is the point of its surface in a given direction from its center.
+  /// \param direction Direction in which to find the point; does not need to be normalized.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
+  /// Computes the sphere enclosing this one once transformed, its radius being scaled by the transformation's largest scale.
+  /// \param transform Transformation matrix to be applied.
+  /// \return Transformed sphere.
+  Sphere computeTransformedSphere(const Mat4f& transform) const;
 
 private:
   Vec3f m_centerPos {};
@@ -254,6 +305,10 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
   bool intersects(const AABB& aabb) const override;
+  /// Triangle-shape intersection check, dispatched to the overload matching the given shape's actual type.
+  /// \param shape Shape to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Shape& shape) const override { return shape.intersects(*this); }
   /// Computes the projection of a point (closest point) onto the triangle.
   /// The projected point is necessarily located on the triangle's surface.
   /// \param point Point to compute the projection from.
@@ -262,6 +317,13 @@ public:
   /// Computes the triangle's centroid, which is the point lying directly between its three points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_firstPos + m_secondPos + m_thirdPos) / 3.f; }
+  /// Computes the triangle's axis-aligned bounding box.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
+  /// Computes the triangle's support point, which is its vertex the farthest in a given direction.
+  /// \param direction Direction in which to find the point; does not need to be normalized.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
   /// Computes the triangle's normal from its points.
   /// \return Computed normal.
   Vec3f computeNormal() const;
@@ -293,7 +355,7 @@ public:
   /// Point containment check.
   /// \param point Point to be checked.
   /// \return True if the point is located on the quad, false otherwise.
-  bool contains(const Vec3f&) const override { throw std::runtime_error("Error: Not implemented yet."); }
+  bool contains(const Vec3f& point) const override { return (computeProjection(point) == point); }
   /// Quad-line intersection check.
   /// \param line Line to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
@@ -318,6 +380,10 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if both shapes intersect each other, false otherwise.
   bool intersects(const AABB& aabb) const override;
+  /// Quad-shape intersection check, dispatched to the overload matching the given shape's actual type.
+  /// \param shape Shape to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Shape& shape) const override { return shape.intersects(*this); }
   /// Computes the projection of a point (closest point) onto the quad.
   /// The projected point is necessarily located on the quad's surface.
   /// \param point Point to compute the projection from.
@@ -326,6 +392,13 @@ public:
   /// Computes the quad's centroid, which is the point lying directly between its four points.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_leftTopPos + m_rightTopPos + m_rightBottomPos + m_leftBottomPos) / 4.f; }
+  /// Computes the quad's axis-aligned bounding box.
+  /// \return Computed bounding box.
+  AABB computeBoundingBox() const override;
+  /// Computes the quad's support point, which is its corner the farthest in a given direction.
+  /// \param direction Direction in which to find the point; does not need to be normalized.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
 
 private:
   Vec3f m_leftTopPos {};
@@ -397,6 +470,10 @@ public:
   /// \param aabb AABB to check if there is an intersection with.
   /// \return True if both AABBs intersect each other, false otherwise.
   bool intersects(const AABB& aabb) const override;
+  /// AABB-shape intersection check, dispatched to the overload matching the given shape's actual type.
+  /// \param shape Shape to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Shape& shape) const override { return shape.intersects(*this); }
   /// Computes the projection of a point (closest point) onto the AABB.
   /// The projected point may be inside the AABB itself or on its surface.
   /// \param point Point to compute the projection from.
@@ -405,6 +482,13 @@ public:
   /// Computes the AABB's centroid, which is the point lying directly between its two extremities.
   /// \return Computed centroid.
   Vec3f computeCentroid() const override { return (m_rightTopFrontPos + m_leftBottomBackPos) / 2.f; }
+  /// Computes the AABB's bounding box, which is the AABB itself.
+  /// \return Copy of the AABB.
+  AABB computeBoundingBox() const override { return *this; }
+  /// Computes the AABB's support point, which is its corner the farthest in a given direction.
+  /// \param direction Direction in which to find the point; does not need to be normalized.
+  /// \return Computed support point.
+  Vec3f computeSupportPoint(const Vec3f& direction) const override;
   /// Computes the half extents of the box, starting from its centroid.
   ///          _______________________
   ///         /|          ^         /|
@@ -419,6 +503,11 @@ public:
   ///       -----------------------
   /// \return AABB's half extents.
   Vec3f computeHalfExtents() const { return (m_rightTopFrontPos - m_leftBottomBackPos) / 2.f; }
+  /// Computes the box enclosing this one once transformed, without having to transform each of its 8 corners.
+  /// See: Transforming Axis-Aligned Bounding Boxes (James Arvo), Graphics Gems (1990)
+  /// \param transform Transformation matrix to be applied.
+  /// \return Transformed box.
+  AABB computeTransformedBox(const Mat4f& transform) const;
 
 private:
   Vec3f m_rightTopFrontPos {};
@@ -0,0 +1,142 @@
+#pragma once
+
+#ifndef RAZ_SIMD_HPP
+#define RAZ_SIMD_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAZ_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+#if defined(__AVX__)
+#define RAZ_SIMD_AVX
+#include <immintrin.h>
+#endif
+
+namespace Raz {
+
+namespace Simd {
+
+/// Pack of 4 single-precision floating-point values, processed at once using SSE instructions when available.
+/// Comparisons return masks, whose lanes have all their bits set if the comparison succeeded and cleared otherwise.
+class Float4 {
+public:
+  static constexpr std::size_t Size = 4;
+
+  Float4() = default;
+  explicit Float4(float value);
+  Float4(float val1, float val2, float val3, float val4);
+
+  /// Loads 4 contiguous values; the given pointer does not need to be aligned.
+  /// \param values Values to be loaded.
+  /// \return Pack containing the loaded values.
+  static Float4 load(const float* values);
+  /// Stores the pack's values into 4 contiguous values; the given pointer does not need to be aligned.
+  /// \param values Memory to store the values into.
+  void store(float* values) const;
+  /// Selects lanes from the first pack when the mask's corresponding lane is set, from the second one otherwise.
+  /// \param mask Mask selecting the values.
+  /// \param trueValues Values to be selected for set lanes.
+  /// \param falseValues Values to be selected for cleared lanes.
+  /// \return Pack containing the selected values.
+  static Float4 select(const Float4& mask, const Float4& trueValues, const Float4& falseValues);
+  /// Computes the lane-wise minimum of two packs.
+  static Float4 min(const Float4& pack1, const Float4& pack2);
+  /// Computes the lane-wise maximum of two packs.
+  static Float4 max(const Float4& pack1, const Float4& pack2);
+  /// Computes the lane-wise square root of the pack.
+  Float4 sqrt() const;
+  /// Gathers the sign bit of each mask's lane into an integer, the first lane being the lowest bit.
+  /// \return Bitmask of the set lanes.
+  uint32_t computeMask() const;
+
+  Float4 operator+(const Float4& pack) const;
+  Float4 operator-(const Float4& pack) const;
+  Float4 operator-() const;
+  Float4 operator*(const Float4& pack) const;
+  Float4 operator/(const Float4& pack) const;
+  Float4 operator&(const Float4& mask) const;
+  Float4 operator|(const Float4& mask) const;
+  Float4 operator<(const Float4& pack) const;
+  Float4 operator<=(const Float4& pack) const;
+  Float4 operator>(const Float4& pack) const;
+  Float4 operator>=(const Float4& pack) const;
+
+private:
+#if defined(RAZ_SIMD_SSE)
+  explicit Float4(__m128 values) : m_values{ values } {}
+
+  __m128 m_values {};
+#else
+  float m_values[4] {};
+#endif
+};
+
+/// Pack of 8 single-precision floating-point values, processed at once using AVX instructions when available.
+/// If AVX is unavailable, it is processed as two 4-value packs.
+class Float8 {
+public:
+  static constexpr std::size_t Size = 8;
+
+  Float8() = default;
+  explicit Float8(float value);
+
+  /// Loads 8 contiguous values; the given pointer does not need to be aligned.
+  /// \param values Values to be loaded.
+  /// \return Pack containing the loaded values.
+  static Float8 load(const float* values);
+  /// Stores the pack's values into 8 contiguous values; the given pointer does not need to be aligned.
+  /// \param values Memory to store the values into.
+  void store(float* values) const;
+  /// Selects lanes from the first pack when the mask's corresponding lane is set, from the second one otherwise.
+  /// \param mask Mask selecting the values.
+  /// \param trueValues Values to be selected for set lanes.
+  /// \param falseValues Values to be selected for cleared lanes.
+  /// \return Pack containing the selected values.
+  static Float8 select(const Float8& mask, const Float8& trueValues, const Float8& falseValues);
+  /// Computes the lane-wise minimum of two packs.
+  static Float8 min(const Float8& pack1, const Float8& pack2);
+  /// Computes the lane-wise maximum of two packs.
+  static Float8 max(const Float8& pack1, const Float8& pack2);
+  /// Computes the lane-wise square root of the pack.
+  Float8 sqrt() const;
+  /// Gathers the sign bit of each mask's lane into an integer, the first lane being the lowest bit.
+  /// \return Bitmask of the set lanes.
+  uint32_t computeMask() const;
+
+  Float8 operator+(const Float8& pack) const;
+  Float8 operator-(const Float8& pack) const;
+  Float8 operator-() const;
+  Float8 operator*(const Float8& pack) const;
+  Float8 operator/(const Float8& pack) const;
+  Float8 operator&(const Float8& mask) const;
+  Float8 operator|(const Float8& mask) const;
+  Float8 operator<(const Float8& pack) const;
+  Float8 operator<=(const Float8& pack) const;
+  Float8 operator>(const Float8& pack) const;
+  Float8 operator>=(const Float8& pack) const;
+
+private:
+#if defined(RAZ_SIMD_AVX)
+  explicit Float8(__m256 values) : m_values{ values } {}
+
+  __m256 m_values {};
+#else
+  Float8(const Float4& lowValues, const Float4& highValues) : m_low{ lowValues }, m_high{ highValues } {}
+
+  Float4 m_low {};
+  Float4 m_high {};
+#endif
+};
+
+} // namespace Simd
+
+} // namespace Raz
+
+#include "RaZ/Utils/Simd.inl"
+
+#endif // RAZ_SIMD_HPP
@@ -0,0 +1,268 @@
+namespace Raz {
+
+namespace Simd {
+
+#if defined(RAZ_SIMD_SSE)
+
+inline Float4::Float4(float value) : m_values{ _mm_set1_ps(value) } {}
+
+inline Float4::Float4(float val1, float val2, float val3, float val4) : m_values{ _mm_setr_ps(val1, val2, val3, val4) } {}
+
+inline Float4 Float4::load(const float* values) { return Float4(_mm_loadu_ps(values)); }
+
+inline void Float4::store(float* values) const { _mm_storeu_ps(values, m_values); }
+
+inline Float4 Float4::select(const Float4& mask, const Float4& trueValues, const Float4& falseValues) {
+  return Float4(_mm_or_ps(_mm_and_ps(mask.m_values, trueValues.m_values), _mm_andnot_ps(mask.m_values, falseValues.m_values)));
+}
+
+inline Float4 Float4::min(const Float4& pack1, const Float4& pack2) { return Float4(_mm_min_ps(pack1.m_values, pack2.m_values)); }
+
+inline Float4 Float4::max(const Float4& pack1, const Float4& pack2) { return Float4(_mm_max_ps(pack1.m_values, pack2.m_values)); }
+
+inline Float4 Float4::sqrt() const { return Float4(_mm_sqrt_ps(m_values)); }
+
+inline uint32_t Float4::computeMask() const { return static_cast<uint32_t>(_mm_movemask_ps(m_values)); }
+
+inline Float4 Float4::operator+(const Float4& pack) const { return Float4(_mm_add_ps(m_values, pack.m_values)); }
+
+inline Float4 Float4::operator-(const Float4& pack) const { return Float4(_mm_sub_ps(m_values, pack.m_values)); }
+
+inline Float4 Float4::operator-() const { return Float4(_mm_sub_ps(_mm_setzero_ps(), m_values)); }
+
+inline Float4 Float4::operator*(const Float4& pack) const { return Float4(_mm_mul_ps(m_values, pack.m_values)); }
+
+inline Float4 Float4::operator/(const Float4& pack) const { return Float4(_mm_div_ps(m_values, pack.m_values)); }
+
+inline Float4 Float4::operator&(const Float4& mask) const { return Float4(_mm_and_ps(m_values, mask.m_values)); }
+
+inline Float4 Float4::operator|(const Float4& mask) const { return Float4(_mm_or_ps(m_values, mask.m_values)); }
+
+inline Float4 Float4::operator<(const Float4& pack) const { return Float4(_mm_cmplt_ps(m_values, pack.m_values)); }
+
+inline Float4 Float4::operator<=(const Float4& pack) const { return Float4(_mm_cmple_ps(m_values, pack.m_values)); }
+
+inline Float4 Float4::operator>(const Float4& pack) const { return Float4(_mm_cmpgt_ps(m_values, pack.m_values)); }
+
+inline Float4 Float4::operator>=(const Float4& pack) const { return Float4(_mm_cmpge_ps(m_values, pack.m_values)); }
+
+#else
+
+namespace Detail {
+
+inline float recoverMaskValue(bool isSet) {
+  const uint32_t bits = (isSet ? 0xFFFFFFFFu : 0u);
+
+  float value {};
+  std::memcpy(&value, &bits, sizeof(float));
+
+  return value;
+}
+
+inline uint32_t recoverBits(float value) {
+  uint32_t bits {};
+  std::memcpy(&bits, &value, sizeof(float));
+
+  return bits;
+}
+
+template <typename FuncT>
+Float4 applyLaneWise(const float* values1, const float* values2, FuncT&& func) {
+  float res[4];
+
+  for (std::size_t i = 0; i < 4; ++i)
+    res[i] = func(values1[i], values2[i]);
+
+  return Float4::load(res);
+}
+
+} // namespace Detail
+
+inline Float4::Float4(float value) : m_values{ value, value, value, value } {}
+
+inline Float4::Float4(float val1, float val2, float val3, float val4) : m_values{ val1, val2, val3, val4 } {}
+
+inline Float4 Float4::load(const float* values) {
+  Float4 pack;
+  std::memcpy(pack.m_values, values, sizeof(pack.m_values));
+
+  return pack;
+}
+
+inline void Float4::store(float* values) const { std::memcpy(values, m_values, sizeof(m_values)); }
+
+inline Float4 Float4::select(const Float4& mask, const Float4& trueValues, const Float4& falseValues) {
+  Float4 pack;
+
+  for (std::size_t i = 0; i < 4; ++i)
+    pack.m_values[i] = (Detail::recoverBits(mask.m_values[i]) ? trueValues.m_values[i] : falseValues.m_values[i]);
+
+  return pack;
+}
+
+inline Float4 Float4::min(const Float4& pack1, const Float4& pack2) {
+  return Detail::applyLaneWise(pack1.m_values, pack2.m_values, [] (float val1, float val2) { return (val1 < val2 ? val1 : val2); });
+}
+
+inline Float4 Float4::max(const Float4& pack1, const Float4& pack2) {
+  return Detail::applyLaneWise(pack1.m_values, pack2.m_values, [] (float val1, float val2) { return (val1 > val2 ? val1 : val2); });
+}
+
+inline Float4 Float4::sqrt() const {
+  return Float4(std::sqrt(m_values[0]), std::sqrt(m_values[1]), std::sqrt(m_values[2]), std::sqrt(m_values[3]));
+}
+
+inline uint32_t Float4::computeMask() const {
+  uint32_t mask = 0;
+
+  for (std::size_t i = 0; i < 4; ++i)
+    mask |= ((Detail::recoverBits(m_values[i]) >> 31u) << i);
+
+  return mask;
+}
+
+inline Float4 Float4::operator+(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return val1 + val2; });
+}
+
+inline Float4 Float4::operator-(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return val1 - val2; });
+}
+
+inline Float4 Float4::operator-() const { return Float4(-m_values[0], -m_values[1], -m_values[2], -m_values[3]); }
+
+inline Float4 Float4::operator*(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return val1 * val2; });
+}
+
+inline Float4 Float4::operator/(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return val1 / val2; });
+}
+
+inline Float4 Float4::operator&(const Float4& mask) const {
+  return Detail::applyLaneWise(m_values, mask.m_values, [] (float val1, float val2) {
+    return Detail::recoverMaskValue(Detail::recoverBits(val1) != 0 && Detail::recoverBits(val2) != 0);
+  });
+}
+
+inline Float4 Float4::operator|(const Float4& mask) const {
+  return Detail::applyLaneWise(m_values, mask.m_values, [] (float val1, float val2) {
+    return Detail::recoverMaskValue(Detail::recoverBits(val1) != 0 || Detail::recoverBits(val2) != 0);
+  });
+}
+
+inline Float4 Float4::operator<(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return Detail::recoverMaskValue(val1 < val2); });
+}
+
+inline Float4 Float4::operator<=(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return Detail::recoverMaskValue(val1 <= val2); });
+}
+
+inline Float4 Float4::operator>(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return Detail::recoverMaskValue(val1 > val2); });
+}
+
+inline Float4 Float4::operator>=(const Float4& pack) const {
+  return Detail::applyLaneWise(m_values, pack.m_values, [] (float val1, float val2) { return Detail::recoverMaskValue(val1 >= val2); });
+}
+
+#endif
+
+#if defined(RAZ_SIMD_AVX)
+
+inline Float8::Float8(float value) : m_values{ _mm256_set1_ps(value) } {}
+
+inline Float8 Float8::load(const float* values) { return Float8(_mm256_loadu_ps(values)); }
+
+inline void Float8::store(float* values) const { _mm256_storeu_ps(values, m_values); }
+
+inline Float8 Float8::select(const Float8& mask, const Float8& trueValues, const Float8& falseValues) {
+  return Float8(_mm256_blendv_ps(falseValues.m_values, trueValues.m_values, mask.m_values));
+}
+
+inline Float8 Float8::min(const Float8& pack1, const Float8& pack2) { return Float8(_mm256_min_ps(pack1.m_values, pack2.m_values)); }
+
+inline Float8 Float8::max(const Float8& pack1, const Float8& pack2) { return Float8(_mm256_max_ps(pack1.m_values, pack2.m_values)); }
+
+inline Float8 Float8::sqrt() const { return Float8(_mm256_sqrt_ps(m_values)); }
+
+inline uint32_t Float8::computeMask() const { return static_cast<uint32_t>(_mm256_movemask_ps(m_values)); }
+
+inline Float8 Float8::operator+(const Float8& pack) const { return Float8(_mm256_add_ps(m_values, pack.m_values)); }
+
+inline Float8 Float8::operator-(const Float8& pack) const { return Float8(_mm256_sub_ps(m_values, pack.m_values)); }
+
+inline Float8 Float8::operator-() const { return Float8(_mm256_sub_ps(_mm256_setzero_ps(), m_values)); }
+
+inline Float8 Float8::operator*(const Float8& pack) const { return Float8(_mm256_mul_ps(m_values, pack.m_values)); }
+
+inline Float8 Float8::operator/(const Float8& pack) const { return Float8(_mm256_div_ps(m_values, pack.m_values)); }
+
+inline Float8 Float8::operator&(const Float8& mask) const { return Float8(_mm256_and_ps(m_values, mask.m_values)); }
+
+inline Float8 Float8::operator|(const Float8& mask) const { return Float8(_mm256_or_ps(m_values, mask.m_values)); }
+
+inline Float8 Float8::operator<(const Float8& pack) const { return Float8(_mm256_cmp_ps(m_values, pack.m_values, _CMP_LT_OQ)); }
+
+inline Float8 Float8::operator<=(const Float8& pack) const { return Float8(_mm256_cmp_ps(m_values, pack.m_values, _CMP_LE_OQ)); }
+
+inline Float8 Float8::operator>(const Float8& pack) const { return Float8(_mm256_cmp_ps(m_values, pack.m_values, _CMP_GT_OQ)); }
+
+inline Float8 Float8::operator>=(const Float8& pack) const { return Float8(_mm256_cmp_ps(m_values, pack.m_values, _CMP_GE_OQ)); }
+
+#else
+
+inline Float8::Float8(float value) : m_low(value), m_high(value) {}
+
+inline Float8 Float8::load(const float* values) { return Float8(Float4::load(values), Float4::load(values + 4)); }
+
+inline void Float8::store(float* values) const {
+  m_low.store(values);
+  m_high.store(values + 4);
+}
+
+inline Float8 Float8::select(const Float8& mask, const Float8& trueValues, const Float8& falseValues) {
+  return Float8(Float4::select(mask.m_low, trueValues.m_low, falseValues.m_low),
+                Float4::select(mask.m_high, trueValues.m_high, falseValues.m_high));
+}
+
+inline Float8 Float8::min(const Float8& pack1, const Float8& pack2) {
+  return Float8(Float4::min(pack1.m_low, pack2.m_low), Float4::min(pack1.m_high, pack2.m_high));
+}
+
+inline Float8 Float8::max(const Float8& pack1, const Float8& pack2) {
+  return Float8(Float4::max(pack1.m_low, pack2.m_low), Float4::max(pack1.m_high, pack2.m_high));
+}
+
+inline Float8 Float8::sqrt() const { return Float8(m_low.sqrt(), m_high.sqrt()); }
+
+inline uint32_t Float8::computeMask() const { return (m_low.computeMask() | (m_high.computeMask() << 4u)); }
+
+inline Float8 Float8::operator+(const Float8& pack) const { return Float8(m_low + pack.m_low, m_high + pack.m_high); }
+
+inline Float8 Float8::operator-(const Float8& pack) const { return Float8(m_low - pack.m_low, m_high - pack.m_high); }
+
+inline Float8 Float8::operator-() const { return Float8(-m_low, -m_high); }
+
+inline Float8 Float8::operator*(const Float8& pack) const { return Float8(m_low * pack.m_low, m_high * pack.m_high); }
+
+inline Float8 Float8::operator/(const Float8& pack) const { return Float8(m_low / pack.m_low, m_high / pack.m_high); }
+
+inline Float8 Float8::operator&(const Float8& mask) const { return Float8(m_low & mask.m_low, m_high & mask.m_high); }
+
+inline Float8 Float8::operator|(const Float8& mask) const { return Float8(m_low | mask.m_low, m_high | mask.m_high); }
+
+inline Float8 Float8::operator<(const Float8& pack) const { return Float8(m_low < pack.m_low, m_high < pack.m_high); }
+
+inline Float8 Float8::operator<=(const Float8& pack) const { return Float8(m_low <= pack.m_low, m_high <= pack.m_high); }
+
+inline Float8 Float8::operator>(const Float8& pack) const { return Float8(m_low > pack.m_low, m_high > pack.m_high); }
+
+inline Float8 Float8::operator>=(const Float8& pack) const { return Float8(m_low >= pack.m_low, m_high >= pack.m_high); }
+
+#endif
+
+} // namespace Simd
+
+} // namespace Raz
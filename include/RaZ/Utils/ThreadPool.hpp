@@ -0,0 +1,51 @@
+#pragma once
+
+#ifndef RAZ_THREADPOOL_HPP
+#define RAZ_THREADPOOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Raz {
+
+/// Pool of threads executing the tasks given to it, allowing to spread work without creating threads each time.
+class ThreadPool {
+public:
+  /// Creates the pool & starts its threads.
+  /// \param threadCount Number of threads to be created; if 0, as many threads as the system can run concurrently are created.
+  explicit ThreadPool(std::size_t threadCount = 0);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+
+  std::size_t getThreadCount() const { return m_threads.size(); }
+
+  /// Adds a task to be executed by the first available thread.
+  /// \param task Task to be executed.
+  void addTask(std::function<void()> task);
+  /// Waits for all the tasks added so far to be finished.
+  void wait();
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  /// Waits for the remaining tasks to be finished, then stops the threads.
+  ~ThreadPool();
+
+private:
+  std::vector<std::thread> m_threads {};
+  std::queue<std::function<void()>> m_tasks {};
+  std::size_t m_runningTaskCount = 0;
+  bool m_shouldStop = false;
+
+  std::mutex m_mutex {};
+  std::condition_variable m_taskCondition {};
+  std::condition_variable m_finishCondition {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_THREADPOOL_HPP
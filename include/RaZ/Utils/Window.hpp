@@ -3,6 +3,7 @@
 #ifndef RAZ_WINDOW_HPP
 #define RAZ_WINDOW_HPP
 
+#include <array>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -35,10 +36,20 @@ using InputCallbacks       = std::tuple<KeyboardCallbacks, MouseButtonCallbacks,
 /// Graphical window to render the scenes on, with input custom actions.
 class Window {
 public:
-  Window(unsigned int width, unsigned int height, const std::string& title = "", uint8_t AASampleCount = 1);
+  /// Creates a window along with its OpenGL context.
+  /// \param width Width of the window.
+  /// \param height Height of the window.
+  /// \param title Title of the window.
+  /// \param AASampleCount Number of antialiasing samples.
+  /// \param isHeadless True to hide the window & render into an offscreen framebuffer of the given size instead, false otherwise.
+  Window(unsigned int width, unsigned int height, const std::string& title = "", uint8_t AASampleCount = 1, bool isHeadless = false);
 
   unsigned int getWidth() const { return m_width; }
   unsigned int getHeight() const { return m_height; }
+  bool isHeadless() const { return m_isHeadless; }
+  /// Gets the framebuffer the scene is to be rendered into, which is displayed or copied when running the window.
+  /// \return Index of the offscreen framebuffer if the window is headless, 0 otherwise.
+  GLuint getFramebufferIndex() const { return m_framebufferIndex; }
   const Vec4f& getClearColor() const { return m_clearColor; }
   const InputCallbacks& getCallbacks() const { return m_callbacks; }
   InputCallbacks& getCallbacks() { return m_callbacks; }
@@ -134,10 +145,18 @@ public:
   /// Adds a FPS (frames per second) counter on the overlay.
   /// \param formattedText Text with a formatting placeholder to display the FPS (%.Xf, X being the precision after the comma).
   void addOverlayFpsCounter(const std::string& formattedText);
+  /// Adds the CPU & GPU frame times on the overlay, followed by the GPU time of each scope timed by the profiler.
+  /// \param profiler GPU profiler to display the results of, which must outlive the overlay.
+  void addOverlayGpuProfiler(const GpuProfiler& profiler);
   /// Runs the window, refreshing its state by displaying the rendered scene, drawing the overlay, etc.
   /// \param deltaTime Amount of time elapsed since the last frame.
+  /// \param gpuProfiler Optional GPU profiler whose frame has been begun, timing the overlay & ending the frame before it is displayed.
   /// \return True if the window hasn't been required to close, false otherwise.
-  bool run(float deltaTime);
+  bool run(float deltaTime, GpuProfiler* gpuProfiler = nullptr);
+  /// Reads back the last frame displayed by run(), its first row being the top one.
+  /// For a visible window, the parts of the frame hidden by other windows may be undefined.
+  /// \return RGBA image of the frame.
+  Image captureFrame() const;
   /// Fetches the mouse position onto the window.
   /// \return 2D vector representing the mouse's position relative to the window.
   Vec2f recoverMousePosition() const;
@@ -149,10 +168,19 @@ public:
   ~Window() { close(); }
 
 private:
+  /// Creates the framebuffers a headless window renders into, binding the one to render into.
+  /// \param AASampleCount Number of antialiasing samples of the framebuffer to render into.
+  void createOffscreenFramebuffers(uint8_t AASampleCount);
+
   unsigned int m_width {};
   unsigned int m_height {};
   Vec4f m_clearColor = Vec4f({ 0.15f, 0.15f, 0.15f, 1.f });
   GLFWwindow* m_window {};
+  bool m_isHeadless {};
+  // A headless window renders into the back framebuffer, which is copied (& resolved if multisampled) into the front one on each run
+  GLuint m_framebufferIndex {};
+  GLuint m_frontFramebufferIndex {};
+  std::array<GLuint, 3> m_renderbufferIndices {};
   InputCallbacks m_callbacks {};
   OverlayPtr m_overlay {};
 };
@@ -3,8 +3,12 @@
 #ifndef RAZ_WORLD_HPP
 #define RAZ_WORLD_HPP
 
+#include <limits>
+
 #include "RaZ/Entity.hpp"
 #include "RaZ/System.hpp"
+#include "RaZ/Utils/BoundingVolumeHierarchy.hpp"
+#include "RaZ/Utils/Ray.hpp"
 
 namespace Raz {
 
@@ -54,14 +58,43 @@ public:
   bool update(float deltaTime);
   /// Refreshes the world, reorganizing its entities to optimize caching by moving the active entities in front.
   void refresh();
+  /// Casts a ray into the world, finding the closest entity hit.
+  /// Entities are checked against their shapes, considered in world space, and their mesh, transformed by their Transform if any.
+  /// The entities are found through a spatial index, which is updated on the first query following each world update.
+  /// \param ray Ray to be cast.
+  /// \param hit Hit information, filled with the closest hit if an entity has been hit.
+  /// \param maxDistance Distance beyond which entities are ignored.
+  /// \param componentMask Components that the entities must all have to be checked. If empty, every entity is.
+  /// \return True if an entity has been hit, false otherwise.
+  bool raycast(const Ray& ray, RayHit& hit,
+               float maxDistance = std::numeric_limits<float>::max(),
+               const Bitset& componentMask = Bitset());
+  /// Casts a ray into the world, finding all the entities hit.
+  /// \param ray Ray to be cast.
+  /// \param maxDistance Distance beyond which entities are ignored.
+  /// \param componentMask Components that the entities must all have to be checked. If empty, every entity is.
+  /// \return Closest hit of each entity, sorted from the closest to the farthest.
+  std::vector<RayHit> raycastAll(const Ray& ray,
+                                 float maxDistance = std::numeric_limits<float>::max(),
+                                 const Bitset& componentMask = Bitset());
+
+  /// Updates the spatial index over the entities, rebuilding it if they have changed or refitting it otherwise.
+  /// This is done automatically by the first raycast following each update; it must however be called beforehand if raycasting from several threads.
+  void updateSpatialIndex();
 
 private:
+
   std::vector<SystemPtr> m_systems {};
   Bitset m_activeSystems {};
 
   std::vector<EntityPtr> m_entities {};
   std::size_t m_activeEntityCount = 0;
   std::size_t m_maxEntityIndex = 0;
+
+  BoundingVolumeHierarchy m_spatialIndex {};
+  std::vector<Entity*> m_indexedEntities {};
+  std::vector<Entity*> m_unboundedEntities {};
+  bool m_isSpatialIndexOutdated = true;
 };
 
 } // namespace Raz
@@ -1,7 +1,5 @@
 #version 330 core
 
-#define MAX_LIGHT_COUNT 10
-
 struct Light {
   vec4 position;
   vec3 direction;
@@ -11,12 +9,6 @@ struct Light {
 };
 
 struct Material {
-  vec3 ambient;
-  vec3 diffuse;
-  vec3 specular;
-  vec3 emissive;
-  float transparency;
-
   sampler2D ambientMap;
   sampler2D diffuseMap;
   sampler2D specularMap;
@@ -31,20 +23,65 @@ in MeshInfo {
   mat3 vertTBNMatrix;
 } fragMeshInfo;
 
-uniform uint uniLightCount;
-uniform Light uniLights[MAX_LIGHT_COUNT];
+uniform samplerBuffer uniLightData;
+uniform usamplerBuffer uniClusterRanges;
+uniform usamplerBuffer uniLightIndices;
+
+uniform uint uniGlobalLightCount;
+uniform vec4 uniClusterScreenParams; // Tiles per pixel (XY) & tile counts (ZW)
+uniform vec4 uniClusterDepthParams;  // Near plane (X), slice scale (Y) & slice count (Z)
 
 uniform vec3 uniCameraPos;
 
 uniform Material uniMaterial;
 
+layout (std140) uniform uboMaterialParams {
+  vec3 ambient;
+  vec3 diffuse;
+  vec3 specular;
+  vec3 emissive;
+  float transparency;
+} uniMaterialParams;
+
 layout (location = 0) out vec4 fragColor;
 layout (location = 1) out vec3 bufferNormal;
 
+Light fetchLight(uint lightIndex) {
+  int texelIndex = int(lightIndex) * 3;
+
+  vec4 directionEnergy = texelFetch(uniLightData, texelIndex + 1);
+  vec4 colorAngle      = texelFetch(uniLightData, texelIndex + 2);
+
+  Light light;
+  light.position  = texelFetch(uniLightData, texelIndex);
+  light.direction = directionEnergy.xyz;
+  light.energy    = directionEnergy.w;
+  light.color     = colorAngle.rgb;
+  light.angle     = colorAngle.a;
+
+  return light;
+}
+
+// Recovers the offset & count of the lights affecting the fragment's cluster, not counting the global ones
+uvec2 recoverClusterRange() {
+  uvec2 tileCounts = uvec2(uniClusterScreenParams.zw);
+  uvec2 tile       = min(uvec2(gl_FragCoord.xy * uniClusterScreenParams.xy), tileCounts - 1u);
+
+  float depth = 1.0 / gl_FragCoord.w;
+  uint slice  = uint(clamp(log(depth / uniClusterDepthParams.x) * uniClusterDepthParams.y, 0.0, uniClusterDepthParams.z - 1.0));
+
+  return texelFetch(uniClusterRanges, int((slice * tileCounts.y + tile.y) * tileCounts.x + tile.x)).xy;
+}
+
+uint recoverLightIndex(uint lightEntry, uvec2 clusterRange) {
+  uint entryIndex = (lightEntry < uniGlobalLightCount ? lightEntry : clusterRange.x + (lightEntry - uniGlobalLightCount));
+  return texelFetch(uniLightIndices, int(entryIndex)).r;
+}
+
 void main() {
   vec3 normal     = fragMeshInfo.vertTBNMatrix[2];
-  vec3 color      = texture(uniMaterial.diffuseMap, fragMeshInfo.vertTexcoords).rgb * uniMaterial.diffuse;
-  vec3 specFactor = texture(uniMaterial.specularMap, fragMeshInfo.vertTexcoords).r * uniMaterial.specular;
+  vec3 color      = texture(uniMaterial.diffuseMap, fragMeshInfo.vertTexcoords).rgb * uniMaterialParams.diffuse;
+  vec3 specFactor = texture(uniMaterial.specularMap, fragMeshInfo.vertTexcoords).r * uniMaterialParams.specular;
 
   vec3 ambient  = color * 0.05;
   vec3 diffuse  = vec3(0.0);
@@ -52,18 +89,23 @@ void main() {
 
   vec3 viewDir = normalize(uniCameraPos - fragMeshInfo.vertPosition);
 
-  for (uint lightIndex = 0u; lightIndex < uniLightCount; ++lightIndex) {
+  uvec2 clusterRange = recoverClusterRange();
+  uint lightCount    = uniGlobalLightCount + clusterRange.y;
+
+  for (uint lightEntry = 0u; lightEntry < lightCount; ++lightEntry) {
+    Light light = fetchLight(recoverLightIndex(lightEntry, clusterRange));
+
     // Diffuse
     vec3 fullLightDir;
-    float attenuation = uniLights[lightIndex].energy;
+    float attenuation = light.energy;
 
-    if (uniLights[lightIndex].position.w != 0.0) {
-      fullLightDir = uniLights[lightIndex].position.xyz - fragMeshInfo.vertPosition;
+    if (light.position.w != 0.0) {
+      fullLightDir = light.position.xyz - fragMeshInfo.vertPosition;
 
       float sqrDist = dot(fullLightDir, fullLightDir);
       attenuation  /= sqrDist;
     } else {
-      fullLightDir = -uniLights[lightIndex].direction;
+      fullLightDir = -light.direction;
     }
 
     vec3 lightDir = normalize(fullLightDir);
@@ -72,10 +114,10 @@ void main() {
 
     // Specular
     vec3 halfDir = normalize(lightDir + viewDir);
-    specular    += uniLights[lightIndex].color * pow(max(dot(halfDir, normal), 0.0), 32.0) * specFactor * attenuation;
+    specular    += light.color * pow(max(dot(halfDir, normal), 0.0), 32.0) * specFactor * attenuation;
   }
 
-  vec3 emissive = texture(uniMaterial.emissiveMap, fragMeshInfo.vertTexcoords).rgb * uniMaterial.emissive;
+  vec3 emissive = texture(uniMaterial.emissiveMap, fragMeshInfo.vertTexcoords).rgb * uniMaterialParams.emissive;
 
   fragColor = vec4(ambient + diffuse + specular + emissive, specFactor);
 
@@ -1,6 +1,5 @@
 #version 330 core
 
-#define MAX_LIGHT_COUNT 10
 #define PI 3.1415926535897932384626433832795
 
 struct Light {
@@ -12,10 +11,6 @@ struct Light {
 };
 
 struct Material {
-  vec3 baseColor;
-  float metallicFactor;
-  float roughnessFactor;
-
   sampler2D albedoMap;
   sampler2D normalMap;
   sampler2D metallicMap;
@@ -29,13 +24,24 @@ in MeshInfo {
   mat3 vertTBNMatrix;
 } fragMeshInfo;
 
-uniform uint uniLightCount;
-uniform Light uniLights[MAX_LIGHT_COUNT];
+uniform samplerBuffer uniLightData;
+uniform usamplerBuffer uniClusterRanges;
+uniform usamplerBuffer uniLightIndices;
+
+uniform uint uniGlobalLightCount;
+uniform vec4 uniClusterScreenParams; // Tiles per pixel (XY) & tile counts (ZW)
+uniform vec4 uniClusterDepthParams;  // Near plane (X), slice scale (Y) & slice count (Z)
 
 uniform vec3 uniCameraPos;
 
 uniform Material uniMaterial;
 
+layout (std140) uniform uboMaterialParams {
+  vec3 baseColor;
+  float metallicFactor;
+  float roughnessFactor;
+} uniMaterialParams;
+
 layout (location = 0) out vec4 fragColor;
 layout (location = 1) out vec3 bufferNormal;
 
@@ -82,11 +88,43 @@ float computeGeometry(vec3 normal, vec3 viewDir, vec3 lightDir, float roughness)
   return viewGeom * lightGeom;
 }
 
+Light fetchLight(uint lightIndex) {
+  int texelIndex = int(lightIndex) * 3;
+
+  vec4 directionEnergy = texelFetch(uniLightData, texelIndex + 1);
+  vec4 colorAngle      = texelFetch(uniLightData, texelIndex + 2);
+
+  Light light;
+  light.position  = texelFetch(uniLightData, texelIndex);
+  light.direction = directionEnergy.xyz;
+  light.energy    = directionEnergy.w;
+  light.color     = colorAngle.rgb;
+  light.angle     = colorAngle.a;
+
+  return light;
+}
+
+// Recovers the offset & count of the lights affecting the fragment's cluster, not counting the global ones
+uvec2 recoverClusterRange() {
+  uvec2 tileCounts = uvec2(uniClusterScreenParams.zw);
+  uvec2 tile       = min(uvec2(gl_FragCoord.xy * uniClusterScreenParams.xy), tileCounts - 1u);
+
+  float depth = 1.0 / gl_FragCoord.w;
+  uint slice  = uint(clamp(log(depth / uniClusterDepthParams.x) * uniClusterDepthParams.y, 0.0, uniClusterDepthParams.z - 1.0));
+
+  return texelFetch(uniClusterRanges, int((slice * tileCounts.y + tile.y) * tileCounts.x + tile.x)).xy;
+}
+
+uint recoverLightIndex(uint lightEntry, uvec2 clusterRange) {
+  uint entryIndex = (lightEntry < uniGlobalLightCount ? lightEntry : clusterRange.x + (lightEntry - uniGlobalLightCount));
+  return texelFetch(uniLightIndices, int(entryIndex)).r;
+}
+
 void main() {
   // Gamma correction for albedo (sRGB presumed)
-  vec3 albedo     = pow(texture(uniMaterial.albedoMap, fragMeshInfo.vertTexcoords).rgb, vec3(2.2)) * uniMaterial.baseColor;
-  float metallic  = texture(uniMaterial.metallicMap, fragMeshInfo.vertTexcoords).r * uniMaterial.metallicFactor;
-  float roughness = texture(uniMaterial.roughnessMap, fragMeshInfo.vertTexcoords).r * uniMaterial.roughnessFactor;
+  vec3 albedo     = pow(texture(uniMaterial.albedoMap, fragMeshInfo.vertTexcoords).rgb, vec3(2.2)) * uniMaterialParams.baseColor;
+  float metallic  = texture(uniMaterial.metallicMap, fragMeshInfo.vertTexcoords).r * uniMaterialParams.metallicFactor;
+  float roughness = texture(uniMaterial.roughnessMap, fragMeshInfo.vertTexcoords).r * uniMaterialParams.roughnessFactor;
   float ambOcc    = texture(uniMaterial.ambientOcclusionMap, fragMeshInfo.vertTexcoords).r;
 
   vec3 normal = texture(uniMaterial.normalMap, fragMeshInfo.vertTexcoords).rgb;
@@ -100,22 +138,27 @@ void main() {
 
   vec3 lightRadiance = vec3(0.0);
 
-  for (uint lightIndex = 0u; lightIndex < uniLightCount; ++lightIndex) {
+  uvec2 clusterRange = recoverClusterRange();
+  uint lightCount    = uniGlobalLightCount + clusterRange.y;
+
+  for (uint lightEntry = 0u; lightEntry < lightCount; ++lightEntry) {
+    Light light = fetchLight(recoverLightIndex(lightEntry, clusterRange));
+
     vec3 fullLightDir;
-    float attenuation = uniLights[lightIndex].energy;
+    float attenuation = light.energy;
 
-    if (uniLights[lightIndex].position.w != 0.0) {
-      fullLightDir = uniLights[lightIndex].position.xyz - fragMeshInfo.vertPosition;
+    if (light.position.w != 0.0) {
+      fullLightDir = light.position.xyz - fragMeshInfo.vertPosition;
 
       float sqrDist = dot(fullLightDir, fullLightDir);
       attenuation  /= sqrDist;
     } else {
-      fullLightDir = -uniLights[lightIndex].direction;
+      fullLightDir = -light.direction;
     }
 
     vec3 lightDir = normalize(fullLightDir);
     vec3 halfDir  = normalize(viewDir + lightDir);
-    vec3 radiance = uniLights[lightIndex].color * attenuation;
+    vec3 radiance = light.color * attenuation;
 
     // Normal distrib (D)
     float normalDistrib = computeNormalDistrib(normal, halfDir, roughness);
@@ -0,0 +1,159 @@
+#version 330 core
+
+#define PI 3.1415926535897932384626433832795
+
+struct Light {
+  vec4 position;
+  vec3 direction;
+  vec3 color;
+  float energy;
+  float angle;
+};
+
+struct GBuffer {
+  sampler2D albedoMetallic;
+  sampler2D normalRoughness;
+  sampler2D depth;
+};
+
+layout (std140) uniform uboCameraMatrices {
+  mat4 viewMat;
+  mat4 invViewMat;
+  mat4 projectionMat;
+  mat4 invProjectionMat;
+  mat4 viewProjectionMat;
+  vec3 cameraPos;
+};
+
+uniform samplerBuffer uniLightData;
+uniform uint uniLightIndex;
+uniform vec2 uniInvBufferSize;
+
+uniform GBuffer uniGBuffer;
+
+layout (location = 0) out vec4 fragColor;
+
+// Normal Distribution Function: Trowbridge-Reitz GGX
+float computeNormalDistrib(vec3 normal, vec3 halfVec, float roughness) {
+  float sqrRough  = roughness * roughness;
+  float frthRough = sqrRough * sqrRough;
+
+  float halfVecAngle    = max(dot(halfVec, normal), 0.0);
+  float sqrHalfVecAngle = halfVecAngle * halfVecAngle;
+
+  float divider = (sqrHalfVecAngle * (frthRough - 1.0) + 1.0);
+  divider       = PI * divider * divider;
+
+  return frthRough / max(divider, 0.001);
+}
+
+// Fresnel: Shlick
+vec3 computeFresnel(float cosTheta, vec3 baseReflectivity) {
+  return baseReflectivity + (1.0 - baseReflectivity) * pow(1.0 - cosTheta, 5.0);
+}
+
+// Shlick-Beckmann for Geometry part
+float computeGeomShlickGGX(float angle, float roughness) {
+  float incrRough   = (roughness + 1.0);
+  float roughFactor = (incrRough * incrRough) / 8.0;
+
+  float denom = angle * (1.0 - roughFactor) + roughFactor;
+
+  return angle / denom;
+}
+
+// Geometry: Smith's Shlick GGX
+float computeGeometry(vec3 normal, vec3 viewDir, vec3 lightDir, float roughness) {
+  float viewAngle  = max(dot(viewDir, normal), 0.0);
+  float lightAngle = max(dot(lightDir, normal), 0.0);
+
+  float viewGeom  = computeGeomShlickGGX(viewAngle, roughness);
+  float lightGeom = computeGeomShlickGGX(lightAngle, roughness);
+
+  return viewGeom * lightGeom;
+}
+
+Light fetchLight(uint lightIndex) {
+  int texelIndex = int(lightIndex) * 3;
+
+  vec4 directionEnergy = texelFetch(uniLightData, texelIndex + 1);
+  vec4 colorAngle      = texelFetch(uniLightData, texelIndex + 2);
+
+  Light light;
+  light.position  = texelFetch(uniLightData, texelIndex);
+  light.direction = directionEnergy.xyz;
+  light.energy    = directionEnergy.w;
+  light.color     = colorAngle.rgb;
+  light.angle     = colorAngle.a;
+
+  return light;
+}
+
+vec3 computeWorldPosFromDepth(vec2 texcoords, float depth) {
+  vec4 projPos = vec4(vec3(texcoords, depth) * 2.0 - 1.0, 1.0);
+  vec4 viewPos = invProjectionMat * projPos;
+  viewPos     /= viewPos.w;
+
+  return (invViewMat * viewPos).xyz;
+}
+
+void main() {
+  vec2 texcoords = gl_FragCoord.xy * uniInvBufferSize;
+  float depth    = texture(uniGBuffer.depth, texcoords).r;
+
+  // Nothing has been drawn there
+  if (depth >= 1.0)
+    discard;
+
+  vec4 albedoMetallic  = texture(uniGBuffer.albedoMetallic, texcoords);
+  vec4 normalRoughness = texture(uniGBuffer.normalRoughness, texcoords);
+
+  vec3 albedo     = albedoMetallic.rgb;
+  float metallic  = albedoMetallic.a;
+  vec3 normal     = normalize(normalRoughness.xyz);
+  float roughness = normalRoughness.a;
+
+  vec3 position = computeWorldPosFromDepth(texcoords, depth);
+  vec3 viewDir  = normalize(cameraPos - position);
+
+  // Base Fresnel (F)
+  vec3 baseReflectivity = mix(vec3(0.04), albedo, metallic);
+
+  Light light = fetchLight(uniLightIndex);
+
+  vec3 fullLightDir;
+  float attenuation = light.energy;
+
+  if (light.position.w != 0.0) {
+    fullLightDir = light.position.xyz - position;
+
+    float sqrDist = dot(fullLightDir, fullLightDir);
+    attenuation  /= sqrDist;
+  } else {
+    fullLightDir = -light.direction;
+  }
+
+  vec3 lightDir = normalize(fullLightDir);
+  vec3 halfDir  = normalize(viewDir + lightDir);
+  vec3 radiance = light.color * attenuation;
+
+  // Normal distrib (D)
+  float normalDistrib = computeNormalDistrib(normal, halfDir, roughness);
+
+  // Fresnel (F)
+  vec3 fresnel = computeFresnel(max(dot(halfDir, viewDir), 0.0), baseReflectivity);
+
+  // Geometry (G)
+  float geometry = computeGeometry(normal, viewDir, lightDir, roughness);
+
+  vec3 DFG         = normalDistrib * fresnel * geometry;
+  float lightAngle = max(dot(lightDir, normal), 0.0);
+  float divider    = 4.0 * max(dot(viewDir, normal), 0.0) * lightAngle;
+  vec3 specular    = DFG / max(divider, 0.001);
+
+  vec3 diffuse = vec3(1.0) - fresnel;
+  diffuse     *= 1.0 - metallic;
+
+  // Added to the other lights' contributions through blending
+  fragColor = vec4((diffuse * albedo / PI + specular) * radiance * lightAngle, 0.0);
+}
@@ -0,0 +1,48 @@
+#version 330 core
+
+struct Material {
+  sampler2D albedoMap;
+  sampler2D normalMap;
+  sampler2D metallicMap;
+  sampler2D roughnessMap;
+  sampler2D ambientOcclusionMap;
+};
+
+in MeshInfo {
+  vec3 vertPosition;
+  vec2 vertTexcoords;
+  mat3 vertTBNMatrix;
+} fragMeshInfo;
+
+uniform Material uniMaterial;
+
+layout (std140) uniform uboMaterialParams {
+  vec3 baseColor;
+  float metallicFactor;
+  float roughnessFactor;
+} uniMaterialParams;
+
+layout (location = 0) out vec4 bufferAlbedoMetallic;
+layout (location = 1) out vec4 bufferNormalRoughness;
+layout (location = 2) out float bufferDepth;
+layout (location = 3) out vec4 bufferLight;
+
+void main() {
+  // Gamma correction for albedo (sRGB presumed)
+  vec3 albedo     = pow(texture(uniMaterial.albedoMap, fragMeshInfo.vertTexcoords).rgb, vec3(2.2)) * uniMaterialParams.baseColor;
+  float metallic  = texture(uniMaterial.metallicMap, fragMeshInfo.vertTexcoords).r * uniMaterialParams.metallicFactor;
+  float roughness = texture(uniMaterial.roughnessMap, fragMeshInfo.vertTexcoords).r * uniMaterialParams.roughnessFactor;
+  float ambOcc    = texture(uniMaterial.ambientOcclusionMap, fragMeshInfo.vertTexcoords).r;
+
+  vec3 normal = texture(uniMaterial.normalMap, fragMeshInfo.vertTexcoords).rgb;
+  normal      = normalize(normal * 2.0 - 1.0);
+  normal      = normalize(fragMeshInfo.vertTBNMatrix * normal);
+
+  bufferAlbedoMetallic  = vec4(albedo, metallic);
+  bufferNormalRoughness = vec4(normal, roughness);
+  // The depth attachment cannot be read while it is used to bound the light volumes; it is thus copied
+  bufferDepth           = gl_FragCoord.z;
+
+  // Lights are then added onto the ambient term
+  bufferLight = vec4(vec3(0.03) * albedo * ambOcc, 1.0);
+}
@@ -1,21 +1,14 @@
 #version 330 core
 
-#define MAX_LIGHT_COUNT 10
-
 struct Light {
   vec4 position;
   vec3 direction;
   vec3 color;
+  float energy;
   float angle;
 };
 
 struct Material {
-  vec3 ambient;
-  vec3 diffuse;
-  vec3 specular;
-  vec3 emissive;
-  float transparency;
-
   sampler2D ambientMap;
   sampler2D diffuseMap;
   sampler2D specularMap;
@@ -29,8 +22,13 @@ in MeshInfo {
   mat3 vertTBNMatrix;
 } fragMeshInfo;
 
-uniform uint uniLightCount;
-uniform Light uniLights[MAX_LIGHT_COUNT];
+uniform samplerBuffer uniLightData;
+uniform usamplerBuffer uniClusterRanges;
+uniform usamplerBuffer uniLightIndices;
+
+uniform uint uniGlobalLightCount;
+uniform vec4 uniClusterScreenParams; // Tiles per pixel (XY) & tile counts (ZW)
+uniform vec4 uniClusterDepthParams;  // Near plane (X), slice scale (Y) & slice count (Z)
 
 uniform mat4 uniViewProjMatrix;
 
@@ -39,19 +37,56 @@ uniform Material uniMaterial;
 layout (location = 0) out vec4 fragColor;
 layout (location = 1) out vec3 bufferNormal;
 
+Light fetchLight(uint lightIndex) {
+  int texelIndex = int(lightIndex) * 3;
+
+  vec4 directionEnergy = texelFetch(uniLightData, texelIndex + 1);
+  vec4 colorAngle      = texelFetch(uniLightData, texelIndex + 2);
+
+  Light light;
+  light.position  = texelFetch(uniLightData, texelIndex);
+  light.direction = directionEnergy.xyz;
+  light.energy    = directionEnergy.w;
+  light.color     = colorAngle.rgb;
+  light.angle     = colorAngle.a;
+
+  return light;
+}
+
+// Recovers the offset & count of the lights affecting the fragment's cluster, not counting the global ones
+uvec2 recoverClusterRange() {
+  uvec2 tileCounts = uvec2(uniClusterScreenParams.zw);
+  uvec2 tile       = min(uvec2(gl_FragCoord.xy * uniClusterScreenParams.xy), tileCounts - 1u);
+
+  float depth = 1.0 / gl_FragCoord.w;
+  uint slice  = uint(clamp(log(depth / uniClusterDepthParams.x) * uniClusterDepthParams.y, 0.0, uniClusterDepthParams.z - 1.0));
+
+  return texelFetch(uniClusterRanges, int((slice * tileCounts.y + tile.y) * tileCounts.x + tile.x)).xy;
+}
+
+uint recoverLightIndex(uint lightEntry, uvec2 clusterRange) {
+  uint entryIndex = (lightEntry < uniGlobalLightCount ? lightEntry : clusterRange.x + (lightEntry - uniGlobalLightCount));
+  return texelFetch(uniLightIndices, int(entryIndex)).r;
+}
+
 void main() {
   vec3 normal = fragMeshInfo.vertTBNMatrix[2];
 
   float lightHitAngle = 0.0;
 
-  for (uint lightIndex = 0u; lightIndex < uniLightCount; ++lightIndex) {
-    vec3 lightPos = (uniViewProjMatrix * uniLights[lightIndex].position).xyz;
+  uvec2 clusterRange = recoverClusterRange();
+  uint lightCount    = uniGlobalLightCount + clusterRange.y;
+
+  for (uint lightEntry = 0u; lightEntry < lightCount; ++lightEntry) {
+    Light light = fetchLight(recoverLightIndex(lightEntry, clusterRange));
+
+    vec3 lightPos = (uniViewProjMatrix * light.position).xyz;
     vec3 lightDir;
 
-    if (uniLights[lightIndex].position.w != 0.0) {
+    if (light.position.w != 0.0) {
       lightDir = normalize(lightPos - fragMeshInfo.vertPosition);
     } else {
-      lightDir = normalize(-uniLights[lightIndex].direction);
+      lightDir = normalize(-light.direction);
     }
 
     lightHitAngle = max(lightHitAngle, clamp(dot(lightDir, normal), 0.0, 1.0));
@@ -3,10 +3,16 @@
 layout (location = 0) in vec3 vertPosition;
 layout (location = 1) in vec2 vertTexcoords;
 layout (location = 2) in vec3 vertNormal;
-layout (location = 3) in vec3 vertTangent;
+// The tangent's W component holds its handedness; it is 1 if the vertices store no handedness
+layout (location = 3) in vec4 vertTangent;
+// Per-instance transformation, combined with the model matrix; it is an identity matrix for non-instanced draws
+layout (location = 4) in mat4 vertInstanceMatrix;
 
 uniform mat4 uniModelMatrix;
 uniform mat4 uniMvpMatrix;
+// Restores quantized positions, which are read normalized in [0; 1]; they are left unchanged otherwise
+uniform vec3 uniPositionOffset = vec3(0.0);
+uniform vec3 uniPositionScale  = vec3(1.0);
 
 out MeshInfo {
   vec3 vertPosition;
@@ -15,15 +21,18 @@ out MeshInfo {
 } fragMeshInfo;
 
 void main() {
-  fragMeshInfo.vertPosition  = (uniModelMatrix * vec4(vertPosition, 1.0)).xyz;
+  mat4 modelMatrix = uniModelMatrix * vertInstanceMatrix;
+  vec3 position    = uniPositionOffset + vertPosition * uniPositionScale;
+
+  fragMeshInfo.vertPosition  = (modelMatrix * vec4(position, 1.0)).xyz;
   fragMeshInfo.vertTexcoords = vertTexcoords;
 
-  mat3 modelMat = mat3(uniModelMatrix);
+  mat3 modelMat = mat3(modelMatrix);
 
-  vec3 tangent   = normalize(modelMat * vertTangent);
+  vec3 tangent   = normalize(modelMat * vertTangent.xyz);
   vec3 normal    = normalize(modelMat * vertNormal);
-  vec3 bitangent = cross(normal, tangent);
+  vec3 bitangent = cross(normal, tangent) * (vertTangent.w < 0.0 ? -1.0 : 1.0);
   fragMeshInfo.vertTBNMatrix = mat3(tangent, bitangent, normal);
 
-  gl_Position = uniMvpMatrix * vec4(vertPosition, 1.0);
+  gl_Position = uniMvpMatrix * vertInstanceMatrix * vec4(position, 1.0);
 }
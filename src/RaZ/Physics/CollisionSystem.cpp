@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <cmath>
+
+#include "RaZ/Physics/CollisionSystem.hpp"
+
+namespace Raz {
+
+namespace {
+
+template <typename ShapeT, std::size_t MaxShapeCount>
+void addShape(const Entity& entity, std::array<const Shape*, MaxShapeCount>& shapes, std::size_t& shapeCount) {
+  if (entity.hasComponent<ShapeT>())
+    shapes[shapeCount++] = &entity.getComponent<ShapeT>();
+}
+
+} // namespace
+
+CollisionSystem::CollisionSystem() {
+  m_acceptedComponents.setBit(Component::getId<Line>());
+  m_acceptedComponents.setBit(Component::getId<Plane>());
+  m_acceptedComponents.setBit(Component::getId<Sphere>());
+  m_acceptedComponents.setBit(Component::getId<Triangle>());
+  m_acceptedComponents.setBit(Component::getId<Quad>());
+  m_acceptedComponents.setBit(Component::getId<AABB>());
+}
+
+void CollisionSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+
+  // The new proxy will be moved to its place by the next sort
+  m_proxies.emplace_back();
+  m_proxies.back().entity = entity.get();
+  m_isSortNeeded = true;
+}
+
+void CollisionSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  // Erasing the proxy keeps the remaining ones sorted
+  m_proxies.erase(std::remove_if(m_proxies.begin(), m_proxies.end(), [&entity] (const Proxy& proxy) {
+    return (proxy.entity == entity.get());
+  }), m_proxies.end());
+}
+
+bool CollisionSystem::update(float) {
+  updateProxies();
+  findPairs();
+
+  return true;
+}
+
+bool CollisionSystem::intersects(const Proxy& proxy1, const Proxy& proxy2) {
+  for (std::size_t firstIndex = 0; firstIndex < proxy1.shapeCount; ++firstIndex) {
+    for (std::size_t secondIndex = 0; secondIndex < proxy2.shapeCount; ++secondIndex) {
+      if (proxy1.shapes[firstIndex]->intersects(*proxy2.shapes[secondIndex]))
+        return true;
+    }
+  }
+
+  return false;
+}
+
+void CollisionSystem::updateProxies() {
+  for (Proxy& proxy : m_proxies) {
+    const Entity& entity = *proxy.entity;
+
+    proxy.shapeCount = 0;
+
+    // Disabled entities are kept in place, but without any shape they are skipped when sweeping
+    if (!entity.isEnabled())
+      continue;
+
+    addShape<Line>(entity, proxy.shapes, proxy.shapeCount);
+    addShape<Plane>(entity, proxy.shapes, proxy.shapeCount);
+    addShape<Sphere>(entity, proxy.shapes, proxy.shapeCount);
+    addShape<Triangle>(entity, proxy.shapes, proxy.shapeCount);
+    addShape<Quad>(entity, proxy.shapes, proxy.shapeCount);
+    addShape<AABB>(entity, proxy.shapes, proxy.shapeCount);
+
+    proxy.minPos = Vec3f(std::numeric_limits<float>::max());
+    proxy.maxPos = Vec3f(std::numeric_limits<float>::lowest());
+
+    for (std::size_t shapeIndex = 0; shapeIndex < proxy.shapeCount; ++shapeIndex) {
+      const AABB shapeBox = proxy.shapes[shapeIndex]->computeBoundingBox();
+
+      for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+        proxy.minPos[axisIndex] = std::min(proxy.minPos[axisIndex], shapeBox.getLeftBottomBackPos()[axisIndex]);
+        proxy.maxPos[axisIndex] = std::max(proxy.maxPos[axisIndex], shapeBox.getRightTopFrontPos()[axisIndex]);
+      }
+    }
+  }
+
+  const std::size_t sweepAxis = m_sweepAxis;
+  const auto isBefore = [sweepAxis] (const Proxy& proxy1, const Proxy& proxy2) {
+    return (proxy1.minPos[sweepAxis] < proxy2.minPos[sweepAxis]);
+  };
+
+  // If the sweep axis has changed or proxies have been added, the previous order is irrelevant & the proxies must be fully sorted
+  if (m_isSortNeeded) {
+    std::sort(m_proxies.begin(), m_proxies.end(), isBefore);
+    m_isSortNeeded = false;
+    return;
+  }
+
+  // Otherwise, the proxies are already almost sorted from the previous update; an insertion sort is then the fastest
+  for (std::size_t proxyIndex = 1; proxyIndex < m_proxies.size(); ++proxyIndex) {
+    if (!isBefore(m_proxies[proxyIndex], m_proxies[proxyIndex - 1]))
+      continue;
+
+    Proxy proxy = m_proxies[proxyIndex];
+    std::size_t insertIndex = proxyIndex;
+
+    do {
+      m_proxies[insertIndex] = m_proxies[insertIndex - 1];
+      --insertIndex;
+    } while (insertIndex > 0 && isBefore(proxy, m_proxies[insertIndex - 1]));
+
+    m_proxies[insertIndex] = proxy;
+  }
+}
+
+void CollisionSystem::findPairs() {
+  m_overlappingPairs.clear();
+  m_collisions.clear();
+
+  const std::size_t firstAxis  = (m_sweepAxis + 1) % 3;
+  const std::size_t secondAxis = (m_sweepAxis + 2) % 3;
+
+  Vec3f centroidSum {};
+  Vec3f centroidSqSum {};
+  std::size_t boundedProxyCount = 0;
+
+  for (std::size_t proxyIndex = 0; proxyIndex < m_proxies.size(); ++proxyIndex) {
+    const Proxy& proxy = m_proxies[proxyIndex];
+
+    if (proxy.shapeCount == 0)
+      continue;
+
+    // Proxies being sorted by their minimum position along the sweep axis, the following ones can only overlap until one starts after this one's end
+    for (std::size_t otherIndex = proxyIndex + 1; otherIndex < m_proxies.size(); ++otherIndex) {
+      const Proxy& otherProxy = m_proxies[otherIndex];
+
+      if (otherProxy.minPos[m_sweepAxis] > proxy.maxPos[m_sweepAxis])
+        break;
+
+      if (otherProxy.shapeCount == 0
+       || otherProxy.minPos[firstAxis] > proxy.maxPos[firstAxis] || otherProxy.maxPos[firstAxis] < proxy.minPos[firstAxis]
+       || otherProxy.minPos[secondAxis] > proxy.maxPos[secondAxis] || otherProxy.maxPos[secondAxis] < proxy.minPos[secondAxis])
+        continue;
+
+      m_overlappingPairs.push_back({ proxy.entity, otherProxy.entity });
+
+      if (intersects(proxy, otherProxy))
+        m_collisions.push_back({ proxy.entity, otherProxy.entity });
+    }
+
+    // Unbounded proxies (like planes) do not tell anything about how the others are spread
+    const Vec3f centroid = (proxy.minPos + proxy.maxPos) * 0.5f;
+
+    if (!std::isfinite(centroid[0]) || !std::isfinite(centroid[1]) || !std::isfinite(centroid[2]))
+      continue;
+
+    centroidSum   += centroid;
+    centroidSqSum += centroid * centroid;
+    ++boundedProxyCount;
+  }
+
+  if (boundedProxyCount == 0)
+    return;
+
+  // The proxies will be sorted along the axis with the largest variance on the next update, minimizing the number of proxies swept through
+  // See: Real-Time Collision Detection (Christer Ericson), 7.5.2 - Sort and Sweep
+  const Vec3f centroidMean = centroidSum / static_cast<float>(boundedProxyCount);
+  const Vec3f variance     = centroidSqSum / static_cast<float>(boundedProxyCount) - centroidMean * centroidMean;
+
+  std::size_t sweepAxis = 0;
+
+  if (variance[1] > variance[sweepAxis])
+    sweepAxis = 1;
+
+  if (variance[2] > variance[sweepAxis])
+    sweepAxis = 2;
+
+  if (sweepAxis != m_sweepAxis) {
+    m_sweepAxis    = sweepAxis;
+    m_isSortNeeded = true;
+  }
+}
+
+} // namespace Raz
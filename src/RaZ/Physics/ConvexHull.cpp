@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <limits>
+
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Render/Mesh.hpp"
+
+namespace Raz {
+
+ConvexHull::ConvexHull(const Mesh& mesh) {
+  std::size_t vertexCount = 0;
+
+  for (const SubmeshPtr& submesh : mesh.getSubmeshes())
+    vertexCount += submesh->getVertexCount();
+
+  m_points.reserve(vertexCount);
+
+  for (const SubmeshPtr& submesh : mesh.getSubmeshes()) {
+    for (const Vertex& vertex : submesh->getVertices())
+      m_points.emplace_back(vertex.position);
+  }
+}
+
+void ConvexHull::transform(const Mat4f& transform) {
+  for (Vec3f& point : m_points)
+    point = Vec3f(Vec4f(point, 1.f) * transform);
+}
+
+Vec3f ConvexHull::computeSupportPoint(const Vec3f& direction) const {
+  if (m_points.empty())
+    throw std::runtime_error("Error: Cannot compute the support point of an empty convex hull.");
+
+  std::size_t supportIndex = 0;
+  float maxDist = m_points.front().dot(direction);
+
+  for (std::size_t pointIndex = 1; pointIndex < m_points.size(); ++pointIndex) {
+    const float pointDist = m_points[pointIndex].dot(direction);
+
+    if (pointDist > maxDist) {
+      maxDist      = pointDist;
+      supportIndex = pointIndex;
+    }
+  }
+
+  return m_points[supportIndex];
+}
+
+AABB ConvexHull::computeBoundingBox() const {
+  if (m_points.empty())
+    throw std::runtime_error("Error: Cannot compute the bounding box of an empty convex hull.");
+
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  for (const Vec3f& point : m_points) {
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      minPos[axisIndex] = std::min(minPos[axisIndex], point[axisIndex]);
+      maxPos[axisIndex] = std::max(maxPos[axisIndex], point[axisIndex]);
+    }
+  }
+
+  return AABB(maxPos, minPos);
+}
+
+} // namespace Raz
@@ -0,0 +1,341 @@
+#include <algorithm>
+
+#include "RaZ/Physics/Gjk.hpp"
+
+namespace Raz {
+
+namespace Gjk {
+
+namespace {
+
+constexpr float DegenerateTolerance = 1e-12f;
+
+/// Closest point of a sub-simplex to the origin, along with the points defining it & their barycentric weights.
+struct Reduction {
+  Vec3f closestPoint {};
+  std::array<std::size_t, 3> indices {};
+  std::array<float, 3> weights {};
+  std::size_t count {};
+};
+
+Reduction reducePoint(const std::array<SupportPoint, 4>& points, std::size_t index) {
+  return Reduction{ points[index].point, {{ index }}, {{ 1.f }}, 1 };
+}
+
+Reduction reduceSegment(const std::array<SupportPoint, 4>& points, std::size_t firstIndex, std::size_t secondIndex) {
+  const Vec3f& firstPoint = points[firstIndex].point;
+  const Vec3f segment     = points[secondIndex].point - firstPoint;
+  const float sqLength    = segment.dot(segment);
+
+  if (sqLength <= DegenerateTolerance)
+    return reducePoint(points, firstIndex);
+
+  const float ratio = -firstPoint.dot(segment) / sqLength;
+
+  if (ratio <= 0.f)
+    return reducePoint(points, firstIndex);
+
+  if (ratio >= 1.f)
+    return reducePoint(points, secondIndex);
+
+  return Reduction{ firstPoint + segment * ratio, {{ firstIndex, secondIndex }}, {{ 1.f - ratio, ratio }}, 2 };
+}
+
+/// Finds the closest point of a triangle to the origin, checking in which Voronoi region of the triangle the origin lies.
+/// See: Real-Time Collision Detection (Christer Ericson), 5.1.5 - Closest Point on Triangle to Point
+Reduction reduceTriangle(const std::array<SupportPoint, 4>& points, std::size_t firstIndex, std::size_t secondIndex, std::size_t thirdIndex) {
+  const Vec3f& firstPoint  = points[firstIndex].point;
+  const Vec3f& secondPoint = points[secondIndex].point;
+  const Vec3f& thirdPoint  = points[thirdIndex].point;
+
+  const Vec3f firstEdge  = secondPoint - firstPoint;
+  const Vec3f secondEdge = thirdPoint - firstPoint;
+
+  const float firstDist1 = -firstEdge.dot(firstPoint);
+  const float firstDist2 = -secondEdge.dot(firstPoint);
+
+  if (firstDist1 <= 0.f && firstDist2 <= 0.f)
+    return reducePoint(points, firstIndex);
+
+  const float secondDist1 = -firstEdge.dot(secondPoint);
+  const float secondDist2 = -secondEdge.dot(secondPoint);
+
+  if (secondDist1 >= 0.f && secondDist2 <= secondDist1)
+    return reducePoint(points, secondIndex);
+
+  const float thirdWeight = firstDist1 * secondDist2 - secondDist1 * firstDist2;
+
+  if (thirdWeight <= 0.f && firstDist1 >= 0.f && secondDist1 <= 0.f)
+    return reduceSegment(points, firstIndex, secondIndex);
+
+  const float thirdDist1 = -firstEdge.dot(thirdPoint);
+  const float thirdDist2 = -secondEdge.dot(thirdPoint);
+
+  if (thirdDist2 >= 0.f && thirdDist1 <= thirdDist2)
+    return reducePoint(points, thirdIndex);
+
+  const float secondWeight = thirdDist1 * firstDist2 - firstDist1 * thirdDist2;
+
+  if (secondWeight <= 0.f && firstDist2 >= 0.f && thirdDist2 <= 0.f)
+    return reduceSegment(points, firstIndex, thirdIndex);
+
+  const float firstWeight = secondDist1 * thirdDist2 - thirdDist1 * secondDist2;
+
+  if (firstWeight <= 0.f && (secondDist2 - secondDist1) >= 0.f && (thirdDist1 - thirdDist2) >= 0.f)
+    return reduceSegment(points, secondIndex, thirdIndex);
+
+  const float weightSum = firstWeight + secondWeight + thirdWeight;
+
+  // A flat triangle has no inner region; its closest point is then on one of its edges
+  if (weightSum <= DegenerateTolerance) {
+    Reduction bestReduction = reduceSegment(points, firstIndex, secondIndex);
+
+    for (const Reduction& reduction : { reduceSegment(points, firstIndex, thirdIndex), reduceSegment(points, secondIndex, thirdIndex) }) {
+      if (reduction.closestPoint.computeSquaredLength() < bestReduction.closestPoint.computeSquaredLength())
+        bestReduction = reduction;
+    }
+
+    return bestReduction;
+  }
+
+  const float secondRatio = secondWeight / weightSum;
+  const float thirdRatio  = thirdWeight / weightSum;
+
+  return Reduction{ firstPoint + firstEdge * secondRatio + secondEdge * thirdRatio,
+                    {{ firstIndex, secondIndex, thirdIndex }},
+                    {{ 1.f - secondRatio - thirdRatio, secondRatio, thirdRatio }},
+                    3 };
+}
+
+} // namespace
+
+Vec3f Simplex::reduce() {
+  Reduction reduction;
+
+  switch (m_size) {
+    case 1:
+      reduction = reducePoint(m_points, 0);
+      break;
+
+    case 2:
+      reduction = reduceSegment(m_points, 0, 1);
+      break;
+
+    case 3:
+      reduction = reduceTriangle(m_points, 0, 1, 2);
+      break;
+
+    case 4:
+    {
+      // The closest point is on one of the faces the origin is in front of; if there is none, the origin is inside the tetrahedron
+      // See: Real-Time Collision Detection (Christer Ericson), 5.1.6 - Closest Point on Tetrahedron to Point
+      constexpr std::size_t faceIndices[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+
+      bool isOutside = false;
+      float minSqDist = std::numeric_limits<float>::max();
+
+      for (const auto& face : faceIndices) {
+        const Vec3f& facePoint = m_points[face[0]].point;
+        const Vec3f normal     = (m_points[face[1]].point - facePoint).cross(m_points[face[2]].point - facePoint);
+
+        const float originSide   = -facePoint.dot(normal);
+        const float oppositeSide = (m_points[face[3]].point - facePoint).dot(normal);
+
+        // A flat tetrahedron cannot contain the origin; all its faces are then checked
+        if (std::abs(oppositeSide) > DegenerateTolerance && originSide * oppositeSide >= 0.f)
+          continue;
+
+        const Reduction faceReduction = reduceTriangle(m_points, face[0], face[1], face[2]);
+        const float sqDist = faceReduction.closestPoint.computeSquaredLength();
+
+        isOutside = true;
+
+        if (sqDist < minSqDist) {
+          minSqDist = sqDist;
+          reduction = faceReduction;
+        }
+      }
+
+      if (!isOutside)
+        return Vec3f(0.f);
+
+      break;
+    }
+
+    default:
+      throw std::runtime_error("Error: Cannot reduce an empty simplex.");
+  }
+
+  const std::array<SupportPoint, 4> points = m_points;
+
+  for (std::size_t pointIndex = 0; pointIndex < reduction.count; ++pointIndex) {
+    m_points[pointIndex]  = points[reduction.indices[pointIndex]];
+    m_weights[pointIndex] = reduction.weights[pointIndex];
+  }
+
+  m_size = reduction.count;
+
+  return reduction.closestPoint;
+}
+
+void Simplex::computeClosestPoints(Vec3f& firstPoint, Vec3f& secondPoint) const {
+  firstPoint  = Vec3f(0.f);
+  secondPoint = Vec3f(0.f);
+
+  // A tetrahedron only remains if it contains the origin, in which case the shapes intersect & the closest points are meaningless
+  if (m_size == 4)
+    return;
+
+  for (std::size_t pointIndex = 0; pointIndex < m_size; ++pointIndex) {
+    firstPoint  += m_points[pointIndex].firstPoint * m_weights[pointIndex];
+    secondPoint += m_points[pointIndex].secondPoint * m_weights[pointIndex];
+  }
+}
+
+namespace Detail {
+
+ExpandingPolytope::ExpandingPolytope(const Simplex& simplex) {
+  if (simplex.getSize() != 4)
+    throw std::runtime_error("Error: An expanding polytope must be created from a tetrahedron.");
+
+  m_points.reserve(MaxIterationCount + 4);
+  m_faces.reserve(MaxIterationCount * 2 + 4);
+
+  for (std::size_t pointIndex = 0; pointIndex < 4; ++pointIndex) {
+    m_points.emplace_back(simplex[pointIndex]);
+    m_innerPoint += simplex[pointIndex].point;
+  }
+
+  // The polytope only growing, the tetrahedron's centroid always remains inside it & allows to orient the faces outward
+  m_innerPoint /= 4.f;
+
+  addFace(0, 1, 2);
+  addFace(0, 3, 1);
+  addFace(0, 2, 3);
+  addFace(1, 3, 2);
+}
+
+Vec3f ExpandingPolytope::findClosestFace(float& distance) const {
+  const Face& closestFace = m_faces[findClosestFaceIndex()];
+
+  distance = closestFace.distance;
+  return closestFace.normal;
+}
+
+bool ExpandingPolytope::expand(const SupportPoint& point) {
+  const std::size_t pointIndex = m_points.size();
+  m_edges.clear();
+
+  // Removing the faces seen by the point, keeping the edges which are not shared between them: these form the horizon around the hole
+  for (std::size_t faceIndex = 0; faceIndex < m_faces.size();) {
+    const Face& face = m_faces[faceIndex];
+
+    if (face.normal.dot(point.point - m_points[face.indices[0]].point) <= 0.f) {
+      ++faceIndex;
+      continue;
+    }
+
+    for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+      const std::size_t edgeStart = face.indices[edgeIndex];
+      const std::size_t edgeEnd   = face.indices[(edgeIndex + 1) % 3];
+
+      // An edge shared by two removed faces appears once in each direction
+      const auto sharedEdge = std::find(m_edges.begin(), m_edges.end(), std::make_pair(edgeEnd, edgeStart));
+
+      if (sharedEdge != m_edges.end())
+        m_edges.erase(sharedEdge);
+      else
+        m_edges.emplace_back(edgeStart, edgeEnd);
+    }
+
+    m_faces[faceIndex] = m_faces.back();
+    m_faces.pop_back();
+  }
+
+  if (m_edges.empty())
+    return false;
+
+  m_points.emplace_back(point);
+
+  for (const std::pair<std::size_t, std::size_t>& edge : m_edges)
+    addFace(edge.first, edge.second, pointIndex);
+
+  return true;
+}
+
+void ExpandingPolytope::computePenetration(PenetrationInfo& penetration) const {
+  const Face& closestFace = m_faces[findClosestFaceIndex()];
+
+  penetration.normal = closestFace.normal;
+  penetration.depth  = std::max(closestFace.distance, 0.f);
+
+  // The origin's projection onto the face is expressed with barycentric coordinates, which give the matching points of both shapes
+  // See: Real-Time Collision Detection (Christer Ericson), 3.4 - Barycentric Coordinates
+  const SupportPoint& firstPoint  = m_points[closestFace.indices[0]];
+  const SupportPoint& secondPoint = m_points[closestFace.indices[1]];
+  const SupportPoint& thirdPoint  = m_points[closestFace.indices[2]];
+
+  const Vec3f firstEdge  = secondPoint.point - firstPoint.point;
+  const Vec3f secondEdge = thirdPoint.point - firstPoint.point;
+  const Vec3f pointDir   = closestFace.normal * closestFace.distance - firstPoint.point;
+
+  const float firstEdgeSqLength  = firstEdge.dot(firstEdge);
+  const float edgesAngle         = firstEdge.dot(secondEdge);
+  const float secondEdgeSqLength = secondEdge.dot(secondEdge);
+  const float firstPointDist     = pointDir.dot(firstEdge);
+  const float secondPointDist    = pointDir.dot(secondEdge);
+  const float denominator        = firstEdgeSqLength * secondEdgeSqLength - edgesAngle * edgesAngle;
+
+  float secondWeight = 0.f;
+  float thirdWeight  = 0.f;
+
+  if (std::abs(denominator) > DegenerateTolerance) {
+    secondWeight = (secondEdgeSqLength * firstPointDist - edgesAngle * secondPointDist) / denominator;
+    thirdWeight  = (firstEdgeSqLength * secondPointDist - edgesAngle * firstPointDist) / denominator;
+  }
+
+  const float firstWeight = 1.f - secondWeight - thirdWeight;
+
+  penetration.firstPoint  = firstPoint.firstPoint * firstWeight + secondPoint.firstPoint * secondWeight + thirdPoint.firstPoint * thirdWeight;
+  penetration.secondPoint = firstPoint.secondPoint * firstWeight + secondPoint.secondPoint * secondWeight + thirdPoint.secondPoint * thirdWeight;
+}
+
+void ExpandingPolytope::addFace(std::size_t firstIndex, std::size_t secondIndex, std::size_t thirdIndex) {
+  const Vec3f& firstPoint = m_points[firstIndex].point;
+  Vec3f normal = (m_points[secondIndex].point - firstPoint).cross(m_points[thirdIndex].point - firstPoint);
+
+  const float sqLength = normal.computeSquaredLength();
+
+  // A flat face cannot be the closest one; it is kept to close the polytope, but made as far as possible
+  if (sqLength <= DegenerateTolerance) {
+    m_faces.push_back({ {{ firstIndex, secondIndex, thirdIndex }}, Vec3f(0.f), std::numeric_limits<float>::max() });
+    return;
+  }
+
+  normal /= std::sqrt(sqLength);
+
+  // Faces must have their normal pointing outward of the polytope, their indices being ordered accordingly
+  if (normal.dot(firstPoint - m_innerPoint) < 0.f) {
+    normal = -normal;
+    std::swap(secondIndex, thirdIndex);
+  }
+
+  m_faces.push_back({ {{ firstIndex, secondIndex, thirdIndex }}, normal, normal.dot(firstPoint) });
+}
+
+std::size_t ExpandingPolytope::findClosestFaceIndex() const {
+  std::size_t closestFaceIndex = 0;
+
+  for (std::size_t faceIndex = 1; faceIndex < m_faces.size(); ++faceIndex) {
+    if (m_faces[faceIndex].distance < m_faces[closestFaceIndex].distance)
+      closestFaceIndex = faceIndex;
+  }
+
+  return closestFaceIndex;
+}
+
+} // namespace Detail
+
+} // namespace Gjk
+
+} // namespace Raz
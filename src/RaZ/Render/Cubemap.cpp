@@ -131,8 +131,8 @@ void Cubemap::load(const std::string& rightTexturePath, const std::string& leftT
 }
 
 void Cubemap::draw(const Camera& camera) const {
-  glDepthFunc(GL_LEQUAL);
-  glCullFace(GL_FRONT);
+  StateCache::get().setDepthFunction(GL_LEQUAL);
+  StateCache::get().setCullFace(GL_FRONT);
 
   m_program.use();
 
@@ -144,8 +144,8 @@ void Cubemap::draw(const Camera& camera) const {
 
   Mesh::drawUnitCube();
 
-  glCullFace(GL_BACK);
-  glDepthFunc(GL_LESS);
+  StateCache::get().setCullFace(GL_BACK);
+  StateCache::get().setDepthFunction(GL_LESS);
 }
 
 } // namespace Raz
@@ -0,0 +1,221 @@
+#include <array>
+#include <iostream>
+#include <limits>
+
+#include "RaZ/Render/DeferredRenderer.hpp"
+#include "RaZ/Render/Mesh.hpp"
+
+namespace Raz {
+
+namespace {
+
+constexpr uint8_t AlbedoMetallicUnit  = 0;
+constexpr uint8_t NormalRoughnessUnit = 1;
+constexpr uint8_t DepthUnit           = 2;
+constexpr uint8_t LightUnit           = 3;
+
+} // namespace
+
+DeferredRenderer::DeferredRenderer(unsigned int width, unsigned int height, const std::string& lightingFragShaderPath, GLuint framebufferIndex)
+  : m_width{ width }, m_height{ height } {
+  const std::string lightingVertSource = R"(
+    #version 330 core
+
+    layout (location = 0) in vec3 vertPosition;
+
+    layout (std140) uniform uboCameraMatrices {
+      mat4 viewMat;
+      mat4 invViewMat;
+      mat4 projectionMat;
+      mat4 invProjectionMat;
+      mat4 viewProjectionMat;
+      vec3 cameraPos;
+    };
+
+    // Center (XYZ) & half extent (W) of the light's volume; if null, the vertices are those of a quad covering the screen
+    uniform vec4 uniLightVolume;
+
+    void main() {
+      if (uniLightVolume.w > 0.0)
+        gl_Position = viewProjectionMat * vec4(uniLightVolume.xyz + vertPosition * uniLightVolume.w, 1.0);
+      else
+        gl_Position = vec4(vertPosition.xy, 0.0, 1.0);
+    }
+  )";
+
+  const std::string resolveVertSource = R"(
+    #version 330 core
+
+    layout (location = 0) in vec3 vertPosition;
+
+    void main() {
+      gl_Position = vec4(vertPosition.xy, 0.0, 1.0);
+    }
+  )";
+
+  const std::string resolveFragSource = R"(
+    #version 330 core
+
+    uniform sampler2D uniLightBuffer;
+    uniform sampler2D uniDepthBuffer;
+    uniform vec2 uniInvBufferSize;
+
+    layout (location = 0) out vec4 fragColor;
+
+    void main() {
+      vec2 texcoords = gl_FragCoord.xy * uniInvBufferSize;
+      float depth    = texture(uniDepthBuffer, texcoords).r;
+
+      if (depth >= 1.0)
+        discard;
+
+      vec3 color = texture(uniLightBuffer, texcoords).rgb;
+
+      // HDR tone mapping
+      color = color / (color + vec3(1.0));
+      // Gamma correction
+      color = pow(color, vec3(1.0 / 2.2));
+
+      fragColor    = vec4(color, 1.0);
+      gl_FragDepth = depth;
+    }
+  )";
+
+  m_lightingProgram.setShaders(VertexShader::loadFromSource(lightingVertSource), FragmentShader::create(lightingFragShaderPath));
+  m_resolveProgram.setShaders(VertexShader::loadFromSource(resolveVertSource), FragmentShader::loadFromSource(resolveFragSource));
+
+  initBuffers();
+
+  // Normals & lighting need more precision & range than bytes provide; the depth is copied in full precision
+  m_depthBuffer           = Texture::create(width, height, ImageColorspace::DEPTH);
+  m_albedoMetallicBuffer  = Texture::create(width, height, ImageColorspace::RGBA);
+  m_normalRoughnessBuffer = Texture::create(width, height, ImageColorspace::RGBA, ImageDataType::FLOAT);
+  m_depthCopyBuffer       = Texture::create(width, height, ImageColorspace::GRAY, ImageDataType::FLOAT);
+  m_lightBuffer           = Texture::create(width, height, ImageColorspace::RGBA, ImageDataType::FLOAT);
+
+  glGenFramebuffers(1, &m_index);
+  StateCache::get().bindFramebuffer(m_index);
+
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, m_depthBuffer->getIndex(), 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + AlbedoMetallicLocation, GL_TEXTURE_2D, m_albedoMetallicBuffer->getIndex(), 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + NormalRoughnessLocation, GL_TEXTURE_2D, m_normalRoughnessBuffer->getIndex(), 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + DepthLocation, GL_TEXTURE_2D, m_depthCopyBuffer->getIndex(), 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + LightLocation, GL_TEXTURE_2D, m_lightBuffer->getIndex(), 0);
+
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    std::cerr << "Error: Deferred renderer's framebuffer is not complete." << std::endl;
+
+  StateCache::get().bindFramebuffer(framebufferIndex);
+}
+
+void DeferredRenderer::initBuffers() const {
+  const Vec2f invBufferSize({ 1.f / static_cast<float>(m_width), 1.f / static_cast<float>(m_height) });
+
+  m_lightingProgram.use();
+  m_lightingProgram.sendUniform("uniGBuffer.albedoMetallic",  static_cast<int>(AlbedoMetallicUnit));
+  m_lightingProgram.sendUniform("uniGBuffer.normalRoughness", static_cast<int>(NormalRoughnessUnit));
+  m_lightingProgram.sendUniform("uniGBuffer.depth",           static_cast<int>(DepthUnit));
+  m_lightingProgram.sendUniform("uniInvBufferSize", invBufferSize);
+
+  m_resolveProgram.use();
+  m_resolveProgram.sendUniform("uniLightBuffer", static_cast<int>(LightUnit));
+  m_resolveProgram.sendUniform("uniDepthBuffer", static_cast<int>(DepthUnit));
+  m_resolveProgram.sendUniform("uniInvBufferSize", invBufferSize);
+}
+
+void DeferredRenderer::updateShaders() const {
+  m_lightingProgram.updateShaders();
+  initBuffers();
+}
+
+void DeferredRenderer::bindGeometryPass() const {
+  StateCache::get().bindFramebuffer(m_index);
+
+  const std::array<GLenum, 4> drawBuffers = { GL_COLOR_ATTACHMENT0 + AlbedoMetallicLocation,
+                                              GL_COLOR_ATTACHMENT0 + NormalRoughnessLocation,
+                                              GL_COLOR_ATTACHMENT0 + DepthLocation,
+                                              GL_COLOR_ATTACHMENT0 + LightLocation };
+  glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+
+  // The depth copy is cleared to the far plane, like the depth attachment, the other buffers to 0
+  const std::array<float, 4> nullValues = { 0.f, 0.f, 0.f, 0.f };
+  const std::array<float, 4> farDepth   = { 1.f, 1.f, 1.f, 1.f };
+
+  glClearBufferfv(GL_COLOR, AlbedoMetallicLocation, nullValues.data());
+  glClearBufferfv(GL_COLOR, NormalRoughnessLocation, nullValues.data());
+  glClearBufferfv(GL_COLOR, DepthLocation, farDepth.data());
+  glClearBufferfv(GL_COLOR, LightLocation, nullValues.data());
+  glClear(GL_DEPTH_BUFFER_BIT);
+}
+
+void DeferredRenderer::applyLights(const std::vector<Sphere>& lightVolumes, const Vec3f& cameraPos) const {
+  StateCache& stateCache = StateCache::get();
+
+  stateCache.bindFramebuffer(m_index);
+
+  // Only the lighting buffer is written to, the G-buffer being read
+  const GLenum lightBuffer = GL_COLOR_ATTACHMENT0 + LightLocation;
+  glDrawBuffers(1, &lightBuffer);
+
+  stateCache.bindTexture(GL_TEXTURE_2D, m_albedoMetallicBuffer->getIndex(), AlbedoMetallicUnit);
+  stateCache.bindTexture(GL_TEXTURE_2D, m_normalRoughnessBuffer->getIndex(), NormalRoughnessUnit);
+  stateCache.bindTexture(GL_TEXTURE_2D, m_depthCopyBuffer->getIndex(), DepthUnit);
+
+  m_lightingProgram.use();
+
+  const bool isCullingEnabled = stateCache.isCapabilityEnabled(GL_CULL_FACE);
+
+  stateCache.setCapability(GL_BLEND, true);
+  stateCache.setBlendFunction(GL_ONE, GL_ONE);
+  stateCache.setDepthMask(false);
+
+  for (std::size_t lightIndex = 0; lightIndex < lightVolumes.size(); ++lightIndex) {
+    const Sphere& volume = lightVolumes[lightIndex];
+    const float radius   = volume.getRadius();
+
+    m_lightingProgram.sendUniform("uniLightIndex", static_cast<unsigned int>(lightIndex));
+
+    if (radius == std::numeric_limits<float>::infinity() || (volume.getCenter() - cameraPos).computeSquaredLength() <= radius * radius * 3.f) {
+      // Global lights & those whose box contains the camera are applied on the whole screen
+      stateCache.setCapability(GL_DEPTH_TEST, false);
+      stateCache.setCapability(GL_CULL_FACE, false);
+
+      m_lightingProgram.sendUniform("uniLightVolume", Vec4f(0.f));
+      Mesh::drawUnitQuad();
+    } else {
+      // Back faces are only drawn on pixels in front of them; those also behind the front faces are shaded uselessly but correctly
+      stateCache.setCapability(GL_DEPTH_TEST, true);
+      stateCache.setDepthFunction(GL_GEQUAL);
+      stateCache.setCapability(GL_CULL_FACE, true);
+      stateCache.setCullFace(GL_FRONT);
+
+      m_lightingProgram.sendUniform("uniLightVolume", Vec4f({ volume.getCenter()[0], volume.getCenter()[1], volume.getCenter()[2], radius }));
+      Mesh::drawUnitCube();
+    }
+  }
+
+  stateCache.setDepthMask(true);
+  stateCache.setCapability(GL_BLEND, false);
+  stateCache.setCapability(GL_DEPTH_TEST, true);
+  stateCache.setDepthFunction(GL_LESS);
+  stateCache.setCapability(GL_CULL_FACE, isCullingEnabled);
+  stateCache.setCullFace(GL_BACK);
+}
+
+void DeferredRenderer::resolve(GLuint framebufferIndex) const {
+  StateCache& stateCache = StateCache::get();
+
+  stateCache.bindFramebuffer(framebufferIndex);
+
+  stateCache.bindTexture(GL_TEXTURE_2D, m_lightBuffer->getIndex(), LightUnit);
+  stateCache.bindTexture(GL_TEXTURE_2D, m_depthCopyBuffer->getIndex(), DepthUnit);
+
+  m_resolveProgram.use();
+
+  // The quad must not be hidden by the previous frame's depth, which is entirely replaced
+  stateCache.setDepthFunction(GL_ALWAYS);
+  Mesh::drawUnitQuad();
+  stateCache.setDepthFunction(GL_LESS);
+}
+
+} // namespace Raz
@@ -0,0 +1,302 @@
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+#include "RaZ/Render/FrameGraph.hpp"
+#include "RaZ/Render/GpuProfiler.hpp"
+
+namespace Raz {
+
+constexpr std::size_t FrameGraph::InvalidIndex;
+
+bool FrameGraph::isPassCulled(std::size_t passIndex) const {
+  return (passIndex >= m_culledPasses.size() || m_culledPasses[passIndex]);
+}
+
+const Texture& FrameGraph::getTexture(std::size_t textureIndex) const {
+  const TextureResource& texture = m_textures[textureIndex];
+
+  if (texture.importedTexture)
+    return *texture.importedTexture;
+
+  if (texture.physicalIndex >= m_texturePool.size() || m_texturePool[texture.physicalIndex].texture == nullptr)
+    throw std::runtime_error("Error: The frame graph's texture '" + texture.name + "' is not allocated; it may be unused or the graph not executed");
+
+  return *m_texturePool[texture.physicalIndex].texture;
+}
+
+std::size_t FrameGraph::addTexture(std::string name, const FrameGraphTextureDescriptor& descriptor) {
+  TextureResource texture;
+  texture.name       = std::move(name);
+  texture.descriptor = descriptor;
+
+  m_textures.emplace_back(std::move(texture));
+  return m_textures.size() - 1;
+}
+
+std::size_t FrameGraph::importTexture(std::string name, TexturePtr texture, const FrameGraphTextureDescriptor& descriptor) {
+  const std::size_t textureIndex = addTexture(std::move(name), descriptor);
+  m_textures[textureIndex].importedTexture = std::move(texture);
+
+  return textureIndex;
+}
+
+std::size_t FrameGraph::addPass(std::string name, FrameGraphPass::ExecuteFunc execute, bool hasSideEffects) {
+  FrameGraphPass pass;
+  pass.name           = std::move(name);
+  pass.execute        = std::move(execute);
+  pass.hasSideEffects = hasSideEffects;
+
+  m_passes.emplace_back(std::move(pass));
+  return m_passes.size() - 1;
+}
+
+void FrameGraph::compile() {
+  const std::size_t passCount = m_passes.size();
+
+  std::vector<std::vector<std::size_t>> textureWriters(m_textures.size());
+
+  for (std::size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+    for (const std::size_t textureIndex : m_passes[passIndex].outputs)
+      textureWriters[textureIndex].emplace_back(passIndex);
+  }
+
+  // Culling: only the passes contributing to a side effect or to an output texture are kept, going up from them through their inputs
+  m_culledPasses.assign(passCount, true);
+  std::vector<std::size_t> passStack;
+
+  for (std::size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+    const FrameGraphPass& pass = m_passes[passIndex];
+    const bool hasExternalOutput = std::any_of(pass.outputs.cbegin(), pass.outputs.cend(), [this] (std::size_t textureIndex) {
+      return (m_textures[textureIndex].isOutput || m_textures[textureIndex].importedTexture != nullptr);
+    });
+
+    if (pass.hasSideEffects || hasExternalOutput) {
+      m_culledPasses[passIndex] = false;
+      passStack.emplace_back(passIndex);
+    }
+  }
+
+  while (!passStack.empty()) {
+    const std::size_t passIndex = passStack.back();
+    passStack.pop_back();
+
+    for (const std::size_t textureIndex : m_passes[passIndex].inputs) {
+      for (const std::size_t writerIndex : textureWriters[textureIndex]) {
+        if (!m_culledPasses[writerIndex])
+          continue;
+
+        m_culledPasses[writerIndex] = false;
+        passStack.emplace_back(writerIndex);
+      }
+    }
+  }
+
+  // Ordering: a pass runs after the ones writing its inputs, and after the ones declared before it writing the same outputs
+  std::vector<std::vector<std::size_t>> dependentPasses(passCount);
+  std::vector<std::size_t> dependencyCounts(passCount, 0);
+
+  const auto addDependency = [&dependentPasses, &dependencyCounts] (std::size_t passIndex, std::size_t dependentIndex) {
+    dependentPasses[passIndex].emplace_back(dependentIndex);
+    ++dependencyCounts[dependentIndex];
+  };
+
+  std::size_t alivePassCount = 0;
+
+  for (std::size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+    if (m_culledPasses[passIndex])
+      continue;
+
+    ++alivePassCount;
+
+    for (const std::size_t textureIndex : m_passes[passIndex].inputs) {
+      for (const std::size_t writerIndex : textureWriters[textureIndex]) {
+        if (writerIndex != passIndex && !m_culledPasses[writerIndex])
+          addDependency(writerIndex, passIndex);
+      }
+    }
+
+    for (const std::size_t textureIndex : m_passes[passIndex].outputs) {
+      for (const std::size_t writerIndex : textureWriters[textureIndex]) {
+        if (writerIndex < passIndex && !m_culledPasses[writerIndex])
+          addDependency(writerIndex, passIndex);
+      }
+    }
+  }
+
+  // Among the passes ready to be executed, the first declared one is always picked, keeping the declaration order when possible
+  std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> readyPasses;
+
+  for (std::size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+    if (!m_culledPasses[passIndex] && dependencyCounts[passIndex] == 0)
+      readyPasses.push(passIndex);
+  }
+
+  m_executionOrder.clear();
+
+  while (!readyPasses.empty()) {
+    const std::size_t passIndex = readyPasses.top();
+    readyPasses.pop();
+
+    m_executionOrder.emplace_back(passIndex);
+
+    for (const std::size_t dependentIndex : dependentPasses[passIndex]) {
+      if (--dependencyCounts[dependentIndex] == 0)
+        readyPasses.push(dependentIndex);
+    }
+  }
+
+  if (m_executionOrder.size() != alivePassCount)
+    throw std::runtime_error("Error: The frame graph's passes have a cyclic dependency");
+
+  // Lifetimes: each texture is needed from the first to the last pass using it, in execution order
+  std::vector<std::size_t> firstUses(m_textures.size(), InvalidIndex);
+  std::vector<std::size_t> lastUses(m_textures.size(), 0);
+
+  for (std::size_t orderIndex = 0; orderIndex < m_executionOrder.size(); ++orderIndex) {
+    const FrameGraphPass& pass = m_passes[m_executionOrder[orderIndex]];
+
+    for (const std::vector<std::size_t>* textureIndices : { &pass.inputs, &pass.outputs }) {
+      for (const std::size_t textureIndex : *textureIndices) {
+        firstUses[textureIndex] = std::min(firstUses[textureIndex], orderIndex);
+        lastUses[textureIndex]  = std::max(lastUses[textureIndex], orderIndex);
+      }
+    }
+  }
+
+  // Aliasing: transient textures are given the first physical texture with the same properties which is no longer used
+  std::vector<std::size_t> transientTextures;
+
+  for (std::size_t textureIndex = 0; textureIndex < m_textures.size(); ++textureIndex) {
+    m_textures[textureIndex].physicalIndex = InvalidIndex;
+
+    if (m_textures[textureIndex].importedTexture == nullptr && firstUses[textureIndex] != InvalidIndex)
+      transientTextures.emplace_back(textureIndex);
+  }
+
+  std::stable_sort(transientTextures.begin(), transientTextures.end(), [&firstUses] (std::size_t textureIndex1, std::size_t textureIndex2) {
+    return (firstUses[textureIndex1] < firstUses[textureIndex2]);
+  });
+
+  m_physicalDescriptors.clear();
+  std::vector<std::size_t> physicalLastUses;
+
+  for (const std::size_t textureIndex : transientTextures) {
+    TextureResource& texture = m_textures[textureIndex];
+
+    for (std::size_t physicalIndex = 0; physicalIndex < m_physicalDescriptors.size(); ++physicalIndex) {
+      if (m_physicalDescriptors[physicalIndex] == texture.descriptor && physicalLastUses[physicalIndex] < firstUses[textureIndex]) {
+        texture.physicalIndex = physicalIndex;
+        break;
+      }
+    }
+
+    if (texture.physicalIndex == InvalidIndex) {
+      texture.physicalIndex = m_physicalDescriptors.size();
+      m_physicalDescriptors.emplace_back(texture.descriptor);
+      physicalLastUses.emplace_back(0);
+    }
+
+    physicalLastUses[texture.physicalIndex] = lastUses[textureIndex];
+  }
+}
+
+void FrameGraph::execute(GpuProfiler* gpuProfiler) {
+  // Pooled textures are kept as long as the physical textures at the same index have the same properties
+  if (m_texturePool.size() < m_physicalDescriptors.size())
+    m_texturePool.resize(m_physicalDescriptors.size());
+
+  for (std::size_t physicalIndex = 0; physicalIndex < m_physicalDescriptors.size(); ++physicalIndex) {
+    PooledTexture& pooledTexture                   = m_texturePool[physicalIndex];
+    const FrameGraphTextureDescriptor& descriptor = m_physicalDescriptors[physicalIndex];
+
+    if (pooledTexture.texture && pooledTexture.descriptor == descriptor)
+      continue;
+
+    pooledTexture.descriptor = descriptor;
+    pooledTexture.texture    = Texture::create(descriptor.width, descriptor.height, descriptor.colorspace, descriptor.dataType);
+  }
+
+  if (m_defaultViewportWidth != 0 && m_defaultViewportHeight != 0)
+    m_defaultViewport = { 0, 0, static_cast<GLint>(m_defaultViewportWidth), static_cast<GLint>(m_defaultViewportHeight) };
+  else
+    glGetIntegerv(GL_VIEWPORT, m_defaultViewport.data());
+
+  for (const std::size_t passIndex : m_executionOrder) {
+    const FrameGraphPass& pass = m_passes[passIndex];
+    GpuProfilerScope passScope(gpuProfiler, pass.name);
+
+    bindOutputs(pass);
+
+    if (pass.execute)
+      pass.execute(*this);
+  }
+
+  bindDefaultFramebuffer();
+}
+
+void FrameGraph::clear() {
+  m_passes.clear();
+  m_textures.clear();
+  m_culledPasses.clear();
+  m_executionOrder.clear();
+  m_physicalDescriptors.clear();
+}
+
+FrameGraph::~FrameGraph() {
+  if (m_framebufferIndex != 0)
+    StateCache::get().deleteFramebuffer(m_framebufferIndex);
+}
+
+void FrameGraph::bindOutputs(const FrameGraphPass& pass) {
+  if (pass.outputs.empty()) {
+    bindDefaultFramebuffer();
+    return;
+  }
+
+  if (m_framebufferIndex == 0)
+    glGenFramebuffers(1, &m_framebufferIndex);
+
+  StateCache::get().bindFramebuffer(m_framebufferIndex);
+
+  std::vector<GLenum> drawBuffers;
+  GLuint depthTextureIndex = 0;
+
+  for (const std::size_t textureIndex : pass.outputs) {
+    const GLuint glTextureIndex = getTexture(textureIndex).getIndex();
+
+    if (m_textures[textureIndex].descriptor.colorspace == ImageColorspace::DEPTH) {
+      depthTextureIndex = glTextureIndex;
+      continue;
+    }
+
+    const GLenum attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(drawBuffers.size());
+    glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, glTextureIndex, 0);
+    drawBuffers.emplace_back(attachment);
+  }
+
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthTextureIndex, 0);
+
+  // Attachments left by a previous pass having more outputs are removed
+  for (std::size_t attachmentIndex = drawBuffers.size(); attachmentIndex < m_boundColorAttachmentCount; ++attachmentIndex)
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(attachmentIndex), GL_TEXTURE_2D, 0, 0);
+
+  m_boundColorAttachmentCount = drawBuffers.size();
+
+  if (drawBuffers.empty()) {
+    glDrawBuffer(GL_NONE);
+  } else {
+    glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+  }
+
+  const FrameGraphTextureDescriptor& firstDescriptor = m_textures[pass.outputs.front()].descriptor;
+  glViewport(0, 0, static_cast<GLsizei>(firstDescriptor.width), static_cast<GLsizei>(firstDescriptor.height));
+}
+
+void FrameGraph::bindDefaultFramebuffer() const {
+  StateCache::get().bindFramebuffer(m_defaultFramebufferIndex);
+  glViewport(m_defaultViewport[0], m_defaultViewport[1], m_defaultViewport[2], m_defaultViewport[3]);
+}
+
+} // namespace Raz
@@ -50,7 +50,13 @@ void Framebuffer::initBuffers() const {
 }
 
 void Framebuffer::bind() const {
-  glBindFramebuffer(GL_FRAMEBUFFER, m_index);
+  GLint previousIndex {};
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousIndex);
+
+  if (static_cast<GLuint>(previousIndex) != m_index)
+    m_previousIndex = static_cast<GLuint>(previousIndex);
+
+  StateCache::get().bindFramebuffer(m_index);
 
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
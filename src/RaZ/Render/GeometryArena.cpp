@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "RaZ/Render/GeometryArena.hpp"
+
+namespace Raz {
+
+namespace {
+
+// Buffers are only manipulated through the copy targets, so that the bound vertex array's element buffer is never changed
+
+/// Creates a temporary buffer holding a copy of the beginning of another buffer; it must be deleted afterward.
+/// \param bufferIndex Index of the buffer to be copied.
+/// \param size Size in bytes of the data to be copied.
+/// \return Index of the temporary buffer.
+GLuint createTemporaryCopy(GLuint bufferIndex, std::size_t size) {
+  GLuint copyIndex {};
+  glGenBuffers(1, &copyIndex);
+
+  StateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, copyIndex);
+  glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_COPY);
+
+  StateCache::get().bindBuffer(GL_COPY_READ_BUFFER, bufferIndex);
+  glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(size));
+
+  return copyIndex;
+}
+
+void uploadData(GLuint bufferIndex, std::size_t offset, std::size_t size, const void* data) {
+  StateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, bufferIndex);
+  glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+}
+
+/// Reallocates a buffer's storage, keeping its current data.
+/// \param bufferIndex Index of the buffer to be resized.
+/// \param oldSize Size in bytes of the current storage.
+/// \param newSize Size in bytes of the new storage; must be greater than the current one.
+void resizeBuffer(GLuint bufferIndex, std::size_t oldSize, std::size_t newSize) {
+  GLuint copyIndex = (oldSize > 0 ? createTemporaryCopy(bufferIndex, oldSize) : 0);
+
+  StateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, bufferIndex);
+  glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(newSize), nullptr, GL_STATIC_DRAW);
+
+  if (copyIndex == 0)
+    return;
+
+  StateCache::get().bindBuffer(GL_COPY_READ_BUFFER, copyIndex);
+  glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(oldSize));
+
+  StateCache::get().deleteBuffer(copyIndex);
+}
+
+} // namespace
+
+GeometryArena::GeometryArena(const VertexLayout& layout, GLenum indexType, std::size_t vertexCapacity, std::size_t indexCapacity)
+  : m_layout{ layout }, m_indexType{ indexType }, m_vertexAllocator(vertexCapacity), m_indexAllocator(indexCapacity) {
+  if (layout.positionFormat != PositionFormat::FLOAT)
+    throw std::runtime_error("Error: A geometry arena cannot hold quantized positions.");
+
+  if (indexType != GL_UNSIGNED_INT && indexType != GL_UNSIGNED_SHORT)
+    throw std::runtime_error("Error: A geometry arena's indices must be either unsigned ints or unsigned shorts.");
+
+  m_vao.bind();
+  m_vao.getEbo().bind();
+
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(getIndexSize() * indexCapacity), nullptr, GL_STATIC_DRAW);
+
+  m_vbo.bind();
+  glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_layout.computeStride() * vertexCapacity), nullptr, GL_STATIC_DRAW);
+
+  m_vbo.setupAttributes(m_layout);
+
+  m_vbo.unbind();
+  m_vao.unbind();
+}
+
+std::size_t GeometryArena::getMaxGeometryVertexCount() const {
+  return (m_indexType == GL_UNSIGNED_SHORT ? std::size_t(std::numeric_limits<uint16_t>::max()) + 1 : std::numeric_limits<uint32_t>::max());
+}
+
+std::size_t GeometryArena::add(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices) {
+  if (vertices.empty() || indices.empty())
+    throw std::runtime_error("Error: Cannot add an empty geometry to an arena.");
+
+  if (vertices.size() > getMaxGeometryVertexCount())
+    throw std::runtime_error("Error: The geometry has too many vertices to be indexed in the arena.");
+
+  const std::size_t vertexSize = m_layout.computeStride();
+  const std::size_t indexSize  = getIndexSize();
+
+  GeometryRange range;
+  range.vertexCount = vertices.size();
+  range.indexCount  = indices.size();
+  range.firstVertex = allocate(m_vertexAllocator, m_vbo.getIndex(), vertexSize, vertices.size(), true);
+  range.firstIndex  = allocate(m_indexAllocator, m_vao.getEbo().getIndex(), indexSize, indices.size(), false);
+
+  // Positions being stored as is, the bounds are not needed to pack the vertices
+  const std::vector<uint8_t> vertexData = m_layout.packVertices(vertices, AABB(Vec3f(0.f), Vec3f(0.f)));
+  uploadData(m_vbo.getIndex(), range.firstVertex * vertexSize, vertexData.size(), vertexData.data());
+
+  if (m_indexType == GL_UNSIGNED_SHORT) {
+    const std::vector<uint16_t> shortIndices(indices.cbegin(), indices.cend());
+    uploadData(m_vao.getEbo().getIndex(), range.firstIndex * indexSize, shortIndices.size() * indexSize, shortIndices.data());
+  } else {
+    uploadData(m_vao.getEbo().getIndex(), range.firstIndex * indexSize, indices.size() * indexSize, indices.data());
+  }
+
+  if (!m_freeHandles.empty()) {
+    const std::size_t handle = m_freeHandles.back();
+    m_freeHandles.pop_back();
+
+    m_ranges[handle] = range;
+    return handle;
+  }
+
+  m_ranges.emplace_back(range);
+  return m_ranges.size() - 1;
+}
+
+void GeometryArena::remove(std::size_t handle) {
+  GeometryRange& range = m_ranges[handle];
+
+  if (range.vertexCount == 0)
+    throw std::runtime_error("Error: Cannot remove a geometry which is not in the arena.");
+
+  m_vertexAllocator.free(range.firstVertex);
+  m_indexAllocator.free(range.firstIndex);
+
+  // Removed geometries are left empty, so that they can be told apart from the existing ones
+  range = GeometryRange();
+  m_freeHandles.emplace_back(handle);
+}
+
+void GeometryArena::defragment() {
+  defragment(m_vertexAllocator, m_vbo.getIndex(), m_layout.computeStride(), true);
+  defragment(m_indexAllocator, m_vao.getEbo().getIndex(), getIndexSize(), false);
+}
+
+std::size_t GeometryArena::allocate(RangeAllocator& allocator, GLuint bufferIndex, std::size_t elementSize, std::size_t count, bool isVertexBuffer) {
+  const std::size_t offset = allocator.allocate(count);
+
+  if (offset != RangeAllocator::InvalidOffset)
+    return offset;
+
+  // If there is enough space overall, packing the geometries makes it contiguous; otherwise, the buffer is grown enough to fit the new range
+  if (allocator.getFreeSize() >= count) {
+    defragment(allocator, bufferIndex, elementSize, isVertexBuffer);
+  } else {
+    const std::size_t capacity = std::max(allocator.getCapacity() * 2, allocator.getCapacity() + count);
+
+    resizeBuffer(bufferIndex, allocator.getCapacity() * elementSize, capacity * elementSize);
+    allocator.grow(capacity);
+  }
+
+  return allocator.allocate(count);
+}
+
+void GeometryArena::defragment(RangeAllocator& allocator, GLuint bufferIndex, std::size_t elementSize, bool isVertexBuffer) {
+  const std::vector<RangeRelocation> relocations = allocator.defragment();
+
+  if (relocations.empty())
+    return;
+
+  // Ranges may overlap their new location, which cannot be copied within a single buffer; the data is thus read from a copy
+  const std::size_t usedSize = (relocations.back().oldOffset + relocations.back().size) * elementSize;
+  GLuint copyIndex           = createTemporaryCopy(bufferIndex, usedSize);
+
+  StateCache::get().bindBuffer(GL_COPY_READ_BUFFER, copyIndex);
+  StateCache::get().bindBuffer(GL_COPY_WRITE_BUFFER, bufferIndex);
+
+  std::unordered_map<std::size_t, std::size_t> newOffsets;
+  newOffsets.reserve(relocations.size());
+
+  for (const RangeRelocation& relocation : relocations) {
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                        static_cast<GLintptr>(relocation.oldOffset * elementSize),
+                        static_cast<GLintptr>(relocation.newOffset * elementSize),
+                        static_cast<GLsizeiptr>(relocation.size * elementSize));
+    newOffsets.emplace(relocation.oldOffset, relocation.newOffset);
+  }
+
+  StateCache::get().deleteBuffer(copyIndex);
+
+  for (GeometryRange& range : m_ranges) {
+    if (range.vertexCount == 0)
+      continue;
+
+    std::size_t& rangeOffset = (isVertexBuffer ? range.firstVertex : range.firstIndex);
+    const auto newOffsetIter = newOffsets.find(rangeOffset);
+
+    if (newOffsetIter != newOffsets.end())
+      rangeOffset = newOffsetIter->second;
+  }
+}
+
+} // namespace Raz
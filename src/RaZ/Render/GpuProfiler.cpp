@@ -0,0 +1,118 @@
+#include "RaZ/Render/GpuProfiler.hpp"
+
+namespace Raz {
+
+constexpr std::size_t GpuProfiler::FrameLatency;
+
+namespace {
+
+constexpr double NanosecondsToMilliseconds = 1e-6;
+
+} // namespace
+
+double GpuProfiler::computeScopeTime(const std::string& name) const {
+  double duration = 0.0;
+
+  for (const GpuScopeTiming& timing : m_scopeTimings) {
+    if (timing.name == name)
+      duration += timing.duration;
+  }
+
+  return duration;
+}
+
+void GpuProfiler::beginFrame() {
+  FrameQueries& frame = m_frames[m_currentFrameIndex];
+
+  if (frame.isPending) {
+    // Queries complete in order; if the frame's last one is available, all the others are too
+    GLint isAvailable {};
+    glGetQueryObjectiv(frame.queries[frame.endQueryIndex], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+
+    if (isAvailable)
+      readResults(frame);
+    else
+      ++m_skippedFrameCount;
+  }
+
+  frame.usedQueryCount = 0;
+  frame.scopes.clear();
+  frame.isPending = false;
+  m_openedScopes.clear();
+
+  recordTimestamp();
+}
+
+void GpuProfiler::endFrame() {
+  while (!m_openedScopes.empty())
+    endScope();
+
+  FrameQueries& frame = m_frames[m_currentFrameIndex];
+  frame.endQueryIndex = recordTimestamp();
+  frame.isPending     = true;
+
+  m_currentFrameIndex = (m_currentFrameIndex + 1) % FrameLatency;
+}
+
+void GpuProfiler::beginScope(std::string name) {
+  FrameQueries& frame = m_frames[m_currentFrameIndex];
+
+  ScopeQueries scope;
+  scope.name            = std::move(name);
+  scope.depth           = m_openedScopes.size();
+  scope.beginQueryIndex = recordTimestamp();
+
+  m_openedScopes.emplace_back(frame.scopes.size());
+  frame.scopes.emplace_back(std::move(scope));
+}
+
+void GpuProfiler::endScope() {
+  // The frame may have been ended before the scope, which has then already been closed
+  if (m_openedScopes.empty())
+    return;
+
+  m_frames[m_currentFrameIndex].scopes[m_openedScopes.back()].endQueryIndex = recordTimestamp();
+  m_openedScopes.pop_back();
+}
+
+GpuProfiler::~GpuProfiler() {
+  for (FrameQueries& frame : m_frames) {
+    if (!frame.queries.empty())
+      glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+  }
+}
+
+std::size_t GpuProfiler::recordTimestamp() {
+  FrameQueries& frame = m_frames[m_currentFrameIndex];
+
+  if (frame.usedQueryCount == frame.queries.size()) {
+    GLuint query {};
+    glGenQueries(1, &query);
+    frame.queries.emplace_back(query);
+  }
+
+  glQueryCounter(frame.queries[frame.usedQueryCount], GL_TIMESTAMP);
+  return frame.usedQueryCount++;
+}
+
+void GpuProfiler::readResults(const FrameQueries& frame) {
+  std::vector<GLuint64> timestamps(frame.usedQueryCount);
+
+  for (std::size_t queryIndex = 0; queryIndex < frame.usedQueryCount; ++queryIndex)
+    glGetQueryObjectui64v(frame.queries[queryIndex], GL_QUERY_RESULT, &timestamps[queryIndex]);
+
+  m_frameTime = static_cast<double>(timestamps[frame.endQueryIndex] - timestamps.front()) * NanosecondsToMilliseconds;
+
+  m_scopeTimings.clear();
+
+  for (const ScopeQueries& scope : frame.scopes) {
+    GpuScopeTiming timing;
+    timing.name     = scope.name;
+    timing.depth    = scope.depth;
+    timing.duration = static_cast<double>(timestamps[scope.endQueryIndex] - timestamps[scope.beginQueryIndex]) * NanosecondsToMilliseconds;
+
+    m_scopeTimings.emplace_back(std::move(timing));
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,10 @@
+#include "RaZ/Render/GraphicObjects.hpp"
+
+namespace Raz {
+
+void VertexBuffer::setupAttributes(const VertexLayout& layout) const {
+  bind();
+  layout.setupAttributes();
+}
+
+} // namespace Raz
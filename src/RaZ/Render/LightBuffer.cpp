@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <array>
+
+#include "RaZ/Render/LightBuffer.hpp"
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t MinBufferSize = 256;
+
+} // namespace
+
+LightBuffer::LightBuffer() {
+  create(m_lightDataBuffer, GL_RGBA32F);
+  create(m_clusterRangesBuffer, GL_RG32UI);
+  create(m_lightIndicesBuffer, GL_R32UI);
+}
+
+void LightBuffer::setLightCount(std::size_t lightCount) {
+  // Added lights must be uploaded, the buffer possibly holding stale data at their location
+  if (lightCount > m_lightCount) {
+    m_firstChangedLight = std::min(m_firstChangedLight, m_lightCount);
+    m_changedLightEnd   = lightCount;
+  } else {
+    m_changedLightEnd = std::min(m_changedLightEnd, lightCount);
+  }
+
+  m_lightCount = lightCount;
+  m_lightData.resize(lightCount * LightFloatCount);
+}
+
+void LightBuffer::setLight(std::size_t lightIndex, const Light& light, const Vec3f& position) {
+  const bool isDirectional = (light.getType() == LightType::DIRECTIONAL);
+
+  const std::array<float, LightFloatCount> lightData = {{
+    position[0],               position[1],               position[2],               (isDirectional ? 0.f : 1.f),
+    light.getDirection()[0],   light.getDirection()[1],   light.getDirection()[2],   light.getEnergy(),
+    light.getColor()[0],       light.getColor()[1],       light.getColor()[2],       light.getAngle()
+  }};
+
+  const auto storedData = m_lightData.begin() + static_cast<std::ptrdiff_t>(lightIndex * LightFloatCount);
+
+  if (std::equal(lightData.cbegin(), lightData.cend(), storedData))
+    return;
+
+  std::copy(lightData.cbegin(), lightData.cend(), storedData);
+
+  m_firstChangedLight = std::min(m_firstChangedLight, lightIndex);
+  m_changedLightEnd   = std::max(m_changedLightEnd, lightIndex + 1);
+}
+
+void LightBuffer::uploadLights() {
+  if (m_firstChangedLight < m_changedLightEnd) {
+    constexpr std::size_t lightSize = sizeof(float) * LightFloatCount;
+
+    upload(m_lightDataBuffer, m_lightData.data(), m_lightData.size() * sizeof(float),
+           m_firstChangedLight * lightSize, (m_changedLightEnd - m_firstChangedLight) * lightSize);
+  }
+
+  m_firstChangedLight = std::numeric_limits<std::size_t>::max();
+  m_changedLightEnd   = 0;
+}
+
+void LightBuffer::uploadClusters(const LightClusterGrid& clusterGrid) {
+  const std::vector<uint32_t>& clusterRanges = clusterGrid.getClusterRanges();
+  const std::vector<uint32_t>& lightIndices  = clusterGrid.getLightIndices();
+
+  const std::size_t rangesSize  = clusterRanges.size() * sizeof(uint32_t);
+  const std::size_t indicesSize = lightIndices.size() * sizeof(uint32_t);
+
+  upload(m_clusterRangesBuffer, clusterRanges.data(), rangesSize, 0, rangesSize);
+  upload(m_lightIndicesBuffer, lightIndices.data(), indicesSize, 0, indicesSize);
+}
+
+void LightBuffer::initProgram(const ShaderProgram& program) const {
+  program.use();
+  program.sendUniform("uniLightData",     static_cast<int>(LightDataUnit));
+  program.sendUniform("uniClusterRanges", static_cast<int>(ClusterRangesUnit));
+  program.sendUniform("uniLightIndices",  static_cast<int>(LightIndicesUnit));
+}
+
+void LightBuffer::bind() const {
+  StateCache& stateCache = StateCache::get();
+
+  stateCache.bindTexture(GL_TEXTURE_BUFFER, m_lightDataBuffer.textureIndex, LightDataUnit);
+  stateCache.bindTexture(GL_TEXTURE_BUFFER, m_clusterRangesBuffer.textureIndex, ClusterRangesUnit);
+  stateCache.bindTexture(GL_TEXTURE_BUFFER, m_lightIndicesBuffer.textureIndex, LightIndicesUnit);
+}
+
+LightBuffer::~LightBuffer() {
+  destroy(m_lightDataBuffer);
+  destroy(m_clusterRangesBuffer);
+  destroy(m_lightIndicesBuffer);
+}
+
+void LightBuffer::create(BufferTexture& bufferTexture, GLenum format) {
+  // The buffer is given an initial storage, a buffer texture needing one to be complete
+  bufferTexture.capacity = MinBufferSize;
+
+  StateCache& stateCache = StateCache::get();
+
+  glGenBuffers(1, &bufferTexture.bufferIndex);
+  stateCache.bindBuffer(GL_TEXTURE_BUFFER, bufferTexture.bufferIndex);
+  glBufferData(GL_TEXTURE_BUFFER, static_cast<GLsizeiptr>(bufferTexture.capacity), nullptr, GL_DYNAMIC_DRAW);
+
+  glGenTextures(1, &bufferTexture.textureIndex);
+  stateCache.bindTexture(GL_TEXTURE_BUFFER, bufferTexture.textureIndex);
+  glTexBuffer(GL_TEXTURE_BUFFER, format, bufferTexture.bufferIndex);
+
+  stateCache.bindTexture(GL_TEXTURE_BUFFER, 0);
+  stateCache.bindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void LightBuffer::upload(BufferTexture& bufferTexture, const void* data, std::size_t dataSize, std::size_t offset, std::size_t size) {
+  if (size == 0)
+    return;
+
+  StateCache::get().bindBuffer(GL_TEXTURE_BUFFER, bufferTexture.bufferIndex);
+
+  // The texture referencing the buffer itself, reallocating the latter's storage keeps them associated
+  if (dataSize > bufferTexture.capacity) {
+    bufferTexture.capacity = std::max(dataSize, bufferTexture.capacity * 2);
+
+    glBufferData(GL_TEXTURE_BUFFER, static_cast<GLsizeiptr>(bufferTexture.capacity), nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, static_cast<GLsizeiptr>(dataSize), data);
+  } else {
+    glBufferSubData(GL_TEXTURE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), static_cast<const uint8_t*>(data) + offset);
+  }
+
+  StateCache::get().bindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void LightBuffer::destroy(BufferTexture& bufferTexture) {
+  StateCache::get().deleteTexture(bufferTexture.textureIndex);
+  StateCache::get().deleteBuffer(bufferTexture.bufferIndex);
+}
+
+} // namespace Raz
@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "RaZ/Render/LightClusterGrid.hpp"
+
+namespace Raz {
+
+namespace {
+
+/// Computes the range of tiles covered along an axis by a range of normalized device coordinates.
+/// \return True if the range is at least partly on screen, false otherwise.
+bool computeTileRange(float minCoord, float maxCoord, unsigned int tileCount, unsigned int& firstTile, unsigned int& lastTile) {
+  if (maxCoord < -1.f || minCoord > 1.f)
+    return false;
+
+  const auto tileCountF = static_cast<float>(tileCount);
+
+  firstTile = static_cast<unsigned int>(std::max((minCoord * 0.5f + 0.5f) * tileCountF, 0.f));
+  lastTile  = std::min(static_cast<unsigned int>(std::max((maxCoord * 0.5f + 0.5f) * tileCountF, 0.f)), tileCount - 1);
+
+  return true;
+}
+
+} // namespace
+
+LightClusterGrid::LightClusterGrid(unsigned int tileCountX, unsigned int tileCountY, unsigned int sliceCount)
+  : m_tileCountX{ tileCountX }, m_tileCountY{ tileCountY }, m_sliceCount{ sliceCount } {
+  if (tileCountX == 0 || tileCountY == 0 || sliceCount == 0)
+    throw std::runtime_error("Error: A light cluster grid must have at least one cluster along each dimension.");
+
+  m_clusterRanges.resize(getClusterCount() * 2);
+}
+
+unsigned int LightClusterGrid::computeSliceIndex(float depth) const {
+  if (depth <= m_nearPlane)
+    return 0;
+
+  const float sliceIndex = std::log(depth / m_nearPlane) * m_sliceScale;
+  return std::min(static_cast<unsigned int>(sliceIndex), m_sliceCount - 1);
+}
+
+void LightClusterGrid::build(const Mat4f& viewProjMat, float nearPlane, float farPlane, const std::vector<Sphere>& lightVolumes) {
+  m_nearPlane  = nearPlane;
+  m_sliceScale = static_cast<float>(m_sliceCount) / std::log(farPlane / nearPlane);
+
+  m_lightIndices.clear();
+  m_assignments.clear();
+
+  for (std::size_t lightIndex = 0; lightIndex < lightVolumes.size(); ++lightIndex) {
+    if (std::isinf(lightVolumes[lightIndex].getRadius()))
+      m_lightIndices.emplace_back(static_cast<uint32_t>(lightIndex));
+  }
+
+  m_globalLightCount = m_lightIndices.size();
+
+  // The view depth being the projected W coordinate, its range over a sphere is its center's, offset by the radius along the W axis
+  const Vec3f depthAxis({ viewProjMat[3], viewProjMat[7], viewProjMat[11] });
+  const float depthAxisLength = depthAxis.computeLength();
+
+  for (std::size_t lightIndex = 0; lightIndex < lightVolumes.size(); ++lightIndex) {
+    const Vec3f& center = lightVolumes[lightIndex].getCenter();
+    const float radius  = lightVolumes[lightIndex].getRadius();
+
+    if (std::isinf(radius))
+      continue;
+
+    const float centerDepth = center.dot(depthAxis) + viewProjMat[15];
+    const float minDepth    = centerDepth - radius * depthAxisLength;
+    const float maxDepth    = centerDepth + radius * depthAxisLength;
+
+    if (maxDepth < nearPlane || minDepth > farPlane)
+      continue;
+
+    // Projecting the corners of the box enclosing the sphere; if any is behind the camera, the light may cover the whole screen
+    unsigned int firstTileX = 0;
+    unsigned int lastTileX  = m_tileCountX - 1;
+    unsigned int firstTileY = 0;
+    unsigned int lastTileY  = m_tileCountY - 1;
+
+    Vec2f minCoords(std::numeric_limits<float>::max());
+    Vec2f maxCoords(std::numeric_limits<float>::lowest());
+    bool isBehindCamera = false;
+
+    for (uint8_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+      const Vec4f corner({ center[0] + ((cornerIndex & 1) ? radius : -radius),
+                           center[1] + ((cornerIndex & 2) ? radius : -radius),
+                           center[2] + ((cornerIndex & 4) ? radius : -radius),
+                           1.f });
+      const Vec4f projCorner = corner * viewProjMat;
+
+      if (projCorner[3] <= std::numeric_limits<float>::epsilon()) {
+        isBehindCamera = true;
+        break;
+      }
+
+      for (std::size_t axisIndex = 0; axisIndex < 2; ++axisIndex) {
+        minCoords[axisIndex] = std::min(minCoords[axisIndex], projCorner[axisIndex] / projCorner[3]);
+        maxCoords[axisIndex] = std::max(maxCoords[axisIndex], projCorner[axisIndex] / projCorner[3]);
+      }
+    }
+
+    if (!isBehindCamera && (!computeTileRange(minCoords[0], maxCoords[0], m_tileCountX, firstTileX, lastTileX)
+                         || !computeTileRange(minCoords[1], maxCoords[1], m_tileCountY, firstTileY, lastTileY)))
+      continue;
+
+    const unsigned int firstSlice = computeSliceIndex(minDepth);
+    const unsigned int lastSlice  = computeSliceIndex(maxDepth);
+
+    for (unsigned int sliceIndex = firstSlice; sliceIndex <= lastSlice; ++sliceIndex) {
+      for (unsigned int tileY = firstTileY; tileY <= lastTileY; ++tileY) {
+        for (unsigned int tileX = firstTileX; tileX <= lastTileX; ++tileX)
+          m_assignments.emplace_back(static_cast<uint32_t>(computeClusterIndex(tileX, tileY, sliceIndex)), static_cast<uint32_t>(lightIndex));
+      }
+    }
+  }
+
+  // Counting the lights of each cluster, then turning the counts into offsets to scatter the lights' indices
+  std::fill(m_clusterRanges.begin(), m_clusterRanges.end(), 0);
+
+  for (const std::pair<uint32_t, uint32_t>& assignment : m_assignments)
+    ++m_clusterRanges[assignment.first * 2 + 1];
+
+  auto offset = static_cast<uint32_t>(m_globalLightCount);
+
+  for (std::size_t clusterIndex = 0; clusterIndex < getClusterCount(); ++clusterIndex) {
+    m_clusterRanges[clusterIndex * 2] = offset;
+    offset += m_clusterRanges[clusterIndex * 2 + 1];
+
+    // The counts are incremented back while scattering
+    m_clusterRanges[clusterIndex * 2 + 1] = 0;
+  }
+
+  m_lightIndices.resize(offset);
+
+  for (const std::pair<uint32_t, uint32_t>& assignment : m_assignments) {
+    const uint32_t clusterOffset = m_clusterRanges[assignment.first * 2];
+    uint32_t& clusterCount       = m_clusterRanges[assignment.first * 2 + 1];
+    m_lightIndices[clusterOffset + clusterCount++] = assignment.second;
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,32 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "RaZ/Render/LodSelector.hpp"
+
+namespace Raz {
+
+float LodSelector::computeScreenSize(float radius, float distance, float fieldOfView) {
+  if (distance <= radius)
+    return std::numeric_limits<float>::infinity();
+
+  return radius / (distance * std::tan(fieldOfView * 0.5f));
+}
+
+std::size_t LodSelector::select(float screenSize, std::size_t currentLod, std::size_t lodCount) const {
+  if (lodCount == 0)
+    return 0;
+
+  const std::size_t maxLod = std::min(lodCount - 1, m_screenSizeThresholds.size());
+  std::size_t lod          = std::min(currentLod, maxLod);
+
+  while (lod < maxLod && screenSize < m_screenSizeThresholds[lod] * (1.f - m_hysteresis))
+    ++lod;
+
+  while (lod > 0 && screenSize > m_screenSizeThresholds[lod - 1] * (1.f + m_hysteresis))
+    --lod;
+
+  return lod;
+}
+
+} // namespace Raz
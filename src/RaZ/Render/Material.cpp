@@ -26,6 +26,42 @@ std::unique_ptr<MaterialCookTorrance> Material::recoverMaterial(MaterialPreset p
   return MaterialCookTorrance::create(materialParams.first, materialParams.second, roughnessFactor);
 }
 
+void Material::initParametersBlock(const ShaderProgram& program) {
+  const GLuint blockIndex = glGetUniformBlockIndex(program.getIndex(), "uboMaterialParams");
+
+  // Programs not using the material's parameters do not have the block
+  if (blockIndex != GL_INVALID_INDEX)
+    glUniformBlockBinding(program.getIndex(), blockIndex, ParametersBindingIndex);
+}
+
+void Material::bindTexture(const Texture& texture, uint8_t unit, TextureBindings* textureBindings) {
+  if (textureBindings) {
+    textureBindings->bind(texture, unit);
+    return;
+  }
+
+  Texture::activate(unit);
+  texture.bind();
+}
+
+void Material::bindParameters(const void* parameters, std::size_t size) const {
+  if (m_parametersUbo == nullptr) {
+    m_parametersUbo = std::make_unique<UniformBuffer>();
+
+    m_parametersUbo->bind();
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW);
+  }
+
+  if (!m_areParametersUpToDate) {
+    m_parametersUbo->bind();
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(size), parameters);
+
+    m_areParametersUpToDate = true;
+  }
+
+  StateCache::get().bindBufferRange(GL_UNIFORM_BUFFER, ParametersBindingIndex, m_parametersUbo->getIndex(), 0, static_cast<GLsizeiptr>(size));
+}
+
 void MaterialStandard::initTextures(const ShaderProgram& program) const {
   const std::string locationBase = "uniMaterial.";
 
@@ -42,40 +78,34 @@ void MaterialStandard::initTextures(const ShaderProgram& program) const {
   program.sendUniform(emissiveMapLocation,     3);
   program.sendUniform(transparencyMapLocation, 4);
   program.sendUniform(bumpMapLocation,         5);
-}
 
-void MaterialStandard::bindAttributes(const ShaderProgram& program) const {
-  const std::string locationBase = "uniMaterial.";
-
-  const std::string ambientLocation      = locationBase + "ambient";
-  const std::string diffuseLocation      = locationBase + "diffuse";
-  const std::string specularLocation     = locationBase + "specular";
-  const std::string emissiveLocation     = locationBase + "emissive";
-  const std::string transparencyLocation = locationBase + "transparency";
-
-  program.sendUniform(ambientLocation,      m_ambient);
-  program.sendUniform(diffuseLocation,      m_diffuse);
-  program.sendUniform(specularLocation,     m_specular);
-  program.sendUniform(emissiveLocation,     m_emissive);
-  program.sendUniform(transparencyLocation, m_transparency);
-
-  Texture::activate(0);
-  m_ambientMap->bind();
-
-  Texture::activate(1);
-  m_diffuseMap->bind();
+  initParametersBlock(program);
+}
 
-  Texture::activate(2);
-  m_specularMap->bind();
+void MaterialStandard::bindAttributes(const ShaderProgram&, TextureBindings* textureBindings) const {
+  // Parameters laid out following the std140 rules, each vec3 being aligned on 16 bytes
+  struct ParametersBlock {
+    Vec3f ambient;
+    float ambientPadding;
+    Vec3f diffuse;
+    float diffusePadding;
+    Vec3f specular;
+    float specularPadding;
+    Vec3f emissive;
+    float transparency;
+  };
 
-  Texture::activate(3);
-  m_emissiveMap->bind();
+  static_assert(sizeof(ParametersBlock) == 64, "Error: The standard material's parameters must follow the std140 layout.");
 
-  Texture::activate(4);
-  m_transparencyMap->bind();
+  const ParametersBlock parameters { m_ambient, 0.f, m_diffuse, 0.f, m_specular, 0.f, m_emissive, m_transparency };
+  bindParameters(&parameters, sizeof(parameters));
 
-  Texture::activate(5);
-  m_bumpMap->bind();
+  bindTexture(*m_ambientMap, 0, textureBindings);
+  bindTexture(*m_diffuseMap, 1, textureBindings);
+  bindTexture(*m_specularMap, 2, textureBindings);
+  bindTexture(*m_emissiveMap, 3, textureBindings);
+  bindTexture(*m_transparencyMap, 4, textureBindings);
+  bindTexture(*m_bumpMap, 5, textureBindings);
 }
 
 void MaterialCookTorrance::initTextures(const ShaderProgram& program) const {
@@ -92,33 +122,29 @@ void MaterialCookTorrance::initTextures(const ShaderProgram& program) const {
   program.sendUniform(metallicMapLocation,         2);
   program.sendUniform(roughnessMapLocation,        3);
   program.sendUniform(ambientOcclusionMapLocation, 4);
-}
 
-void MaterialCookTorrance::bindAttributes(const ShaderProgram& program) const {
-  const std::string locationBase = "uniMaterial.";
-
-  const std::string baseColorLocation       = locationBase + "baseColor";
-  const std::string metallicFactorLocation  = locationBase + "metallicFactor";
-  const std::string roughnessFactorLocation = locationBase + "roughnessFactor";
-
-  program.sendUniform(baseColorLocation,       m_baseColor);
-  program.sendUniform(metallicFactorLocation,  m_metallicFactor);
-  program.sendUniform(roughnessFactorLocation, m_roughnessFactor);
-
-  Texture::activate(0);
-  m_albedoMap->bind();
+  initParametersBlock(program);
+}
 
-  Texture::activate(1);
-  m_normalMap->bind();
+void MaterialCookTorrance::bindAttributes(const ShaderProgram&, TextureBindings* textureBindings) const {
+  // Parameters laid out following the std140 rules, the block's size being rounded up to a multiple of 16 bytes
+  struct ParametersBlock {
+    Vec3f baseColor;
+    float metallicFactor;
+    float roughnessFactor;
+    float padding[3];
+  };
 
-  Texture::activate(2);
-  m_metallicMap->bind();
+  static_assert(sizeof(ParametersBlock) == 32, "Error: The Cook-Torrance material's parameters must follow the std140 layout.");
 
-  Texture::activate(3);
-  m_roughnessMap->bind();
+  const ParametersBlock parameters { m_baseColor, m_metallicFactor, m_roughnessFactor, { 0.f, 0.f, 0.f } };
+  bindParameters(&parameters, sizeof(parameters));
 
-  Texture::activate(4);
-  m_ambientOcclusionMap->bind();
+  bindTexture(*m_albedoMap, 0, textureBindings);
+  bindTexture(*m_normalMap, 1, textureBindings);
+  bindTexture(*m_metallicMap, 2, textureBindings);
+  bindTexture(*m_roughnessMap, 3, textureBindings);
+  bindTexture(*m_ambientOcclusionMap, 4, textureBindings);
 }
 
 } // namespace Raz
@@ -6,7 +6,7 @@
 
 namespace Raz {
 
-void Mesh::import(const std::string& filePath) {
+void Mesh::import(const std::string& filePath, bool optimizeGeometry, std::size_t lodCount) {
   // Resetting the mesh to an empty state before importing
   m_submeshes.clear();
   m_submeshes.push_back(Submesh::create());
@@ -29,6 +29,15 @@ void Mesh::import(const std::string& filePath) {
 #endif
     else
       throw std::runtime_error("Error: '" + format + "' format is not supported");
+
+    if (optimizeGeometry)
+      optimize();
+
+    // Levels of detail must be generated last, as optimizing would remove them
+    if (lodCount > 0)
+      generateLods(lodCount);
+
+    computeBounds();
   } else {
     throw std::runtime_error("Error: Couldn't open the file '" + filePath + "'");
   }
@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "RaZ/Render/MeshOptimizer.hpp"
+
+namespace Raz {
+
+namespace MeshOptimizer {
+
+namespace {
+
+constexpr unsigned int InvalidIndex = std::numeric_limits<unsigned int>::max();
+
+/// Simulation of a FIFO post-transform vertex cache, in which vertices are not moved back to the front when they are hit.
+class VertexCache {
+public:
+  VertexCache(std::size_t vertexCount, std::size_t cacheSize)
+    : m_cacheSize{ cacheSize }, m_timestamp{ cacheSize + 1 }, m_entryTimestamps(vertexCount, 0) {}
+
+  /// Checks if a vertex is in the cache, adding it otherwise.
+  /// \param vertexIndex Index of the vertex to be accessed.
+  /// \return True if the vertex had to be added, false if it was already in the cache.
+  bool access(unsigned int vertexIndex) {
+    if (m_timestamp - m_entryTimestamps[vertexIndex] <= m_cacheSize)
+      return false;
+
+    m_entryTimestamps[vertexIndex] = m_timestamp++;
+    return true;
+  }
+
+  /// Evicts all the vertices from the cache.
+  void flush() { m_timestamp += m_cacheSize + 1; }
+
+private:
+  std::size_t m_cacheSize {};
+  std::size_t m_timestamp {};
+  std::vector<std::size_t> m_entryTimestamps {};
+};
+
+/// Triangles referencing each vertex, stored contiguously for all vertices.
+struct VertexTriangles {
+  VertexTriangles(const std::vector<unsigned int>& indices, std::size_t vertexCount) : offsets(vertexCount + 1, 0), triangles(indices.size()) {
+    for (const unsigned int index : indices)
+      ++offsets[index + 1];
+
+    std::partial_sum(offsets.cbegin(), offsets.cend(), offsets.begin());
+
+    std::vector<std::size_t> fillCounts(vertexCount, 0);
+
+    for (std::size_t index = 0; index < indices.size(); ++index) {
+      const unsigned int vertexIndex = indices[index];
+      triangles[offsets[vertexIndex] + fillCounts[vertexIndex]++] = static_cast<unsigned int>(index / 3);
+    }
+  }
+
+  std::vector<std::size_t> offsets {};
+  std::vector<unsigned int> triangles {};
+};
+
+} // namespace
+
+float computeAcmr(const std::vector<unsigned int>& indices, std::size_t vertexCount, std::size_t cacheSize) {
+  if (indices.size() < 3)
+    return 0.f;
+
+  VertexCache cache(vertexCount, cacheSize);
+  std::size_t missCount = 0;
+
+  for (const unsigned int index : indices)
+    missCount += cache.access(index);
+
+  return static_cast<float>(missCount) / static_cast<float>(indices.size() / 3);
+}
+
+void optimizeVertexCache(std::vector<unsigned int>& indices, std::size_t vertexCount, std::size_t cacheSize) {
+  const std::size_t triangleCount = indices.size() / 3;
+
+  if (triangleCount == 0)
+    return;
+
+  const VertexTriangles vertexTriangles(indices, vertexCount);
+
+  std::vector<unsigned int> liveTriangleCounts(vertexCount);
+  for (std::size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+    liveTriangleCounts[vertexIndex] = static_cast<unsigned int>(vertexTriangles.offsets[vertexIndex + 1] - vertexTriangles.offsets[vertexIndex]);
+
+  // Time at which each vertex has entered the cache, a vertex being in it if it entered less than cacheSize insertions ago
+  std::vector<std::size_t> cacheTimestamps(vertexCount, 0);
+  std::size_t timestamp = cacheSize + 1;
+
+  std::vector<bool> emittedTriangles(triangleCount, false);
+  std::vector<unsigned int> deadEndStack;
+  std::vector<unsigned int> candidates;
+
+  std::vector<unsigned int> newIndices;
+  newIndices.reserve(indices.size());
+
+  // Vertices are browsed in order when no other one can be fanned around
+  std::size_t cursor = 0;
+  unsigned int fanningVertex = 0;
+
+  while (fanningVertex != InvalidIndex) {
+    candidates.clear();
+
+    for (std::size_t triIndex = vertexTriangles.offsets[fanningVertex]; triIndex < vertexTriangles.offsets[fanningVertex + 1]; ++triIndex) {
+      const unsigned int triangle = vertexTriangles.triangles[triIndex];
+
+      if (emittedTriangles[triangle])
+        continue;
+
+      emittedTriangles[triangle] = true;
+
+      for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+        const unsigned int vertexIndex = indices[triangle * 3 + cornerIndex];
+
+        newIndices.emplace_back(vertexIndex);
+        deadEndStack.emplace_back(vertexIndex);
+        candidates.emplace_back(vertexIndex);
+        --liveTriangleCounts[vertexIndex];
+
+        if (timestamp - cacheTimestamps[vertexIndex] > cacheSize)
+          cacheTimestamps[vertexIndex] = timestamp++;
+      }
+    }
+
+    // The next vertex is the candidate which will stay the longest in the cache while its remaining triangles are emitted
+    unsigned int nextVertex = InvalidIndex;
+    std::size_t bestPriority = 0;
+
+    for (const unsigned int candidate : candidates) {
+      if (liveTriangleCounts[candidate] == 0)
+        continue;
+
+      std::size_t priority = 0;
+
+      if (timestamp - cacheTimestamps[candidate] + 2 * liveTriangleCounts[candidate] <= cacheSize)
+        priority = timestamp - cacheTimestamps[candidate];
+
+      if (nextVertex == InvalidIndex || priority > bestPriority) {
+        nextVertex   = candidate;
+        bestPriority = priority;
+      }
+    }
+
+    // In a dead end, the most recently used vertices still having triangles are tried first, then the next ones in order
+    while (nextVertex == InvalidIndex && !deadEndStack.empty()) {
+      const unsigned int vertexIndex = deadEndStack.back();
+      deadEndStack.pop_back();
+
+      if (liveTriangleCounts[vertexIndex] > 0)
+        nextVertex = vertexIndex;
+    }
+
+    while (nextVertex == InvalidIndex && cursor < vertexCount) {
+      if (liveTriangleCounts[cursor] > 0)
+        nextVertex = static_cast<unsigned int>(cursor);
+
+      ++cursor;
+    }
+
+    fanningVertex = nextVertex;
+  }
+
+  indices = std::move(newIndices);
+}
+
+void optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices, float threshold, std::size_t cacheSize) {
+  const std::size_t triangleCount = indices.size() / 3;
+
+  if (triangleCount < 2)
+    return;
+
+  VertexCache cache(vertices.size(), cacheSize);
+
+  const auto countTriangleMisses = [&indices, &cache] (std::size_t triangle) {
+    return static_cast<std::size_t>(cache.access(indices[triangle * 3]))
+         + cache.access(indices[triangle * 3 + 1])
+         + cache.access(indices[triangle * 3 + 2]);
+  };
+
+  // Hard boundaries are placed on triangles missing all their vertices, which would not benefit from the previous ones' anyway
+  // The first triangle always opens a cluster, even if some of its vertices are repeated
+  std::vector<std::size_t> hardBoundaries = { 0 };
+
+  for (std::size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    if (countTriangleMisses(triangle) == 3 && triangle > 0)
+      hardBoundaries.emplace_back(triangle);
+  }
+
+  hardBoundaries.emplace_back(triangleCount);
+
+  // Each hard cluster is further split where its ACMR so far, restarting with an empty cache, stays close enough to its overall one
+  std::vector<std::size_t> clusterStarts;
+
+  for (std::size_t hardIndex = 0; hardIndex + 1 < hardBoundaries.size(); ++hardIndex) {
+    const std::size_t start = hardBoundaries[hardIndex];
+    const std::size_t end   = hardBoundaries[hardIndex + 1];
+
+    cache.flush();
+    std::size_t hardMissCount = 0;
+
+    for (std::size_t triangle = start; triangle < end; ++triangle)
+      hardMissCount += countTriangleMisses(triangle);
+
+    const float maxAcmr = threshold * static_cast<float>(hardMissCount) / static_cast<float>(end - start);
+
+    cache.flush();
+    clusterStarts.emplace_back(start);
+
+    std::size_t clusterMissCount     = 0;
+    std::size_t clusterTriangleCount = 0;
+
+    for (std::size_t triangle = start; triangle < end; ++triangle) {
+      clusterMissCount += countTriangleMisses(triangle);
+      ++clusterTriangleCount;
+
+      if (triangle + 1 < end && static_cast<float>(clusterMissCount) / static_cast<float>(clusterTriangleCount) <= maxAcmr) {
+        clusterStarts.emplace_back(triangle + 1);
+
+        cache.flush();
+        clusterMissCount     = 0;
+        clusterTriangleCount = 0;
+      }
+    }
+  }
+
+  clusterStarts.emplace_back(triangleCount);
+
+  // Clusters facing away from the mesh's center are sorted first, as they are the most likely to occlude the others
+  const auto computeTriangleData = [&indices, &vertices] (std::size_t triangle, Vec3f& centroid, Vec3f& areaNormal) {
+    const Vec3f& pos1 = vertices[indices[triangle * 3]].position;
+    const Vec3f& pos2 = vertices[indices[triangle * 3 + 1]].position;
+    const Vec3f& pos3 = vertices[indices[triangle * 3 + 2]].position;
+
+    centroid   = (pos1 + pos2 + pos3) / 3.f;
+    areaNormal = (pos2 - pos1).cross(pos3 - pos1);
+  };
+
+  Vec3f meshCentroid;
+  float meshArea = 0.f;
+
+  for (std::size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    Vec3f centroid;
+    Vec3f areaNormal;
+    computeTriangleData(triangle, centroid, areaNormal);
+
+    const float area = areaNormal.computeLength();
+    meshCentroid += centroid * area;
+    meshArea     += area;
+  }
+
+  if (meshArea > 0.f)
+    meshCentroid /= meshArea;
+
+  const std::size_t clusterCount = clusterStarts.size() - 1;
+  std::vector<float> clusterSortKeys(clusterCount);
+
+  for (std::size_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex) {
+    Vec3f clusterCentroid;
+    Vec3f clusterNormal;
+    float clusterArea = 0.f;
+
+    for (std::size_t triangle = clusterStarts[clusterIndex]; triangle < clusterStarts[clusterIndex + 1]; ++triangle) {
+      Vec3f centroid;
+      Vec3f areaNormal;
+      computeTriangleData(triangle, centroid, areaNormal);
+
+      const float area = areaNormal.computeLength();
+      clusterCentroid += centroid * area;
+      clusterNormal   += areaNormal;
+      clusterArea     += area;
+    }
+
+    const float normalLength = clusterNormal.computeLength();
+
+    if (clusterArea <= 0.f || normalLength <= 0.f)
+      continue;
+
+    clusterCentroid /= clusterArea;
+    clusterSortKeys[clusterIndex] = (clusterCentroid - meshCentroid).dot(clusterNormal / normalLength);
+  }
+
+  std::vector<std::size_t> clusterOrder(clusterCount);
+  std::iota(clusterOrder.begin(), clusterOrder.end(), 0);
+  std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&clusterSortKeys] (std::size_t clusterIndex1, std::size_t clusterIndex2) {
+    return (clusterSortKeys[clusterIndex1] > clusterSortKeys[clusterIndex2]);
+  });
+
+  std::vector<unsigned int> newIndices;
+  newIndices.reserve(indices.size());
+
+  for (const std::size_t clusterIndex : clusterOrder) {
+    newIndices.insert(newIndices.end(),
+                      indices.cbegin() + static_cast<std::ptrdiff_t>(clusterStarts[clusterIndex] * 3),
+                      indices.cbegin() + static_cast<std::ptrdiff_t>(clusterStarts[clusterIndex + 1] * 3));
+  }
+
+  indices = std::move(newIndices);
+}
+
+void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
+  std::vector<unsigned int> remap(vertices.size(), InvalidIndex);
+  std::vector<Vertex> newVertices;
+  newVertices.reserve(vertices.size());
+
+  for (unsigned int& index : indices) {
+    if (remap[index] == InvalidIndex) {
+      remap[index] = static_cast<unsigned int>(newVertices.size());
+      newVertices.emplace_back(vertices[index]);
+    }
+
+    index = remap[index];
+  }
+
+  vertices = std::move(newVertices);
+}
+
+} // namespace MeshOptimizer
+
+} // namespace Raz
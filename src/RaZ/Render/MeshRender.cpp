@@ -58,34 +58,57 @@ void Mesh::setMaterial(MaterialPreset materialPreset, float roughnessFactor) {
   }
 }
 
-void Mesh::load() const {
+void Mesh::load(const VertexLayout& layout) const {
   for (const auto& submesh : m_submeshes)
-    submesh->load();
+    submesh->load(layout);
 }
 
-void Mesh::load(const ShaderProgram& program) const {
-  load();
+void Mesh::load(const ShaderProgram& program, const VertexLayout& layout) const {
+  load(layout);
 
   for (const auto& material : m_materials)
     material->initTextures(program);
 }
 
+void Mesh::load(GeometryArena& arena) const {
+  for (const auto& submesh : m_submeshes)
+    submesh->load(arena);
+}
+
+void Mesh::load(const ShaderProgram& program, GeometryArena& arena) const {
+  load(arena);
+
+  for (const auto& material : m_materials)
+    material->initTextures(program);
+}
+
+void Mesh::unload() const {
+  for (const auto& submesh : m_submeshes)
+    submesh->unload();
+}
+
 void Mesh::draw() const {
   for (const auto& submesh : m_submeshes)
     submesh->draw();
 }
 
 void Mesh::draw(const ShaderProgram& program) const {
-  for (const auto& submesh : m_submeshes) {
-    if (!m_materials.empty()) {
-      const auto& material = m_materials[submesh->getMaterialIndex()];
+  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex)
+    drawSubmesh(submeshIndex, program);
+}
 
-      if (material)
-        material->bindAttributes(program);
-    }
+void Mesh::drawSubmesh(std::size_t submeshIndex, const ShaderProgram& program) const {
+  const SubmeshPtr& submesh = m_submeshes[submeshIndex];
 
-    submesh->draw();
+  if (!m_materials.empty()) {
+    const auto& material = m_materials[submesh->getMaterialIndex()];
+
+    if (material)
+      material->bindAttributes(program);
   }
+
+  submesh->sendPositionDequantization(program);
+  submesh->draw();
 }
 
 } // namespace Raz
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <limits>
+
 #include "RaZ/Render/Mesh.hpp"
 
 namespace Raz {
@@ -40,6 +43,7 @@ Mesh::Mesh(const Triangle& triangle) : Mesh() {
   indices[1] = 0;
   indices[2] = 2;
 
+  computeBounds();
   load();
 }
 
@@ -91,6 +95,7 @@ Mesh::Mesh(const Quad& quad) : Mesh() {
   indices[4] = 2;
   indices[5] = 3;
 
+  computeBounds();
   load();
 }
 
@@ -215,7 +220,86 @@ Mesh::Mesh(const AABB& box) : Mesh() {
   indices[34] = 6;
   indices[35] = 2;
 
+  computeBounds();
   load();
 }
 
+void Mesh::computeBounds() {
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+  bool hasVertices = false;
+
+  for (const SubmeshPtr& submesh : m_submeshes) {
+    submesh->computeBounds();
+
+    // Empty submeshes' bounds are null, and must not be included
+    if (submesh->getVertexCount() == 0)
+      continue;
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      minPos[axisIndex] = std::min(minPos[axisIndex], submesh->getBoundingBox().getLeftBottomBackPos()[axisIndex]);
+      maxPos[axisIndex] = std::max(maxPos[axisIndex], submesh->getBoundingBox().getRightTopFrontPos()[axisIndex]);
+    }
+
+    hasVertices = true;
+  }
+
+  if (!hasVertices) {
+    m_boundingBox    = AABB(Vec3f(0.f), Vec3f(0.f));
+    m_boundingSphere = Sphere(Vec3f(0.f), 0.f);
+    return;
+  }
+
+  m_boundingBox = AABB(maxPos, minPos);
+
+  // The mesh's sphere is centered on its box, enclosing all the submeshes' spheres
+  const Vec3f centroid = m_boundingBox.computeCentroid();
+  float radius = 0.f;
+
+  for (const SubmeshPtr& submesh : m_submeshes) {
+    if (submesh->getVertexCount() == 0)
+      continue;
+
+    const Sphere& submeshSphere = submesh->getBoundingSphere();
+    radius = std::max(radius, (submeshSphere.getCenter() - centroid).computeLength() + submeshSphere.getRadius());
+  }
+
+  m_boundingSphere = Sphere(centroid, radius);
+}
+
+void Mesh::computeBvh() {
+  for (const SubmeshPtr& submesh : m_submeshes)
+    submesh->computeBvh();
+}
+
+void Mesh::optimize(float overdrawThreshold) {
+  for (const SubmeshPtr& submesh : m_submeshes)
+    submesh->optimize(overdrawThreshold);
+}
+
+void Mesh::generateLods(std::size_t lodCount, float reductionRatio, float maxError) {
+  for (const SubmeshPtr& submesh : m_submeshes)
+    submesh->generateLods(lodCount, reductionRatio, maxError);
+}
+
+bool Mesh::intersects(const Ray& ray, RayHit* hit, float maxDistance) const {
+  RayHit closestHit;
+  bool hasHit = false;
+
+  for (std::size_t submeshIndex = 0; submeshIndex < m_submeshes.size(); ++submeshIndex) {
+    if (!m_submeshes[submeshIndex]->intersects(ray, &closestHit, maxDistance))
+      continue;
+
+    // Each submesh hit is necessarily closer than the previous ones, since the maximum distance is lowered on every hit
+    closestHit.submeshIndex = submeshIndex;
+    maxDistance = closestHit.distance;
+    hasHit = true;
+  }
+
+  if (hasHit && hit)
+    *hit = closestHit;
+
+  return hasHit;
+}
+
 } // namespace Raz
@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+
+#include "RaZ/Render/MeshSimplifier.hpp"
+
+namespace Raz {
+
+namespace MeshSimplifier {
+
+namespace {
+
+/// Sum of the squared distances to a set of weighted planes, stored as a symmetric 4x4 matrix.
+struct Quadric {
+  void addPlane(const Vec3f& normal, float distance, float weight) {
+    const double normX = normal[0];
+    const double normY = normal[1];
+    const double normZ = normal[2];
+    const double dist  = distance;
+
+    xx += weight * normX * normX;
+    xy += weight * normX * normY;
+    xz += weight * normX * normZ;
+    yy += weight * normY * normY;
+    yz += weight * normY * normZ;
+    zz += weight * normZ * normZ;
+    xw += weight * normX * dist;
+    yw += weight * normY * dist;
+    zw += weight * normZ * dist;
+    ww += weight * dist * dist;
+    totalWeight += weight;
+  }
+
+  /// Computes the weighted average of the squared distances from a point to the planes.
+  double computeError(const Vec3f& point) const {
+    if (totalWeight <= 0.0)
+      return 0.0;
+
+    const double posX = point[0];
+    const double posY = point[1];
+    const double posZ = point[2];
+
+    const double error = posX * posX * xx + posY * posY * yy + posZ * posZ * zz
+                       + 2.0 * (posX * posY * xy + posX * posZ * xz + posY * posZ * yz)
+                       + 2.0 * (posX * xw + posY * yw + posZ * zw)
+                       + ww;
+
+    return std::abs(error) / totalWeight;
+  }
+
+  Quadric& operator+=(const Quadric& quadric) {
+    xx += quadric.xx; xy += quadric.xy; xz += quadric.xz;
+    yy += quadric.yy; yz += quadric.yz; zz += quadric.zz;
+    xw += quadric.xw; yw += quadric.yw; zw += quadric.zw;
+    ww += quadric.ww;
+    totalWeight += quadric.totalWeight;
+
+    return *this;
+  }
+
+  double xx {}, xy {}, xz {}, yy {}, yz {}, zz {};
+  double xw {}, yw {}, zw {}, ww {};
+  double totalWeight {};
+};
+
+struct Collapse {
+  unsigned int sourceIndex {};
+  unsigned int targetIndex {};
+  double error {};
+};
+
+/// Recovers for each vertex the index of the first vertex sharing its exact position.
+std::vector<unsigned int> computePositionIndices(const std::vector<Vertex>& vertices) {
+  std::vector<unsigned int> sortedIndices(vertices.size());
+  std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+
+  const auto isLess = [&vertices] (unsigned int index1, unsigned int index2) {
+    const Vec3f& pos1 = vertices[index1].position;
+    const Vec3f& pos2 = vertices[index2].position;
+    return std::tie(pos1[0], pos1[1], pos1[2], index1) < std::tie(pos2[0], pos2[1], pos2[2], index2);
+  };
+  std::sort(sortedIndices.begin(), sortedIndices.end(), isLess);
+
+  std::vector<unsigned int> positionIndices(vertices.size());
+
+  for (std::size_t sortedIndex = 0; sortedIndex < sortedIndices.size(); ++sortedIndex) {
+    const unsigned int vertexIndex = sortedIndices[sortedIndex];
+    const bool isDuplicate         = (sortedIndex > 0
+                                   && vertices[sortedIndices[sortedIndex - 1]].position[0] == vertices[vertexIndex].position[0]
+                                   && vertices[sortedIndices[sortedIndex - 1]].position[1] == vertices[vertexIndex].position[1]
+                                   && vertices[sortedIndices[sortedIndex - 1]].position[2] == vertices[vertexIndex].position[2]);
+
+    positionIndices[vertexIndex] = (isDuplicate ? positionIndices[sortedIndices[sortedIndex - 1]] : vertexIndex);
+  }
+
+  return positionIndices;
+}
+
+Vec3f computeAreaNormal(const Vec3f& pos1, const Vec3f& pos2, const Vec3f& pos3) {
+  return (pos2 - pos1).cross(pos3 - pos1);
+}
+
+} // namespace
+
+std::vector<unsigned int> simplify(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                                   std::size_t targetIndexCount, float maxError, float* resultError) {
+  std::vector<unsigned int> result = indices;
+
+  if (resultError)
+    *resultError = 0.f;
+
+  if (vertices.empty() || result.size() <= targetIndexCount)
+    return result;
+
+  const std::vector<unsigned int> positionIndices = computePositionIndices(vertices);
+  std::vector<bool> lockedPositions(vertices.size(), false);
+
+  // Seam vertices share their position with others
+  for (std::size_t vertexIndex = 0; vertexIndex < vertices.size(); ++vertexIndex) {
+    if (positionIndices[vertexIndex] != vertexIndex)
+      lockedPositions[positionIndices[vertexIndex]] = true;
+  }
+
+  // Border & non-manifold edges, identified by their positions so that seams are not mistaken for borders, have other than 2 triangles
+  std::unordered_map<uint64_t, unsigned int> edgeTriangleCounts;
+
+  const auto computeEdgeKey = [&positionIndices] (unsigned int vertexIndex1, unsigned int vertexIndex2) {
+    const uint64_t posIndex1 = positionIndices[vertexIndex1];
+    const uint64_t posIndex2 = positionIndices[vertexIndex2];
+    return (std::min(posIndex1, posIndex2) << 32) | std::max(posIndex1, posIndex2);
+  };
+
+  for (std::size_t index = 0; index < result.size(); index += 3) {
+    for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex)
+      ++edgeTriangleCounts[computeEdgeKey(result[index + cornerIndex], result[index + (cornerIndex + 1) % 3])];
+  }
+
+  for (const std::pair<const uint64_t, unsigned int>& edge : edgeTriangleCounts) {
+    if (edge.second == 2)
+      continue;
+
+    lockedPositions[edge.first >> 32]         = true;
+    lockedPositions[edge.first & 0xFFFFFFFFu] = true;
+  }
+
+  // Each vertex's quadric holds the planes of the triangles around it
+  std::vector<Quadric> quadrics(vertices.size());
+
+  for (std::size_t index = 0; index < result.size(); index += 3) {
+    const Vec3f& pos1 = vertices[result[index]].position;
+    Vec3f normal      = computeAreaNormal(pos1, vertices[result[index + 1]].position, vertices[result[index + 2]].position);
+    const float area  = normal.computeLength();
+
+    if (area <= 0.f)
+      continue;
+
+    normal /= area;
+
+    for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex)
+      quadrics[result[index + cornerIndex]].addPlane(normal, -normal.dot(pos1), area * 0.5f);
+  }
+
+  Vec3f minPos = vertices.front().position;
+  Vec3f maxPos = vertices.front().position;
+
+  for (const Vertex& vertex : vertices) {
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      minPos[axisIndex] = std::min(minPos[axisIndex], vertex.position[axisIndex]);
+      maxPos[axisIndex] = std::max(maxPos[axisIndex], vertex.position[axisIndex]);
+    }
+  }
+
+  const Vec3f extent    = maxPos - minPos;
+  const double scale    = std::max({ extent[0], extent[1], extent[2], std::numeric_limits<float>::epsilon() });
+  const double maxSqErr = (maxError * scale) * (maxError * scale);
+  double resultSqError  = 0.0;
+
+  std::vector<std::size_t> triangleOffsets;
+  std::vector<unsigned int> vertexTriangles;
+  std::vector<Collapse> collapses;
+  std::vector<bool> touchedVertices;
+
+  // Collapses are made in passes, each vertex being changed at most once per pass so that the errors stay valid
+  while (result.size() > targetIndexCount) {
+    // Triangles around each vertex, stored contiguously
+    triangleOffsets.assign(vertices.size() + 1, 0);
+
+    for (const unsigned int index : result)
+      ++triangleOffsets[index + 1];
+
+    std::partial_sum(triangleOffsets.cbegin(), triangleOffsets.cend(), triangleOffsets.begin());
+    vertexTriangles.resize(result.size());
+
+    {
+      std::vector<std::size_t> fillOffsets(triangleOffsets.cbegin(), triangleOffsets.cend() - 1);
+
+      for (std::size_t index = 0; index < result.size(); ++index)
+        vertexTriangles[fillOffsets[result[index]]++] = static_cast<unsigned int>(index / 3);
+    }
+
+    collapses.clear();
+
+    for (std::size_t index = 0; index < result.size(); index += 3) {
+      for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+        const unsigned int vertexIndex1 = result[index + cornerIndex];
+        const unsigned int vertexIndex2 = result[index + (cornerIndex + 1) % 3];
+
+        for (const std::pair<unsigned int, unsigned int>& edge : { std::make_pair(vertexIndex1, vertexIndex2),
+                                                                   std::make_pair(vertexIndex2, vertexIndex1) }) {
+          if (lockedPositions[positionIndices[edge.first]])
+            continue;
+
+          Quadric quadric = quadrics[edge.first];
+          quadric        += quadrics[edge.second];
+
+          collapses.push_back({ edge.first, edge.second, quadric.computeError(vertices[edge.second].position) });
+        }
+      }
+    }
+
+    if (collapses.empty())
+      break;
+
+    std::sort(collapses.begin(), collapses.end(), [] (const Collapse& collapse1, const Collapse& collapse2) {
+      return (collapse1.error < collapse2.error);
+    });
+
+    touchedVertices.assign(vertices.size(), false);
+
+    // Each collapse removes about 2 triangles
+    const std::size_t neededCollapseCount = (result.size() - targetIndexCount) / 6 + 1;
+    std::size_t collapseCount = 0;
+
+    for (const Collapse& collapse : collapses) {
+      if (collapse.error > maxSqErr || collapseCount >= neededCollapseCount)
+        break;
+
+      if (touchedVertices[collapse.sourceIndex] || touchedVertices[collapse.targetIndex])
+        continue;
+
+      const Vec3f& targetPos = vertices[collapse.targetIndex].position;
+      bool isFlipping        = false;
+
+      // Triangles which would remain must not be flipped by the collapse
+      for (std::size_t triIndex = triangleOffsets[collapse.sourceIndex]; triIndex < triangleOffsets[collapse.sourceIndex + 1]; ++triIndex) {
+        const std::size_t firstIndex = vertexTriangles[triIndex] * 3;
+        std::array<Vec3f, 3> positions {};
+        bool hasTarget = false;
+
+        for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+          positions[cornerIndex] = vertices[result[firstIndex + cornerIndex]].position;
+          hasTarget |= (positionIndices[result[firstIndex + cornerIndex]] == positionIndices[collapse.targetIndex]);
+        }
+
+        if (hasTarget)
+          continue;
+
+        const Vec3f oldNormal = computeAreaNormal(positions[0], positions[1], positions[2]);
+
+        for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+          if (result[firstIndex + cornerIndex] == collapse.sourceIndex)
+            positions[cornerIndex] = targetPos;
+        }
+
+        if (computeAreaNormal(positions[0], positions[1], positions[2]).dot(oldNormal) <= 0.f) {
+          isFlipping = true;
+          break;
+        }
+      }
+
+      if (isFlipping)
+        continue;
+
+      for (std::size_t triIndex = triangleOffsets[collapse.sourceIndex]; triIndex < triangleOffsets[collapse.sourceIndex + 1]; ++triIndex) {
+        const std::size_t firstIndex = vertexTriangles[triIndex] * 3;
+
+        for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+          unsigned int& index = result[firstIndex + cornerIndex];
+
+          if (index == collapse.sourceIndex)
+            index = collapse.targetIndex;
+
+          // The other vertices of the changed triangles would have outdated collapses
+          touchedVertices[index] = true;
+        }
+      }
+
+      touchedVertices[collapse.sourceIndex] = true;
+      quadrics[collapse.targetIndex] += quadrics[collapse.sourceIndex];
+      resultSqError = std::max(resultSqError, collapse.error);
+      ++collapseCount;
+    }
+
+    if (collapseCount == 0)
+      break;
+
+    // Removing the triangles which have become degenerate, including those having several vertices on both sides of a seam
+    std::size_t writeIndex = 0;
+
+    for (std::size_t index = 0; index < result.size(); index += 3) {
+      const unsigned int posIndex1 = positionIndices[result[index]];
+      const unsigned int posIndex2 = positionIndices[result[index + 1]];
+      const unsigned int posIndex3 = positionIndices[result[index + 2]];
+
+      if (posIndex1 == posIndex2 || posIndex2 == posIndex3 || posIndex1 == posIndex3)
+        continue;
+
+      result[writeIndex]     = result[index];
+      result[writeIndex + 1] = result[index + 1];
+      result[writeIndex + 2] = result[index + 2];
+      writeIndex += 3;
+    }
+
+    result.resize(writeIndex);
+  }
+
+  if (resultError)
+    *resultError = static_cast<float>(std::sqrt(resultSqError) / scale);
+
+  return result;
+}
+
+} // namespace MeshSimplifier
+
+} // namespace Raz
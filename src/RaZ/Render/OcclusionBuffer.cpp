@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/OcclusionBuffer.hpp"
+#include "RaZ/Utils/Simd.hpp"
+
+namespace Raz {
+
+namespace {
+
+// Vertices closer than this view depth are considered behind the camera
+constexpr float MinDepth = 1e-4f;
+
+// A box is checked on the first level of the hierarchy on which it covers at most this number of texels per dimension
+constexpr unsigned int MaxCheckedTexelCount = 4;
+
+} // namespace
+
+OcclusionBuffer::OcclusionBuffer(unsigned int width, unsigned int height) : m_width{ width }, m_height{ height } {
+  if (width == 0 || height == 0 || width % 4 != 0)
+    throw std::runtime_error("Error: An occlusion buffer must have a non-null size & a width multiple of 4.");
+
+  // Each level halves the previous one's dimensions, down to a single texel
+  unsigned int levelWidth  = width;
+  unsigned int levelHeight = height;
+
+  while (true) {
+    Level level;
+    level.width  = levelWidth;
+    level.height = levelHeight;
+    level.depths.resize(levelWidth * levelHeight);
+
+    m_levels.emplace_back(std::move(level));
+
+    if (levelWidth == 1 && levelHeight == 1)
+      break;
+
+    levelWidth  = std::max(1u, (levelWidth + 1) / 2);
+    levelHeight = std::max(1u, (levelHeight + 1) / 2);
+  }
+}
+
+void OcclusionBuffer::clear(const Mat4f& viewProjMat) {
+  m_viewProjMat = viewProjMat;
+
+  for (Level& level : m_levels)
+    std::fill(level.depths.begin(), level.depths.end(), 0.f);
+}
+
+void OcclusionBuffer::rasterizeTriangle(const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos) {
+  rasterizeClipTriangle(Vec4f(firstPos, 1.f) * m_viewProjMat, Vec4f(secondPos, 1.f) * m_viewProjMat, Vec4f(thirdPos, 1.f) * m_viewProjMat);
+}
+
+void OcclusionBuffer::rasterizeMesh(const Mesh& mesh, const Mat4f& modelMat) {
+  const Mat4f modelViewProjMat = modelMat * m_viewProjMat;
+
+  for (const SubmeshPtr& submesh : mesh.getSubmeshes()) {
+    // Vertices are projected once, since most of them are shared by several triangles
+    m_clipPositions.resize(submesh->getVertexCount());
+
+    for (std::size_t vertIndex = 0; vertIndex < submesh->getVertexCount(); ++vertIndex)
+      m_clipPositions[vertIndex] = Vec4f(submesh->getVertices()[vertIndex].position, 1.f) * modelViewProjMat;
+
+    const std::vector<unsigned int>& indices = submesh->getIndices();
+
+    for (std::size_t index = 0; index + 2 < indices.size(); index += 3)
+      rasterizeClipTriangle(m_clipPositions[indices[index]], m_clipPositions[indices[index + 1]], m_clipPositions[indices[index + 2]]);
+  }
+}
+
+void OcclusionBuffer::buildHierarchy() {
+  for (std::size_t levelIndex = 1; levelIndex < m_levels.size(); ++levelIndex) {
+    const Level& prevLevel = m_levels[levelIndex - 1];
+    Level& level           = m_levels[levelIndex];
+
+    // Each texel keeps the farthest (lowest) depth of the 2x2 block it covers, clamped on odd borders
+    for (unsigned int texelY = 0; texelY < level.height; ++texelY) {
+      const unsigned int prevY1 = texelY * 2;
+      const unsigned int prevY2 = std::min(prevY1 + 1, prevLevel.height - 1);
+
+      for (unsigned int texelX = 0; texelX < level.width; ++texelX) {
+        const unsigned int prevX1 = texelX * 2;
+        const unsigned int prevX2 = std::min(prevX1 + 1, prevLevel.width - 1);
+
+        level.depths[texelY * level.width + texelX] = std::min({ prevLevel.depths[prevY1 * prevLevel.width + prevX1],
+                                                                 prevLevel.depths[prevY1 * prevLevel.width + prevX2],
+                                                                 prevLevel.depths[prevY2 * prevLevel.width + prevX1],
+                                                                 prevLevel.depths[prevY2 * prevLevel.width + prevX2] });
+      }
+    }
+  }
+}
+
+bool OcclusionBuffer::isOccluded(const AABB& box) const {
+  const Vec3f& minPos = box.getLeftBottomBackPos();
+  const Vec3f& maxPos = box.getRightTopFrontPos();
+
+  float minScreenX = std::numeric_limits<float>::max();
+  float minScreenY = std::numeric_limits<float>::max();
+  float maxScreenX = std::numeric_limits<float>::lowest();
+  float maxScreenY = std::numeric_limits<float>::lowest();
+  float maxInvDepth = 0.f;
+
+  for (uint8_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+    const Vec3f corner({ (cornerIndex & 1 ? maxPos[0] : minPos[0]),
+                         (cornerIndex & 2 ? maxPos[1] : minPos[1]),
+                         (cornerIndex & 4 ? maxPos[2] : minPos[2]) });
+    const Vec4f clipPos = Vec4f(corner, 1.f) * m_viewProjMat;
+
+    if (clipPos[3] < MinDepth)
+      return false;
+
+    const float invDepth = 1.f / clipPos[3];
+    const float screenX  = (clipPos[0] * invDepth * 0.5f + 0.5f) * static_cast<float>(m_width);
+    const float screenY  = (0.5f - clipPos[1] * invDepth * 0.5f) * static_cast<float>(m_height);
+
+    minScreenX  = std::min(minScreenX, screenX);
+    minScreenY  = std::min(minScreenY, screenY);
+    maxScreenX  = std::max(maxScreenX, screenX);
+    maxScreenY  = std::max(maxScreenY, screenY);
+    maxInvDepth = std::max(maxInvDepth, invDepth);
+  }
+
+  if (maxScreenX < 0.f || maxScreenY < 0.f || minScreenX >= static_cast<float>(m_width) || minScreenY >= static_cast<float>(m_height))
+    return false;
+
+  auto minX = static_cast<unsigned int>(std::max(minScreenX, 0.f));
+  auto minY = static_cast<unsigned int>(std::max(minScreenY, 0.f));
+  auto maxX = static_cast<unsigned int>(std::min(maxScreenX, static_cast<float>(m_width - 1)));
+  auto maxY = static_cast<unsigned int>(std::min(maxScreenY, static_cast<float>(m_height - 1)));
+
+  // Going up the hierarchy until the box covers few enough texels
+  std::size_t levelIndex = 0;
+
+  while ((maxX - minX >= MaxCheckedTexelCount || maxY - minY >= MaxCheckedTexelCount) && levelIndex + 1 < m_levels.size()) {
+    minX /= 2;
+    minY /= 2;
+    maxX /= 2;
+    maxY /= 2;
+    ++levelIndex;
+  }
+
+  const Level& level = m_levels[levelIndex];
+
+  // The box is hidden only if its closest point is behind the farthest occluder of every texel it covers
+  for (unsigned int texelY = minY; texelY <= maxY; ++texelY) {
+    for (unsigned int texelX = minX; texelX <= maxX; ++texelX) {
+      if (level.depths[texelY * level.width + texelX] <= maxInvDepth)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+void OcclusionBuffer::rasterizeClipTriangle(const Vec4f& firstPos, const Vec4f& secondPos, const Vec4f& thirdPos) {
+  if (firstPos[3] < MinDepth || secondPos[3] < MinDepth || thirdPos[3] < MinDepth)
+    return;
+
+  std::array<Vec3f, 3> vertices {};
+  const std::array<const Vec4f*, 3> clipPositions = { &firstPos, &secondPos, &thirdPos };
+
+  for (std::size_t vertIndex = 0; vertIndex < 3; ++vertIndex) {
+    const Vec4f& clipPos = *clipPositions[vertIndex];
+    const float invDepth = 1.f / clipPos[3];
+
+    vertices[vertIndex] = Vec3f({ (clipPos[0] * invDepth * 0.5f + 0.5f) * static_cast<float>(m_width),
+                                  (0.5f - clipPos[1] * invDepth * 0.5f) * static_cast<float>(m_height),
+                                  invDepth });
+  }
+
+  float area = (vertices[1][0] - vertices[0][0]) * (vertices[2][1] - vertices[0][1])
+             - (vertices[1][1] - vertices[0][1]) * (vertices[2][0] - vertices[0][0]);
+
+  if (std::abs(area) < std::numeric_limits<float>::epsilon())
+    return;
+
+  // Both faces are rasterized; the vertices are reordered so that the inside of the triangle is where all edge functions are positive
+  if (area < 0.f) {
+    std::swap(vertices[1], vertices[2]);
+    area = -area;
+  }
+
+  const float minX = std::max(std::min({ vertices[0][0], vertices[1][0], vertices[2][0] }), 0.f);
+  const float minY = std::max(std::min({ vertices[0][1], vertices[1][1], vertices[2][1] }), 0.f);
+  const float maxX = std::min(std::max({ vertices[0][0], vertices[1][0], vertices[2][0] }), static_cast<float>(m_width) - 1.f);
+  const float maxY = std::min(std::max({ vertices[0][1], vertices[1][1], vertices[2][1] }), static_cast<float>(m_height) - 1.f);
+
+  if (minX > maxX || minY > maxY)
+    return;
+
+  // Edge functions (E = A * x + B * y + C) of the edges opposite to each vertex, whose normalized values are the barycentric coordinates
+  std::array<float, 3> edgeCoeffsA {};
+  std::array<float, 3> edgeCoeffsB {};
+  std::array<float, 3> edgeCoeffsC {};
+
+  for (std::size_t vertIndex = 0; vertIndex < 3; ++vertIndex) {
+    const Vec3f& edgeStart = vertices[(vertIndex + 1) % 3];
+    const Vec3f& edgeEnd   = vertices[(vertIndex + 2) % 3];
+
+    edgeCoeffsA[vertIndex] = edgeStart[1] - edgeEnd[1];
+    edgeCoeffsB[vertIndex] = edgeEnd[0] - edgeStart[0];
+    edgeCoeffsC[vertIndex] = -(edgeCoeffsA[vertIndex] * edgeStart[0] + edgeCoeffsB[vertIndex] * edgeStart[1]);
+  }
+
+  // The inverse depth being linear in screen space, it is interpolated with a plane equation as well
+  const float invArea     = 1.f / area;
+  const float depthCoeffA = (edgeCoeffsA[0] * vertices[0][2] + edgeCoeffsA[1] * vertices[1][2] + edgeCoeffsA[2] * vertices[2][2]) * invArea;
+  const float depthCoeffB = (edgeCoeffsB[0] * vertices[0][2] + edgeCoeffsB[1] * vertices[1][2] + edgeCoeffsB[2] * vertices[2][2]) * invArea;
+  const float depthCoeffC = (edgeCoeffsC[0] * vertices[0][2] + edgeCoeffsC[1] * vertices[1][2] + edgeCoeffsC[2] * vertices[2][2]) * invArea;
+
+  const Simd::Float4 zero(0.f);
+  const std::array<Simd::Float4, 3> packedCoeffsA = { Simd::Float4(edgeCoeffsA[0]), Simd::Float4(edgeCoeffsA[1]), Simd::Float4(edgeCoeffsA[2]) };
+  const Simd::Float4 packedDepthCoeffA(depthCoeffA);
+
+  // Rows are processed by aligned packs of 4 pixels, sampled at their centers; the width being a multiple of 4, no pack overflows a row
+  const auto firstX = static_cast<unsigned int>(minX) / 4 * 4;
+  const auto lastX  = static_cast<unsigned int>(maxX);
+  const auto firstY = static_cast<unsigned int>(minY);
+  const auto lastY  = static_cast<unsigned int>(maxY);
+
+  std::vector<float>& depths = m_levels.front().depths;
+
+  for (unsigned int pixelY = firstY; pixelY <= lastY; ++pixelY) {
+    const float centerY = static_cast<float>(pixelY) + 0.5f;
+
+    const std::array<Simd::Float4, 3> rowEdges = { Simd::Float4(edgeCoeffsB[0] * centerY + edgeCoeffsC[0]),
+                                                   Simd::Float4(edgeCoeffsB[1] * centerY + edgeCoeffsC[1]),
+                                                   Simd::Float4(edgeCoeffsB[2] * centerY + edgeCoeffsC[2]) };
+    const Simd::Float4 rowDepth(depthCoeffB * centerY + depthCoeffC);
+
+    for (unsigned int pixelX = firstX; pixelX <= lastX; pixelX += 4) {
+      const auto baseX = static_cast<float>(pixelX);
+      const Simd::Float4 centersX(baseX + 0.5f, baseX + 1.5f, baseX + 2.5f, baseX + 3.5f);
+
+      const Simd::Float4 insideMask = (packedCoeffsA[0] * centersX + rowEdges[0] >= zero)
+                                    & (packedCoeffsA[1] * centersX + rowEdges[1] >= zero)
+                                    & (packedCoeffsA[2] * centersX + rowEdges[2] >= zero);
+
+      if (insideMask.computeMask() == 0)
+        continue;
+
+      float* depthPtr = depths.data() + pixelY * m_width + pixelX;
+
+      const Simd::Float4 currentDepths = Simd::Float4::load(depthPtr);
+      const Simd::Float4 pixelDepths   = packedDepthCoeffA * centersX + rowDepth;
+
+      Simd::Float4::select(insideMask & (pixelDepths > currentDepths), pixelDepths, currentDepths).store(depthPtr);
+    }
+  }
+}
+
+} // namespace Raz
@@ -0,0 +1,310 @@
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Light.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/RayTracer.hpp"
+
+namespace Raz {
+
+namespace {
+
+constexpr float ShadowBias = 0.001f;
+
+struct LightInfo {
+  Vec3f position {};
+  Vec3f direction {};
+  Vec3f color {};
+  float energy {};
+  bool isDirectional {};
+};
+
+struct SurfaceInfo {
+  MaterialType type = MaterialType::COOK_TORRANCE;
+  Vec3f color       = Vec3f(1.f);
+  Vec3f specular    = Vec3f(1.f);
+  Vec3f emissive    = Vec3f(0.f);
+  float metallic    = 0.f;
+  float roughness   = 1.f;
+};
+
+uint32_t hashValue(uint32_t value) {
+  value ^= value >> 16;
+  value *= 0x7feb352d;
+  value ^= value >> 15;
+  value *= 0x846ca68b;
+  value ^= value >> 16;
+
+  return value;
+}
+
+float computeJitter(uint32_t seed) {
+  return static_cast<float>(hashValue(seed) >> 8) / 16777216.f;
+}
+
+std::vector<LightInfo> recoverLights(const World& world) {
+  std::vector<LightInfo> lights;
+
+  for (const EntityPtr& entity : world.getEntities()) {
+    if (entity == nullptr || !entity->isEnabled() || !entity->hasComponent<Light>())
+      continue;
+
+    const auto& light = entity->getComponent<Light>();
+
+    LightInfo lightInfo;
+    lightInfo.direction     = light.getDirection();
+    lightInfo.color         = light.getColor();
+    lightInfo.energy        = light.getEnergy();
+    lightInfo.isDirectional = (light.getType() == LightType::DIRECTIONAL);
+
+    // Like in the shaders, positional lights need a Transform to be located
+    if (entity->hasComponent<Transform>())
+      lightInfo.position = entity->getComponent<Transform>().getPosition();
+    else if (!lightInfo.isDirectional)
+      continue;
+
+    lights.emplace_back(lightInfo);
+  }
+
+  return lights;
+}
+
+SurfaceInfo recoverSurface(const RayHit& hit) {
+  SurfaceInfo surface;
+
+  if (hit.entity == nullptr || !hit.entity->hasComponent<Mesh>() || hit.submeshIndex == std::numeric_limits<std::size_t>::max())
+    return surface;
+
+  const auto& mesh = hit.entity->getComponent<Mesh>();
+  const std::size_t materialIndex = mesh.getSubmeshes()[hit.submeshIndex]->getMaterialIndex();
+
+  if (materialIndex >= mesh.getMaterials().size())
+    return surface;
+
+  const Material& material = *mesh.getMaterials()[materialIndex];
+  surface.type = material.getType();
+
+  if (surface.type == MaterialType::COOK_TORRANCE) {
+    const auto& cookTorrance = static_cast<const MaterialCookTorrance&>(material);
+
+    surface.color     = cookTorrance.getBaseColor();
+    surface.metallic  = cookTorrance.getMetallicFactor();
+    surface.roughness = cookTorrance.getRoughnessFactor();
+  } else {
+    const auto& standard = static_cast<const MaterialStandard&>(material);
+
+    surface.color    = standard.getDiffuse();
+    surface.specular = standard.getSpecular();
+    surface.emissive = standard.getEmissive();
+  }
+
+  return surface;
+}
+
+// The following functions reproduce the Cook-Torrance shader; see cook-torrance.glsl for details
+
+float computeNormalDistrib(const Vec3f& normal, const Vec3f& halfVec, float roughness) {
+  const float sqrRough  = roughness * roughness;
+  const float frthRough = sqrRough * sqrRough;
+
+  const float halfVecAngle    = std::max(halfVec.dot(normal), 0.f);
+  const float sqrHalfVecAngle = halfVecAngle * halfVecAngle;
+
+  float divider = (sqrHalfVecAngle * (frthRough - 1.f) + 1.f);
+  divider       = PI<float> * divider * divider;
+
+  return frthRough / std::max(divider, 0.001f);
+}
+
+Vec3f computeFresnel(float cosTheta, const Vec3f& baseReflectivity) {
+  return baseReflectivity + (Vec3f(1.f) - baseReflectivity) * std::pow(1.f - cosTheta, 5.f);
+}
+
+float computeGeomShlickGGX(float angle, float roughness) {
+  const float incrRough   = (roughness + 1.f);
+  const float roughFactor = (incrRough * incrRough) / 8.f;
+
+  return angle / (angle * (1.f - roughFactor) + roughFactor);
+}
+
+Vec3f computeCookTorrance(const SurfaceInfo& surface, const Vec3f& normal, const Vec3f& viewDir, const Vec3f& lightDir, const Vec3f& radiance) {
+  const Vec3f baseReflectivity = Vec3f(0.04f) * (1.f - surface.metallic) + surface.color * surface.metallic;
+  const Vec3f halfDir          = (viewDir + lightDir).normalize();
+
+  const float viewAngle  = std::max(viewDir.dot(normal), 0.f);
+  const float lightAngle = std::max(lightDir.dot(normal), 0.f);
+
+  const float normalDistrib = computeNormalDistrib(normal, halfDir, surface.roughness);
+  const Vec3f fresnel       = computeFresnel(std::max(halfDir.dot(viewDir), 0.f), baseReflectivity);
+  const float geometry      = computeGeomShlickGGX(viewAngle, surface.roughness) * computeGeomShlickGGX(lightAngle, surface.roughness);
+
+  const Vec3f specular = fresnel * (normalDistrib * geometry / std::max(4.f * viewAngle * lightAngle, 0.001f));
+  const Vec3f diffuse  = (Vec3f(1.f) - fresnel) * (1.f - surface.metallic);
+
+  return (diffuse * surface.color / PI<float> + specular) * radiance * lightAngle;
+}
+
+// Reproduces the Blinn-Phong shader; see blinn-phong.glsl for details
+Vec3f computeBlinnPhong(const SurfaceInfo& surface, const Vec3f& normal, const Vec3f& viewDir, const Vec3f& lightDir, const Vec3f& lightColor, float attenuation) {
+  const Vec3f diffuse  = surface.color * (std::max(lightDir.dot(normal), 0.f) * attenuation);
+  const Vec3f halfDir  = (lightDir + viewDir).normalize();
+  const Vec3f specular = lightColor * surface.specular * (std::pow(std::max(halfDir.dot(normal), 0.f), 32.f) * attenuation);
+
+  return diffuse + specular;
+}
+
+Vec3f shadeHit(World& world, const Ray& ray, const RayHit& hit, const std::vector<LightInfo>& lights, std::size_t& rayCount) {
+  const SurfaceInfo surface = recoverSurface(hit);
+
+  // The normal is made to face the viewer, so that surfaces seen from behind are lit on the visible side
+  const Vec3f viewDir = -ray.getDirection();
+  const Vec3f normal  = (hit.normal.dot(viewDir) < 0.f ? -hit.normal : hit.normal);
+
+  Vec3f color = (surface.type == MaterialType::COOK_TORRANCE ? surface.color * 0.03f : surface.color * 0.05f + surface.emissive);
+
+  const Vec3f shadowOrigin = hit.position + normal * ShadowBias;
+
+  for (const LightInfo& light : lights) {
+    Vec3f lightDir;
+    float lightDist   = std::numeric_limits<float>::max();
+    float attenuation = light.energy;
+
+    if (light.isDirectional) {
+      lightDir = -light.direction.normalize();
+    } else {
+      const Vec3f fullLightDir = light.position - hit.position;
+      const float sqLightDist  = fullLightDir.computeSquaredLength();
+
+      lightDist    = std::sqrt(sqLightDist);
+      lightDir     = fullLightDir / lightDist;
+      attenuation /= sqLightDist;
+    }
+
+    if (lightDir.dot(normal) <= 0.f)
+      continue;
+
+    // Checking if any entity stands between the point & the light
+    RayHit shadowHit;
+    ++rayCount;
+
+    if (world.raycast(Ray(shadowOrigin, lightDir), shadowHit, lightDist - ShadowBias))
+      continue;
+
+    if (surface.type == MaterialType::COOK_TORRANCE)
+      color += computeCookTorrance(surface, normal, viewDir, lightDir, light.color * attenuation);
+    else
+      color += computeBlinnPhong(surface, normal, viewDir, lightDir, light.color, attenuation);
+  }
+
+  return color;
+}
+
+} // namespace
+
+RayTracer::RayTracer(unsigned int width, unsigned int height, std::size_t threadCount)
+  : m_width{ width }, m_height{ height }, m_threadPool(threadCount), m_accumulatedColors(static_cast<std::size_t>(width) * height) {}
+
+void RayTracer::render(World& world, const Entity& cameraEntity) {
+  if (!cameraEntity.hasComponent<Camera>() || !cameraEntity.hasComponent<Transform>())
+    throw std::runtime_error("Error: The entity to render from must have a Camera & a Transform component.");
+
+  const auto startTime = std::chrono::steady_clock::now();
+
+  // Recomputing the view matrix as done by the render system, since the camera may not have been updated
+  const auto& camera          = cameraEntity.getComponent<Camera>();
+  const auto& cameraTransform = cameraEntity.getComponent<Transform>();
+
+  const Mat4f invViewMat = (cameraTransform.computeTranslationMatrix(true) * cameraTransform.getRotation().inverse()).inverse();
+  const Mat4f& invProjMat = camera.getInverseProjectionMatrix();
+  const Vec3f& cameraPos  = cameraTransform.getPosition();
+
+  const std::vector<LightInfo> lights = recoverLights(world);
+
+  // The world's spatial index must be up to date before being queried concurrently
+  world.updateSpatialIndex();
+
+  std::atomic<std::size_t> rayCount(0);
+  const auto sampleIndex = static_cast<uint32_t>(m_sampleCount);
+
+  for (unsigned int tileY = 0; tileY < m_height; tileY += TileSize) {
+    for (unsigned int tileX = 0; tileX < m_width; tileX += TileSize) {
+      m_threadPool.addTask([this, &world, &invViewMat, &invProjMat, &cameraPos, &lights, &rayCount, sampleIndex, tileX, tileY] () {
+        std::size_t tileRayCount = 0;
+
+        const unsigned int endY = std::min(tileY + TileSize, m_height);
+        const unsigned int endX = std::min(tileX + TileSize, m_width);
+
+        for (unsigned int pixelY = tileY; pixelY < endY; ++pixelY) {
+          for (unsigned int pixelX = tileX; pixelX < endX; ++pixelX) {
+            const std::size_t pixelIndex = static_cast<std::size_t>(pixelY) * m_width + pixelX;
+
+            // The first sample goes through the pixel's center; the next ones are jittered inside it, progressively antialiasing the image
+            float jitterX = 0.5f;
+            float jitterY = 0.5f;
+
+            if (sampleIndex > 0) {
+              const auto seed = static_cast<uint32_t>(pixelIndex) * 2 + sampleIndex * 0x9e3779b9;
+              jitterX = computeJitter(seed);
+              jitterY = computeJitter(seed + 1);
+            }
+
+            const float ndcX = (static_cast<float>(pixelX) + jitterX) / static_cast<float>(m_width) * 2.f - 1.f;
+            const float ndcY = 1.f - (static_cast<float>(pixelY) + jitterY) / static_cast<float>(m_height) * 2.f;
+
+            const Vec4f viewPoint = Vec4f({ ndcX, ndcY, 1.f, 1.f }) * invProjMat;
+            const Vec3f viewDir   = (Vec3f(viewPoint) / viewPoint[3]).normalize();
+            const Ray ray(cameraPos, Vec3f(Vec4f(viewDir, 0.f) * invViewMat).normalize());
+
+            RayHit hit;
+            ++tileRayCount;
+
+            if (world.raycast(ray, hit))
+              m_accumulatedColors[pixelIndex] += shadeHit(world, ray, hit, lights, tileRayCount);
+          }
+        }
+
+        rayCount += tileRayCount;
+      });
+    }
+  }
+
+  m_threadPool.wait();
+
+  ++m_sampleCount;
+  m_rayCount   = rayCount;
+  m_renderTime = std::chrono::duration_cast<std::chrono::duration<float>>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void RayTracer::reset() {
+  std::fill(m_accumulatedColors.begin(), m_accumulatedColors.end(), Vec3f(0.f));
+  m_sampleCount = 0;
+}
+
+Image RayTracer::recoverImage() const {
+  Image image(m_width, m_height, ImageColorspace::RGB);
+
+  if (m_sampleCount == 0)
+    return image;
+
+  auto* imageData = static_cast<uint8_t*>(image.getDataPtr());
+  const float sampleFactor = 1.f / static_cast<float>(m_sampleCount);
+
+  for (std::size_t pixelIndex = 0; pixelIndex < m_accumulatedColors.size(); ++pixelIndex) {
+    const Vec3f color = m_accumulatedColors[pixelIndex] * sampleFactor;
+
+    for (std::size_t channelIndex = 0; channelIndex < 3; ++channelIndex) {
+      // HDR tone mapping & gamma correction, as done in the shaders
+      const float mappedValue = std::pow(color[channelIndex] / (color[channelIndex] + 1.f), 1.f / 2.2f);
+      imageData[pixelIndex * 3 + channelIndex] = static_cast<uint8_t>(std::min(mappedValue, 1.f) * 255.f + 0.5f);
+    }
+  }
+
+  return image;
+}
+
+} // namespace Raz
@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include "RaZ/Render/Material.hpp"
+#include "RaZ/Render/RenderQueue.hpp"
+#include "RaZ/Render/ShaderProgram.hpp"
+#include "RaZ/Render/Submesh.hpp"
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t RadixBitCount  = 8;
+constexpr std::size_t RadixSize      = 1 << RadixBitCount;
+constexpr std::size_t RadixPassCount = 64 / RadixBitCount;
+
+// Value of the current transformation when the instance matrix attribute has not been set for the bound vertex array
+constexpr std::size_t NoTransform = std::numeric_limits<std::size_t>::max();
+
+constexpr uint64_t computeBitMask(unsigned int bitCount) {
+  return (uint64_t(1) << bitCount) - 1;
+}
+
+uint32_t quantizeDepth(float depth) {
+  if (!(depth > 0.f))
+    return 0;
+
+  // Positive floating-point values are ordered like their bit patterns; keeping the upper bits preserves that order
+  uint32_t depthBits {};
+  std::memcpy(&depthBits, &depth, sizeof(float));
+
+  return (depthBits >> (32 - RenderQueue::DepthBitCount));
+}
+
+void bindInstanceMatrices(std::size_t matrixOffset) {
+  // A matrix attribute takes as many locations as rows, each one being read per instance
+  for (GLuint rowIndex = 0; rowIndex < 4; ++rowIndex) {
+    const GLuint location = RenderQueue::InstanceMatrixLocation + rowIndex;
+
+    glVertexAttribPointer(location, 4,
+                          GL_FLOAT, GL_FALSE,
+                          sizeof(Mat4f),
+                          reinterpret_cast<void*>(matrixOffset + sizeof(float) * 4 * rowIndex));
+    glEnableVertexAttribArray(location);
+    glVertexAttribDivisor(location, 1);
+  }
+}
+
+} // namespace
+
+uint64_t RenderQueue::computeSortKey(uint32_t programIndex, uint32_t materialIndex, uint32_t textureIndex, uint32_t vertexArrayIndex, float depth) {
+  constexpr unsigned int vertexArrayShift = DepthBitCount;
+  constexpr unsigned int textureShift     = vertexArrayShift + VertexArrayBitCount;
+  constexpr unsigned int materialShift    = textureShift + TextureBitCount;
+  constexpr unsigned int programShift     = materialShift + MaterialBitCount;
+
+  static_assert(programShift + ProgramBitCount == 64, "Error: The sort key's fields must fill exactly 64 bits.");
+
+  return ((programIndex & computeBitMask(ProgramBitCount)) << programShift)
+       | ((materialIndex & computeBitMask(MaterialBitCount)) << materialShift)
+       | ((textureIndex & computeBitMask(TextureBitCount)) << textureShift)
+       | ((vertexArrayIndex & computeBitMask(VertexArrayBitCount)) << vertexArrayShift)
+       | (quantizeDepth(depth) & computeBitMask(DepthBitCount));
+}
+
+uint64_t RenderQueue::computeSortKey(const ShaderProgram& program, const Material* material, const Submesh& submesh, float depth) const {
+  const auto materialIter     = m_materialIndices.find(material);
+  const uint32_t textureIndex = ((material && material->getBaseTexture()) ? material->getBaseTexture()->getIndex() : 0);
+
+  return computeSortKey(program.getIndex(),
+                        (materialIter != m_materialIndices.cend() ? materialIter->second : 0),
+                        textureIndex,
+                        submesh.recoverVertexArray().getIndex(),
+                        depth);
+}
+
+const Material& RenderQueue::recoverDefaultMaterial() {
+  if (m_defaultMaterial == nullptr)
+    m_defaultMaterial = MaterialCookTorrance::create();
+
+  return *m_defaultMaterial;
+}
+
+std::size_t RenderQueue::addTransform(const Mat4f& modelMat) {
+  m_transforms.emplace_back(modelMat);
+  return m_transforms.size() - 1;
+}
+
+void RenderQueue::addCommand(uint64_t sortKey, const ShaderProgram* program, const Material* material,
+                             const Submesh* submesh, std::size_t transformIndex, std::size_t lodIndex) {
+  RenderCommand command;
+  command.sortKey        = sortKey;
+  command.program        = program;
+  command.material       = material;
+  command.submesh        = submesh;
+  command.transformIndex = transformIndex;
+  command.lodIndex       = lodIndex;
+
+  m_commands.emplace_back(command);
+}
+
+void RenderQueue::addCommand(const ShaderProgram& program, const Material* material, const Submesh& submesh,
+                             std::size_t transformIndex, float depth, std::size_t lodIndex) {
+  registerMaterial(material);
+  addCommand(computeSortKey(program, material, submesh, depth), &program, material, &submesh, transformIndex, lodIndex);
+}
+
+void RenderQueue::addInstancedCommand(const ShaderProgram& program, const Material* material, const Submesh& submesh,
+                                      std::size_t firstTransformIndex, std::size_t instanceCount, float depth, std::size_t lodIndex) {
+  addCommand(program, material, submesh, firstTransformIndex, depth, lodIndex);
+  m_commands.back().instanceCount = instanceCount;
+}
+
+void RenderQueue::addCommands(const std::vector<RenderCommand>& commands, const std::vector<Mat4f>& transforms) {
+  const std::size_t transformOffset = m_transforms.size();
+  m_transforms.insert(m_transforms.end(), transforms.cbegin(), transforms.cend());
+
+  m_commands.reserve(m_commands.size() + commands.size());
+
+  for (const RenderCommand& command : commands) {
+    m_commands.emplace_back(command);
+    m_commands.back().transformIndex += transformOffset;
+  }
+}
+
+void RenderQueue::sort() {
+  if (m_commands.size() < 2)
+    return;
+
+  // Counting the occurrences of every byte value of the keys at once, for all passes
+  std::vector<std::array<std::size_t, RadixSize>> counts(RadixPassCount);
+
+  for (const RenderCommand& command : m_commands) {
+    for (std::size_t passIndex = 0; passIndex < RadixPassCount; ++passIndex)
+      ++counts[passIndex][(command.sortKey >> (passIndex * RadixBitCount)) & (RadixSize - 1)];
+  }
+
+  m_sortBuffer.resize(m_commands.size());
+
+  for (std::size_t passIndex = 0; passIndex < RadixPassCount; ++passIndex) {
+    std::array<std::size_t, RadixSize>& passCounts = counts[passIndex];
+    const std::size_t firstByte = (m_commands.front().sortKey >> (passIndex * RadixBitCount)) & (RadixSize - 1);
+
+    // If all keys share the same byte, the pass would not change the order
+    if (passCounts[firstByte] == m_commands.size())
+      continue;
+
+    // Turning the counts into offsets, then scattering the commands in a stable way
+    std::size_t offset = 0;
+
+    for (std::size_t& count : passCounts) {
+      const std::size_t byteCount = count;
+      count   = offset;
+      offset += byteCount;
+    }
+
+    for (const RenderCommand& command : m_commands)
+      m_sortBuffer[passCounts[(command.sortKey >> (passIndex * RadixBitCount)) & (RadixSize - 1)]++] = command;
+
+    std::swap(m_commands, m_sortBuffer);
+  }
+}
+
+void RenderQueue::submit(const Mat4f& viewProjMat) {
+  m_stats = RenderQueueStats();
+
+  if (m_commands.empty())
+    return;
+
+  // All transformations are written at once, each draw reading its own from their offset
+  if (m_transformBuffer == nullptr)
+    m_transformBuffer = std::make_unique<RingBuffer>(GL_ARRAY_BUFFER, sizeof(Mat4f) * 1024);
+
+  const std::size_t bufferOffset = m_transformBuffer->write(m_transforms.data(), sizeof(Mat4f) * m_transforms.size());
+
+  // Textures may have been bound by other means since the last submission
+  m_textureBindings.reset();
+
+  // If draws can start at a given instance, the attribute only has to be set once per vertex array; otherwise, it is offset for each transformation
+  const bool hasBaseInstance       = GLEW_ARB_base_instance;
+  const bool hasMultiDrawIndirect  = (hasBaseInstance && GLEW_ARB_multi_draw_indirect);
+  const std::size_t indirectOffset = (hasMultiDrawIndirect ? writeIndirectCommands() : 0);
+
+  const ShaderProgram* currentProgram = nullptr;
+  const Material* currentMaterial     = nullptr;
+  GLuint currentVertexArray           = 0;
+  std::size_t currentTransform        = NoTransform;
+  bool isDequantizationUpToDate       = false;
+
+  std::size_t commandIndex = 0;
+
+  while (commandIndex < m_commands.size()) {
+    const RenderCommand& command = m_commands[commandIndex];
+
+    if (command.program != currentProgram) {
+      currentProgram = command.program;
+      currentProgram->use();
+
+      // Transformations being read from the buffer, the uniforms only have to apply the view-projection
+      currentProgram->sendUniform(currentProgram->recoverUniformLocation("uniModelMatrix"), Mat4f::identity());
+      currentProgram->sendUniform(currentProgram->recoverUniformLocation("uniMvpMatrix"), viewProjMat);
+
+      // Uniforms being specific to each program, the material's & the positions' ones must be sent again
+      currentMaterial          = nullptr;
+      isDequantizationUpToDate = false;
+
+      ++m_stats.programChangeCount;
+    }
+
+    // Commands without material must not be drawn with the previous command's one
+    const Material* material = (command.material ? command.material : &recoverDefaultMaterial());
+
+    if (material != currentMaterial) {
+      currentMaterial = material;
+
+      // The default material is not known by the meshes, which initialize their own materials' textures for the programs
+      if (command.material == nullptr)
+        currentMaterial->initTextures(*currentProgram);
+
+      currentMaterial->bindAttributes(*currentProgram, &m_textureBindings);
+
+      ++m_stats.materialChangeCount;
+    }
+
+    const VertexArray& vertexArray = command.submesh->recoverVertexArray();
+
+    if (vertexArray.getIndex() != currentVertexArray) {
+      currentVertexArray = vertexArray.getIndex();
+      vertexArray.bind();
+
+      // Attributes being part of the vertex array's state, they must be set again for the new one
+      currentTransform = NoTransform;
+
+      // Submeshes loaded into their own buffers each have their own vertex array & position dequantization
+      isDequantizationUpToDate = false;
+
+      ++m_stats.vertexArrayChangeCount;
+    }
+
+    // Submeshes sharing a vertex array are in the same arena, in which positions are never quantized; they thus share the same values
+    if (!isDequantizationUpToDate) {
+      command.submesh->sendPositionDequantization(*currentProgram);
+      isDequantizationUpToDate = true;
+    }
+
+    const std::size_t attributeTransform = (hasBaseInstance ? 0 : command.transformIndex);
+
+    if (attributeTransform != currentTransform) {
+      currentTransform = attributeTransform;
+
+      m_transformBuffer->bind();
+      bindInstanceMatrices(bufferOffset + currentTransform * sizeof(Mat4f));
+
+      ++m_stats.transformChangeCount;
+    }
+
+    // The following commands drawing from the same arena with the same states are merged with this one
+    std::size_t batchEnd = commandIndex + 1;
+
+    if (hasMultiDrawIndirect && command.submesh->recoverGeometryRange()) {
+      while (batchEnd < m_commands.size()
+          && m_commands[batchEnd].program == command.program
+          && m_commands[batchEnd].material == command.material
+          && m_commands[batchEnd].submesh->recoverVertexArray().getIndex() == currentVertexArray)
+        ++batchEnd;
+    }
+
+    if (batchEnd - commandIndex > 1) {
+      m_indirectBuffer->bind();
+      glMultiDrawElementsIndirect(GL_TRIANGLES, command.submesh->recoverIndexType(),
+                                  reinterpret_cast<void*>(indirectOffset + commandIndex * sizeof(DrawElementsIndirectCommand)),
+                                  static_cast<GLsizei>(batchEnd - commandIndex), 0);
+
+      for (std::size_t batchIndex = commandIndex; batchIndex < batchEnd; ++batchIndex)
+        m_stats.instanceCount += m_indirectCommands[batchIndex].instanceCount;
+
+      m_stats.multiDrawCommandCount += batchEnd - commandIndex;
+    } else {
+      const std::size_t instanceCount = std::max(command.instanceCount, std::size_t(1));
+      command.submesh->drawElementsInstanced(instanceCount, (hasBaseInstance ? command.transformIndex : 0), command.lodIndex);
+
+      m_stats.instanceCount += instanceCount;
+    }
+
+    ++m_stats.drawCount;
+    commandIndex = batchEnd;
+  }
+
+  if (hasMultiDrawIndirect)
+    m_indirectBuffer->fence();
+
+  m_transformBuffer->fence();
+  m_stats.textureChangeCount = m_textureBindings.getBindCount();
+
+  // Draws made outside of the queue have the attribute disabled, thus reading this constant value, which must be an identity matrix
+  for (GLuint rowIndex = 0; rowIndex < 4; ++rowIndex)
+    glVertexAttrib4f(InstanceMatrixLocation + rowIndex, (rowIndex == 0), (rowIndex == 1), (rowIndex == 2), (rowIndex == 3));
+}
+
+std::size_t RenderQueue::writeIndirectCommands() {
+  m_indirectCommands.resize(m_commands.size());
+
+  // Commands are written in their order, so that merged ones are contiguous; only those drawing from an arena are actually read
+  for (std::size_t commandIndex = 0; commandIndex < m_commands.size(); ++commandIndex) {
+    const RenderCommand& command                 = m_commands[commandIndex];
+    DrawElementsIndirectCommand& indirectCommand = m_indirectCommands[commandIndex];
+
+    const GeometryRange* range = command.submesh->recoverGeometryRange();
+
+    // All levels of detail are stored one after the other in the submesh's range
+    const std::size_t lodFirstIndex = command.submesh->computeLodFirstIndex(command.lodIndex);
+
+    indirectCommand.indexCount    = static_cast<GLuint>(command.submesh->getLodIndices(command.lodIndex).size());
+    indirectCommand.instanceCount = static_cast<GLuint>(std::max(command.instanceCount, std::size_t(1)));
+    indirectCommand.firstIndex    = static_cast<GLuint>((range ? range->firstIndex : 0) + lodFirstIndex);
+    indirectCommand.baseVertex    = static_cast<GLint>(range ? range->firstVertex : 0);
+    indirectCommand.baseInstance  = static_cast<GLuint>(command.transformIndex);
+  }
+
+  if (m_indirectBuffer == nullptr)
+    m_indirectBuffer = std::make_unique<RingBuffer>(GL_DRAW_INDIRECT_BUFFER, sizeof(DrawElementsIndirectCommand) * 1024);
+
+  return m_indirectBuffer->write(m_indirectCommands.data(), sizeof(DrawElementsIndirectCommand) * m_indirectCommands.size());
+}
+
+void RenderQueue::clear() {
+  m_commands.clear();
+  m_transforms.clear();
+
+  // Materials may have been destroyed & their addresses reused; only the grouping would be affected, but the indices must not overflow
+  if (m_materialIndices.size() >= computeBitMask(MaterialBitCount))
+    m_materialIndices.clear();
+}
+
+uint32_t RenderQueue::recoverMaterialIndex(const Material* material) {
+  if (material == nullptr)
+    return 0;
+
+  // Indices start at 1, leaving 0 to commands without material
+  return m_materialIndices.emplace(material, static_cast<uint32_t>(m_materialIndices.size() + 1)).first->second;
+}
+
+} // namespace Raz
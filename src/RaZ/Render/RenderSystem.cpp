@@ -1,31 +1,112 @@
+#include <algorithm>
+#include <limits>
+
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Render/Camera.hpp"
 #include "RaZ/Render/Light.hpp"
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/MeshInstance.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
 
 namespace Raz {
 
+constexpr std::size_t RenderSystem::PrepareTaskItemCount;
+
 RenderSystem::RenderSystem(unsigned int windowWidth, unsigned int windowHeight,
-                           const std::string& windowTitle) : m_window(windowWidth, windowHeight, windowTitle) {
+                           const std::string& windowTitle, bool isHeadless) : m_window(windowWidth, windowHeight, windowTitle, 1, isHeadless) {
   m_camera.addComponent<Camera>(windowWidth, windowHeight);
   m_camera.addComponent<Transform>();
 
   m_acceptedComponents.setBit(Component::getId<Mesh>());
+  m_acceptedComponents.setBit(Component::getId<MeshInstance>());
   m_acceptedComponents.setBit(Component::getId<Light>());
 }
 
+void RenderSystem::setProgram(ShaderProgram&& program) {
+  m_program = std::move(program);
+  m_lightBuffer.initProgram(m_program);
+}
+
+void RenderSystem::setVertexLayout(const VertexLayout& layout) {
+  // Meshes must be removed from the current arena before it is destroyed
+  for (auto& entity : m_entities) {
+    if (entity->hasComponent<Mesh>())
+      entity->getComponent<Mesh>().unload();
+  }
+
+  for (const auto& sharedMesh : m_sharedMeshes)
+    sharedMesh.first->unload();
+
+  m_vertexLayout = layout;
+
+  // Quantized positions being relative to each submesh's bounds, they cannot be held by an arena
+  m_geometryArena.reset();
+
+  if (layout.positionFormat == PositionFormat::FLOAT)
+    m_geometryArena = std::make_unique<GeometryArena>(layout, GL_UNSIGNED_SHORT);
+
+  for (auto& entity : m_entities) {
+    if (entity->hasComponent<Mesh>())
+      loadMesh(entity->getComponent<Mesh>());
+  }
+
+  for (const auto& sharedMesh : m_sharedMeshes)
+    loadMesh(*sharedMesh.first);
+}
+
+void RenderSystem::enableDeferredShading(const std::string& lightingFragShaderPath) {
+  m_deferredRenderer = DeferredRenderer::create(m_window.getWidth(), m_window.getHeight(), lightingFragShaderPath,
+                                                 m_window.getFramebufferIndex());
+  m_lightBuffer.initProgram(m_deferredRenderer->getLightingProgram());
+}
+
 void RenderSystem::linkEntity(const EntityPtr& entity) {
   System::linkEntity(entity);
 
+  // Meshes are loaded into the arena, so that they can all be drawn from the same buffers
   if (entity->hasComponent<Mesh>())
-    entity->getComponent<Mesh>().load(m_program);
+    loadMesh(entity->getComponent<Mesh>());
+
+  // A shared mesh is loaded only once, when its first instance is linked
+  if (entity->hasComponent<MeshInstance>()) {
+    const Mesh& sharedMesh = entity->getComponent<MeshInstance>().getMesh();
+
+    if (m_sharedMeshes[&sharedMesh].linkedCount++ == 0)
+      loadMesh(sharedMesh);
+  }
 
   if (entity->hasComponent<Light>())
     updateLights();
 }
 
+void RenderSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+  m_meshBounds.erase(entity.get());
+
+  if (entity->hasComponent<Mesh>())
+    entity->getComponent<Mesh>().unload();
+
+  if (entity->hasComponent<MeshInstance>()) {
+    const auto sharedMeshIter = m_sharedMeshes.find(&entity->getComponent<MeshInstance>().getMesh());
+
+    if (sharedMeshIter != m_sharedMeshes.end() && --sharedMeshIter->second.linkedCount == 0) {
+      sharedMeshIter->first->unload();
+      m_sharedMeshes.erase(sharedMeshIter);
+    }
+  }
+}
+
 bool RenderSystem::update(float deltaTime) {
+  StateCache::get().resetStats();
+
+  GpuProfiler* gpuProfiler = (m_isGpuProfilingEnabled ? &m_gpuProfiler : nullptr);
+
+  if (gpuProfiler)
+    gpuProfiler->beginFrame();
+
+  // Textures decoded in the background are uploaded before drawing, a few at a time
+  TextureStreamer::get().update();
+
   m_program.use();
 
   auto& camera       = m_camera.getComponent<Camera>();
@@ -46,23 +127,322 @@ bool RenderSystem::update(float deltaTime) {
     viewProjMat = camera.getViewMatrix() * camera.getProjectionMatrix();
   }
 
-  for (auto& entity : m_entities) {
-    if (entity->isEnabled()) {
-      if (entity->hasComponent<Mesh>() && entity->hasComponent<Transform>()) {
-        const Mat4f modelMat = entity->getComponent<Transform>().computeTransformMatrix();
+  m_cullingStats = CullingStats();
+  m_renderQueue.clear();
+
+  const Vec3f& camPos     = camTransform.getPosition();
+  const float fieldOfView = camera.getFieldOfViewRadians();
+
+  // Per-entity work is spread across threads, producing commands which are then submitted from this thread only
+  prepareDraws(viewProjMat, camPos, fieldOfView);
+
+  // The instances of each shared mesh are drawn at once for each level of detail, their transformations being stored contiguously
+  for (auto& sharedMesh : m_sharedMeshes) {
+    std::vector<LodInstances>& lodInstances = sharedMesh.second.lodInstances;
+
+    for (std::size_t lodIndex = 0; lodIndex < lodInstances.size(); ++lodIndex) {
+      LodInstances& instances = lodInstances[lodIndex];
+
+      if (instances.visibleTransforms.empty())
+        continue;
 
-        m_program.sendUniform("uniModelMatrix", modelMat);
-        m_program.sendUniform("uniMvpMatrix", modelMat * viewProjMat);
+      const std::size_t firstTransformIndex = m_renderQueue.getTransformCount();
 
-        entity->getComponent<Mesh>().draw(m_program);
+      for (const Mat4f& instanceTransform : instances.visibleTransforms)
+        m_renderQueue.addTransform(instanceTransform);
+
+      for (const SubmeshPtr& submesh : sharedMesh.first->getSubmeshes()) {
+        m_renderQueue.addInstancedCommand(m_program, recoverMaterial(*sharedMesh.first, *submesh), *submesh,
+                                          firstTransformIndex, instances.visibleTransforms.size(), instances.closestDepth,
+                                          std::min(lodIndex, submesh->getLodCount() - 1));
       }
+
+      m_cullingStats.visibleSubmeshCount += sharedMesh.first->getSubmeshes().size() * instances.visibleTransforms.size();
+
+      instances.visibleTransforms.clear();
+      instances.closestDepth = std::numeric_limits<float>::max();
     }
   }
 
-  if (m_cubemap)
+  // Grouping the draws sharing the same states, closest first to benefit from early depth testing
+  m_renderQueue.sort();
+
+  if (m_deferredRenderer) {
+    // Lights being applied on the pixels they reach, they do not need to be assigned to clusters
+    m_lightBuffer.uploadLights();
+    m_lightBuffer.bind();
+
+    {
+      GpuProfilerScope geometryScope(gpuProfiler, "Geometry");
+      m_deferredRenderer->bindGeometryPass();
+      m_renderQueue.submit(viewProjMat);
+    }
+
+    {
+      GpuProfilerScope lightingScope(gpuProfiler, "Lighting");
+      m_deferredRenderer->applyLights(m_lightVolumes, camPos);
+    }
+
+    GpuProfilerScope resolveScope(gpuProfiler, "Resolve");
+    m_deferredRenderer->resolve(m_window.getFramebufferIndex());
+  } else {
+    updateLightClusters(viewProjMat);
+
+    GpuProfilerScope geometryScope(gpuProfiler, "Geometry");
+    m_renderQueue.submit(viewProjMat);
+  }
+
+  if (m_cubemap) {
+    GpuProfilerScope cubemapScope(gpuProfiler, "Cubemap");
     m_cubemap->draw(camera);
+  }
+
+  return m_window.run(deltaTime, gpuProfiler);
+}
+
+const Mesh* RenderSystem::recoverMesh(const Entity& entity) {
+  if (entity.hasComponent<Mesh>())
+    return &entity.getComponent<Mesh>();
+
+  if (entity.hasComponent<MeshInstance>())
+    return &entity.getComponent<MeshInstance>().getMesh();
+
+  return nullptr;
+}
+
+const Material* RenderSystem::recoverMaterial(const Mesh& mesh, const Submesh& submesh) {
+  if (mesh.getMaterials().empty())
+    return nullptr;
+
+  return mesh.getMaterials()[submesh.getMaterialIndex()].get();
+}
+
+void RenderSystem::updateMeshBounds(MeshBounds& bounds, const Mesh& mesh, const Mat4f& modelMat) {
+  const std::vector<SubmeshPtr>& submeshes = mesh.getSubmeshes();
+
+  // New bounds having no submesh box, they are always computed unless the mesh has no submesh at all
+  if (bounds.submeshBoxes.size() == submeshes.size() && bounds.transform == modelMat)
+    return;
+
+  bounds.transform = modelMat;
+  bounds.submeshBoxes.clear();
+  bounds.submeshBoxes.reserve(submeshes.size());
+
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  bool hasVertices = false;
+
+  for (const SubmeshPtr& submesh : submeshes) {
+    bounds.submeshBoxes.emplace_back(submesh->getBoundingBox().computeTransformedBox(modelMat));
+
+    // Empty submeshes' bounds are null, and must not enlarge the entity's box
+    if (submesh->getVertexCount() == 0)
+      continue;
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      minPos[axisIndex] = std::min(minPos[axisIndex], bounds.submeshBoxes.back().getLeftBottomBackPos()[axisIndex]);
+      maxPos[axisIndex] = std::max(maxPos[axisIndex], bounds.submeshBoxes.back().getRightTopFrontPos()[axisIndex]);
+    }
+
+    hasVertices = true;
+  }
+
+  bounds.box = (hasVertices ? AABB(maxPos, minPos) : AABB(Vec3f(0.f), Vec3f(0.f)));
+}
+
+std::size_t RenderSystem::updateLod(MeshBounds& bounds, const Mesh& mesh, const Vec3f& camPos, float fieldOfView) const {
+  std::size_t lodCount = 1;
+
+  for (const SubmeshPtr& submesh : mesh.getSubmeshes())
+    lodCount = std::max(lodCount, submesh->getLodCount());
+
+  if (lodCount == 1) {
+    bounds.lodIndex = 0;
+    return 0;
+  }
+
+  // The world-space box being already known, its enclosing sphere is used rather than transforming the mesh's one
+  const Vec3f boxCentroid = bounds.box.computeCentroid();
+  const float radius      = (bounds.box.getRightTopFrontPos() - boxCentroid).computeLength();
+  const float screenSize  = LodSelector::computeScreenSize(radius, (boxCentroid - camPos).computeLength(), fieldOfView);
 
-  return m_window.run(deltaTime);
+  bounds.lodIndex = m_lodSelector.select(screenSize, bounds.lodIndex, lodCount);
+  return bounds.lodIndex;
+}
+
+void RenderSystem::runPrepareTasks(std::size_t itemCount, const std::function<void(std::size_t, std::size_t, std::size_t)>& task) {
+  const std::size_t taskCount = (itemCount + PrepareTaskItemCount - 1) / PrepareTaskItemCount;
+
+  // Waking up the threads would cost more than it saves for a single task
+  if (taskCount <= 1) {
+    if (itemCount > 0)
+      task(0, 0, itemCount);
+
+    return;
+  }
+
+  for (std::size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex) {
+    m_threadPool.addTask([&task, itemCount, taskIndex] () {
+      const std::size_t firstIndex = taskIndex * PrepareTaskItemCount;
+      task(taskIndex, firstIndex, std::min(firstIndex + PrepareTaskItemCount, itemCount));
+    });
+  }
+
+  m_threadPool.wait();
+}
+
+void RenderSystem::prepareDraws(const Mat4f& viewProjMat, const Vec3f& camPos, float fieldOfView) {
+  // Creating the bounds & registering the materials modify shared containers, and must thus be done beforehand on a single thread
+  m_culledEntities.clear();
+
+  for (Entity* entity : m_entities) {
+    if (!entity->isEnabled() || !entity->hasComponent<Transform>())
+      continue;
+
+    const Mesh* mesh = recoverMesh(*entity);
+
+    if (mesh == nullptr)
+      continue;
+
+    m_culledEntities.emplace_back(entity, &m_meshBounds[entity]);
+
+    for (const MaterialPtr& material : mesh->getMaterials())
+      m_renderQueue.registerMaterial(material.get());
+  }
+
+  const std::size_t entityCount = m_culledEntities.size();
+  const std::size_t taskCount   = (entityCount + PrepareTaskItemCount - 1) / PrepareTaskItemCount;
+
+  runPrepareTasks(entityCount, [this] (std::size_t, std::size_t firstIndex, std::size_t lastIndex) {
+    for (std::size_t entityIndex = firstIndex; entityIndex < lastIndex; ++entityIndex) {
+      const Entity& entity = *m_culledEntities[entityIndex].first;
+      updateMeshBounds(*m_culledEntities[entityIndex].second, *recoverMesh(entity), entity.getComponent<Transform>().computeTransformMatrix());
+    }
+  });
+
+  const Frustum frustum(viewProjMat);
+
+  if (m_isFrustumCullingEnabled) {
+    // Checking all the mesh entities' boxes at once against the frustum
+    m_culledEntityBoxes.clear();
+    m_culledEntityBoxes.reserve(entityCount);
+
+    for (const std::pair<const Entity*, MeshBounds*>& culledEntity : m_culledEntities)
+      m_culledEntityBoxes.addBox(culledEntity.second->box);
+
+    if (entityCount > PrepareTaskItemCount)
+      frustum.computeVisibility(m_culledEntityBoxes, m_entityVisibilityMasks, m_threadPool);
+    else
+      frustum.computeVisibility(m_culledEntityBoxes, m_entityVisibilityMasks);
+
+    if (m_isOcclusionCullingEnabled) {
+      m_occlusionBuffer.clear(viewProjMat);
+
+      for (std::size_t entityIndex = 0; entityIndex < entityCount; ++entityIndex) {
+        const Entity& entity = *m_culledEntities[entityIndex].first;
+
+        if (entity.hasComponent<Occluder>() && (m_entityVisibilityMasks[entityIndex / 32] & (1u << (entityIndex % 32))))
+          m_occlusionBuffer.rasterizeMesh(*recoverMesh(entity), m_culledEntities[entityIndex].second->transform);
+      }
+
+      m_occlusionBuffer.buildHierarchy();
+    }
+  }
+
+  const bool isOcclusionCullingEnabled = (m_isFrustumCullingEnabled && m_isOcclusionCullingEnabled);
+
+  if (m_preparedDraws.size() < taskCount)
+    m_preparedDraws.resize(taskCount);
+
+  runPrepareTasks(entityCount, [this, &frustum, &camPos, fieldOfView, isOcclusionCullingEnabled] (std::size_t taskIndex,
+                                                                                                std::size_t firstIndex,
+                                                                                                std::size_t lastIndex) {
+    PreparedDraws& draws = m_preparedDraws[taskIndex];
+    draws.commands.clear();
+    draws.transforms.clear();
+    draws.instances.clear();
+    draws.cullingStats = CullingStats();
+
+    for (std::size_t entityIndex = firstIndex; entityIndex < lastIndex; ++entityIndex) {
+      const Entity& entity   = *m_culledEntities[entityIndex].first;
+      const Mesh& mesh       = *recoverMesh(entity);
+      MeshBounds& meshBounds = *m_culledEntities[entityIndex].second;
+
+      ++draws.cullingStats.entityCount;
+      draws.cullingStats.submeshCount += mesh.getSubmeshes().size();
+
+      if (m_isFrustumCullingEnabled && (m_entityVisibilityMasks[entityIndex / 32] & (1u << (entityIndex % 32))) == 0)
+        continue;
+
+      // Occluders cannot hide themselves, being rasterized in the occlusion buffer
+      if (isOcclusionCullingEnabled && !entity.hasComponent<Occluder>() && m_occlusionBuffer.isOccluded(meshBounds.box)) {
+        ++draws.cullingStats.occludedEntityCount;
+        continue;
+      }
+
+      ++draws.cullingStats.visibleEntityCount;
+
+      const std::size_t lod = updateLod(meshBounds, mesh, camPos, fieldOfView);
+
+      // Instances are drawn with all their submeshes, only the whole entity being culled
+      if (entity.hasComponent<MeshInstance>()) {
+        draws.instances.push_back({ &mesh, &meshBounds.transform, (meshBounds.box.computeCentroid() - camPos).computeSquaredLength(), lod });
+        continue;
+      }
+
+      const std::size_t transformIndex = draws.transforms.size();
+      draws.transforms.emplace_back(meshBounds.transform);
+
+      for (std::size_t submeshIndex = 0; submeshIndex < mesh.getSubmeshes().size(); ++submeshIndex) {
+        // A single submesh's box is the mesh's one, which is already known to be visible
+        if (m_isFrustumCullingEnabled && mesh.getSubmeshes().size() > 1 && !frustum.intersects(meshBounds.submeshBoxes[submeshIndex]))
+          continue;
+
+        const Submesh& submesh   = *mesh.getSubmeshes()[submeshIndex];
+        const Material* material = recoverMaterial(mesh, submesh);
+        const float depth        = (meshBounds.submeshBoxes[submeshIndex].computeCentroid() - camPos).computeSquaredLength();
+
+        RenderCommand command;
+        command.sortKey        = m_renderQueue.computeSortKey(m_program, material, submesh, depth);
+        command.program        = &m_program;
+        command.material       = material;
+        command.submesh        = &submesh;
+        command.transformIndex = transformIndex;
+        command.lodIndex       = std::min(lod, submesh.getLodCount() - 1);
+
+        draws.commands.emplace_back(command);
+        ++draws.cullingStats.visibleSubmeshCount;
+      }
+    }
+  });
+
+  // Merging the tasks' results in order, so that the commands are the same whatever the number of threads
+  for (std::size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex) {
+    const PreparedDraws& draws = m_preparedDraws[taskIndex];
+
+    m_renderQueue.addCommands(draws.commands, draws.transforms);
+
+    for (const PreparedInstance& instance : draws.instances)
+      addSharedMeshInstance(*instance.mesh, *instance.transform, instance.depth, instance.lodIndex);
+
+    m_cullingStats.entityCount         += draws.cullingStats.entityCount;
+    m_cullingStats.visibleEntityCount  += draws.cullingStats.visibleEntityCount;
+    m_cullingStats.occludedEntityCount += draws.cullingStats.occludedEntityCount;
+    m_cullingStats.submeshCount        += draws.cullingStats.submeshCount;
+    m_cullingStats.visibleSubmeshCount += draws.cullingStats.visibleSubmeshCount;
+  }
+}
+
+void RenderSystem::addSharedMeshInstance(const Mesh& mesh, const Mat4f& modelMat, float depth, std::size_t lodIndex) {
+  std::vector<LodInstances>& lodInstances = m_sharedMeshes[&mesh].lodInstances;
+
+  if (lodIndex >= lodInstances.size())
+    lodInstances.resize(lodIndex + 1);
+
+  LodInstances& instances = lodInstances[lodIndex];
+  instances.visibleTransforms.emplace_back(modelMat);
+  instances.closestDepth = std::min(instances.closestDepth, depth);
 }
 
 void RenderSystem::sendCameraMatrices(const Mat4f& viewProjMat) const {
@@ -86,52 +466,82 @@ void RenderSystem::sendCameraMatrices() const {
   sendCameraMatrices(camera.getViewMatrix() * camera.getProjectionMatrix());
 }
 
-void RenderSystem::updateLight(const Entity* entity, std::size_t lightIndex) const {
-  m_program.use();
-
-  const std::string strBase = "uniLights[" + std::to_string(lightIndex) + "].";
-
-  const std::string posStr    = strBase + "position";
-  const std::string colorStr  = strBase + "color";
-  const std::string energyStr = strBase + "energy";
-  const std::string angleStr  = strBase + "angle";
-
+void RenderSystem::updateLight(const Entity* entity, std::size_t lightIndex) {
   const auto& lightComp = entity->getComponent<Light>();
-  Vec4f homogeneousPos(entity->getComponent<Transform>().getPosition(), 1.f);
+  const Vec3f& lightPos = entity->getComponent<Transform>().getPosition();
 
-  if (lightComp.getType() == LightType::DIRECTIONAL) {
-    homogeneousPos[3] = 0.f;
-    m_program.sendUniform(strBase + "direction", lightComp.getDirection());
-  }
-
-  m_program.sendUniform(posStr,    homogeneousPos);
-  m_program.sendUniform(colorStr,  lightComp.getColor());
-  m_program.sendUniform(energyStr, lightComp.getEnergy());
-  m_program.sendUniform(angleStr,  lightComp.getAngle());
+  m_lightBuffer.setLight(lightIndex, lightComp, lightPos);
+  m_lightVolumes[lightIndex] = Sphere(lightPos, lightComp.computeRange(m_lightAttenuationThreshold));
 }
 
-void RenderSystem::updateLights() const {
+void RenderSystem::updateLights() {
   std::size_t lightCount = 0;
 
   for (const auto& entity : m_entities) {
-    if (entity->hasComponent<Light>()) {
-      updateLight(entity, lightCount);
+    if (entity->hasComponent<Light>())
       ++lightCount;
-    }
   }
 
-  m_program.sendUniform("uniLightCount", lightCount);
+  m_lightBuffer.setLightCount(lightCount);
+  m_lightVolumes.assign(lightCount, Sphere(Vec3f(0.f), 0.f));
+
+  std::size_t lightIndex = 0;
+
+  for (const auto& entity : m_entities) {
+    if (entity->hasComponent<Light>())
+      updateLight(entity, lightIndex++);
+  }
+}
+
+void RenderSystem::loadMesh(const Mesh& mesh) {
+  if (m_geometryArena)
+    mesh.load(m_program, *m_geometryArena);
+  else
+    mesh.load(m_program, m_vertexLayout);
+}
+
+void RenderSystem::updateLightClusters(const Mat4f& viewProjMat) {
+  const auto& camera = m_camera.getComponent<Camera>();
+
+  m_lightBuffer.uploadLights();
+
+  m_lightClusterGrid.build(viewProjMat, camera.getNearPlane(), camera.getFarPlane(), m_lightVolumes);
+  m_lightBuffer.uploadClusters(m_lightClusterGrid);
+  m_lightBuffer.bind();
+
+  const auto tileCountX = static_cast<float>(m_lightClusterGrid.getTileCountX());
+  const auto tileCountY = static_cast<float>(m_lightClusterGrid.getTileCountY());
+
+  m_program.sendUniform("uniClusterScreenParams", Vec4f({ tileCountX / static_cast<float>(m_window.getWidth()),
+                                                          tileCountY / static_cast<float>(m_window.getHeight()),
+                                                          tileCountX,
+                                                          tileCountY }));
+  m_program.sendUniform("uniClusterDepthParams", Vec4f({ m_lightClusterGrid.getNearPlane(),
+                                                         m_lightClusterGrid.getSliceScale(),
+                                                         static_cast<float>(m_lightClusterGrid.getSliceCount()),
+                                                         0.f }));
+  m_program.sendUniform("uniGlobalLightCount", static_cast<uint32_t>(m_lightClusterGrid.getGlobalLightCount()));
 }
 
-void RenderSystem::updateShaders() const {
+void RenderSystem::updateShaders() {
   m_program.updateShaders();
+  m_lightBuffer.initProgram(m_program);
+
+  if (m_deferredRenderer) {
+    m_deferredRenderer->updateShaders();
+    m_lightBuffer.initProgram(m_deferredRenderer->getLightingProgram());
+  }
+
   sendCameraMatrices();
   updateLights();
 
   for (auto& entity : m_entities) {
     if (entity->hasComponent<Mesh>())
-      entity->getComponent<Mesh>().load(m_program);
+      loadMesh(entity->getComponent<Mesh>());
   }
+
+  for (const auto& sharedMesh : m_sharedMeshes)
+    loadMesh(*sharedMesh.first);
 }
 
 } // namespace Raz
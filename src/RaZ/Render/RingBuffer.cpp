@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "RaZ/Render/RingBuffer.hpp"
+
+namespace Raz {
+
+RingBuffer::RingBuffer(GLenum target, std::size_t regionSize, std::size_t regionCount)
+  : m_target{ target }, m_regionCount{ regionCount }, m_fences(regionCount, nullptr) {
+  if (regionCount == 0)
+    throw std::runtime_error("Error: A ring buffer must have at least one region.");
+
+  allocate(regionSize);
+}
+
+std::size_t RingBuffer::write(const void* data, std::size_t size) {
+  if (size > m_regionSize) {
+    release();
+    allocate(std::max(size, m_regionSize * 2));
+  }
+
+  bind();
+
+  if (m_mappedData == nullptr) {
+    // Orphaning the storage, so that the driver does not have to wait for the GPU to be done with the previous data
+    glBufferData(m_target, static_cast<GLsizeiptr>(m_regionSize), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(m_target, 0, static_cast<GLsizeiptr>(size), data);
+
+    return 0;
+  }
+
+  m_regionIndex = (m_regionIndex + 1) % m_regionCount;
+  waitForRegion(m_regionIndex);
+
+  const std::size_t regionOffset = m_regionIndex * m_regionSize;
+  std::memcpy(m_mappedData + regionOffset, data, size);
+
+  return regionOffset;
+}
+
+void RingBuffer::fence() {
+  if (m_mappedData == nullptr)
+    return;
+
+  if (m_fences[m_regionIndex])
+    glDeleteSync(m_fences[m_regionIndex]);
+
+  m_fences[m_regionIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void RingBuffer::allocate(std::size_t regionSize) {
+  m_regionSize  = regionSize;
+  m_regionIndex = 0;
+
+  glGenBuffers(1, &m_index);
+  bind();
+
+  if (!GLEW_ARB_buffer_storage) {
+    glBufferData(m_target, static_cast<GLsizeiptr>(m_regionSize), nullptr, GL_STREAM_DRAW);
+    return;
+  }
+
+  // The mapping being coherent, written data is visible to the GPU without any explicit flush
+  constexpr GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  const auto bufferSize         = static_cast<GLsizeiptr>(m_regionSize * m_regionCount);
+
+  glBufferStorage(m_target, bufferSize, nullptr, mapFlags);
+  m_mappedData = static_cast<uint8_t*>(glMapBufferRange(m_target, 0, bufferSize, mapFlags));
+}
+
+void RingBuffer::waitForRegion(std::size_t regionIndex) {
+  GLsync& regionFence = m_fences[regionIndex];
+
+  if (regionFence == nullptr)
+    return;
+
+  constexpr GLuint64 timeout = 1000000; // 1 ms, in nanoseconds
+
+  while (glClientWaitSync(regionFence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout) == GL_TIMEOUT_EXPIRED);
+
+  glDeleteSync(regionFence);
+  regionFence = nullptr;
+}
+
+void RingBuffer::release() {
+  if (m_index == 0)
+    return;
+
+  for (std::size_t regionIndex = 0; regionIndex < m_regionCount; ++regionIndex)
+    waitForRegion(regionIndex);
+
+  if (m_mappedData) {
+    bind();
+    glUnmapBuffer(m_target);
+    m_mappedData = nullptr;
+  }
+
+  StateCache::get().deleteBuffer(m_index);
+}
+
+} // namespace Raz
@@ -110,6 +110,11 @@ void ShaderProgram::sendUniform(int uniformIndex, float value) const {
   glUniform1f(uniformIndex, value);
 }
 
+template <>
+void ShaderProgram::sendUniform(int uniformIndex, const Vec2f& vec) const {
+  glUniform2fv(uniformIndex, 1, vec.getDataPtr());
+}
+
 template <>
 void ShaderProgram::sendUniform(int uniformIndex, const Vec3f& vec) const {
   glUniform3fv(uniformIndex, 1, vec.getDataPtr());
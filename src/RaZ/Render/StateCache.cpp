@@ -0,0 +1,223 @@
+#include "RaZ/Render/StateCache.hpp"
+
+namespace Raz {
+
+constexpr GLuint StateCache::UnknownValue;
+
+StateCache& StateCache::get() {
+  static StateCache stateCache;
+  return stateCache;
+}
+
+void StateCache::useProgram(GLuint programIndex) {
+  if (update(&m_program, programIndex))
+    glUseProgram(programIndex);
+}
+
+void StateCache::bindVertexArray(GLuint vertexArrayIndex) {
+  if (!update(&m_vertexArray, vertexArrayIndex))
+    return;
+
+  glBindVertexArray(vertexArrayIndex);
+  m_buffers[recoverBufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = UnknownValue;
+}
+
+void StateCache::bindBuffer(GLenum target, GLuint bufferIndex) {
+  const std::size_t slot = recoverBufferSlot(target);
+
+  if (update((slot != UntrackedSlot ? &m_buffers[slot] : nullptr), bufferIndex))
+    glBindBuffer(target, bufferIndex);
+}
+
+void StateCache::bindBufferRange(GLenum target, GLuint bindingIndex, GLuint bufferIndex, GLintptr offset, GLsizeiptr size) {
+  glBindBufferRange(target, bindingIndex, bufferIndex, offset, size);
+  ++m_stats.issuedCallCount;
+
+  const std::size_t slot = recoverBufferSlot(target);
+
+  if (slot != UntrackedSlot)
+    m_buffers[slot] = bufferIndex;
+}
+
+void StateCache::bindBufferBase(GLenum target, GLuint bindingIndex, GLuint bufferIndex) {
+  glBindBufferBase(target, bindingIndex, bufferIndex);
+  ++m_stats.issuedCallCount;
+
+  const std::size_t slot = recoverBufferSlot(target);
+
+  if (slot != UntrackedSlot)
+    m_buffers[slot] = bufferIndex;
+}
+
+void StateCache::activateTextureUnit(uint8_t unit) {
+  if (update(&m_activeTextureUnit, unit))
+    glActiveTexture(GL_TEXTURE0 + unit);
+}
+
+void StateCache::bindTexture(GLenum target, GLuint textureIndex) {
+  const std::size_t slot = recoverTextureSlot(target);
+  const bool isTracked   = (slot != UntrackedSlot && m_activeTextureUnit < TextureUnitCount);
+
+  if (update((isTracked ? &m_textures[m_activeTextureUnit][slot] : nullptr), textureIndex))
+    glBindTexture(target, textureIndex);
+}
+
+void StateCache::bindFramebuffer(GLuint framebufferIndex) {
+  if (update(&m_framebuffer, framebufferIndex))
+    glBindFramebuffer(GL_FRAMEBUFFER, framebufferIndex);
+}
+
+void StateCache::setCapability(GLenum capability, bool enabled) {
+  const std::size_t slot = recoverCapabilitySlot(capability);
+
+  if (!update((slot != UntrackedSlot ? &m_capabilities[slot] : nullptr), enabled))
+    return;
+
+  if (enabled)
+    glEnable(capability);
+  else
+    glDisable(capability);
+}
+
+bool StateCache::isCapabilityEnabled(GLenum capability) {
+  const std::size_t slot = recoverCapabilitySlot(capability);
+
+  if (slot != UntrackedSlot && m_capabilities[slot] != UnknownValue)
+    return (m_capabilities[slot] != 0);
+
+  const bool isEnabled = (glIsEnabled(capability) == GL_TRUE);
+
+  if (slot != UntrackedSlot)
+    m_capabilities[slot] = isEnabled;
+
+  return isEnabled;
+}
+
+void StateCache::setDepthFunction(GLenum function) {
+  if (update(&m_depthFunction, function))
+    glDepthFunc(function);
+}
+
+void StateCache::setDepthMask(bool enabled) {
+  if (update(&m_depthMask, enabled))
+    glDepthMask(static_cast<GLboolean>(enabled ? GL_TRUE : GL_FALSE));
+}
+
+void StateCache::setCullFace(GLenum face) {
+  if (update(&m_cullFace, face))
+    glCullFace(face);
+}
+
+void StateCache::setBlendFunction(GLenum sourceFactor, GLenum destinationFactor) {
+  // Blending factors all fit in 16 bits, letting both be tracked as a single state
+  if (update(&m_blendFunction, (sourceFactor << 16u) | destinationFactor))
+    glBlendFunc(sourceFactor, destinationFactor);
+}
+
+void StateCache::deleteBuffer(GLuint& bufferIndex) {
+  // A deleted object is unbound from everywhere it was bound to, its index being possibly reused afterward
+  for (GLuint& boundBuffer : m_buffers) {
+    if (boundBuffer == bufferIndex)
+      boundBuffer = 0;
+  }
+
+  glDeleteBuffers(1, &bufferIndex);
+  bufferIndex = 0;
+}
+
+void StateCache::deleteTexture(GLuint& textureIndex) {
+  for (std::array<GLuint, TextureTargetCount>& unitTextures : m_textures) {
+    for (GLuint& boundTexture : unitTextures) {
+      if (boundTexture == textureIndex)
+        boundTexture = 0;
+    }
+  }
+
+  glDeleteTextures(1, &textureIndex);
+  textureIndex = 0;
+}
+
+void StateCache::deleteVertexArray(GLuint& vertexArrayIndex) {
+  if (m_vertexArray == vertexArrayIndex) {
+    m_vertexArray = 0;
+    m_buffers[recoverBufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = UnknownValue;
+  }
+
+  glDeleteVertexArrays(1, &vertexArrayIndex);
+  vertexArrayIndex = 0;
+}
+
+void StateCache::deleteFramebuffer(GLuint& framebufferIndex) {
+  if (m_framebuffer == framebufferIndex)
+    m_framebuffer = 0;
+
+  glDeleteFramebuffers(1, &framebufferIndex);
+  framebufferIndex = 0;
+}
+
+void StateCache::invalidate() {
+  m_program           = UnknownValue;
+  m_vertexArray       = UnknownValue;
+  m_framebuffer       = UnknownValue;
+  m_activeTextureUnit = UnknownValue;
+  m_depthFunction     = UnknownValue;
+  m_depthMask         = UnknownValue;
+  m_cullFace          = UnknownValue;
+  m_blendFunction     = UnknownValue;
+
+  m_buffers.fill(UnknownValue);
+  m_capabilities.fill(UnknownValue);
+
+  for (std::array<GLuint, TextureTargetCount>& unitTextures : m_textures)
+    unitTextures.fill(UnknownValue);
+}
+
+std::size_t StateCache::recoverBufferSlot(GLenum target) {
+  switch (target) {
+    case GL_ARRAY_BUFFER:         return 0;
+    case GL_ELEMENT_ARRAY_BUFFER: return 1;
+    case GL_UNIFORM_BUFFER:       return 2;
+    case GL_TEXTURE_BUFFER:       return 3;
+    case GL_DRAW_INDIRECT_BUFFER: return 4;
+    case GL_COPY_READ_BUFFER:     return 5;
+    case GL_COPY_WRITE_BUFFER:    return 6;
+    case GL_PIXEL_UNPACK_BUFFER:  return 7;
+    default:                      return UntrackedSlot;
+  }
+}
+
+std::size_t StateCache::recoverTextureSlot(GLenum target) {
+  switch (target) {
+    case GL_TEXTURE_2D:       return 0;
+    case GL_TEXTURE_CUBE_MAP: return 1;
+    case GL_TEXTURE_BUFFER:   return 2;
+    default:                  return UntrackedSlot;
+  }
+}
+
+std::size_t StateCache::recoverCapabilitySlot(GLenum capability) {
+  switch (capability) {
+    case GL_DEPTH_TEST:   return 0;
+    case GL_CULL_FACE:    return 1;
+    case GL_BLEND:        return 2;
+    case GL_STENCIL_TEST: return 3;
+    case GL_SCISSOR_TEST: return 4;
+    default:              return UntrackedSlot;
+  }
+}
+
+bool StateCache::update(GLuint* currentValue, GLuint newValue) {
+  if (currentValue && *currentValue == newValue) {
+    ++m_stats.elidedCallCount;
+    return false;
+  }
+
+  if (currentValue)
+    *currentValue = newValue;
+
+  ++m_stats.issuedCallCount;
+
+  return true;
+}
+
+} // namespace Raz
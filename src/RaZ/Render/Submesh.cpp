@@ -1,57 +1,301 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include "RaZ/Render/MeshOptimizer.hpp"
+#include "RaZ/Render/MeshSimplifier.hpp"
+#include "RaZ/Render/ShaderProgram.hpp"
 #include "RaZ/Render/Submesh.hpp"
+#include "RaZ/Utils/Simd.hpp"
 
 namespace Raz {
 
-void Submesh::load() const {
+namespace {
+
+std::size_t computeIndexSize(GLenum indexType) {
+  return (indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t));
+}
+
+} // namespace
+
+std::size_t Submesh::computeLodFirstIndex(std::size_t lodIndex) const {
+  std::size_t firstIndex = 0;
+
+  for (std::size_t prevLodIndex = 0; prevLodIndex < lodIndex; ++prevLodIndex)
+    firstIndex += getLodIndices(prevLodIndex).size();
+
+  return firstIndex;
+}
+
+void Submesh::computeBounds() {
+  const std::vector<Vertex>& vertices = getVertices();
+
+  if (vertices.empty()) {
+    m_boundingBox    = AABB(Vec3f(0.f), Vec3f(0.f));
+    m_boundingSphere = Sphere(Vec3f(0.f), 0.f);
+    return;
+  }
+
+  // Positions are loaded 4 values at a time, the 4th lane (which overlaps the texcoords) being ignored
+  static_assert(offsetof(Vertex, position) + sizeof(float) * 4 <= sizeof(Vertex), "Error: A vertex's position must be followed by at least one float.");
+
+  Simd::Float4 minPos = Simd::Float4::load(vertices.front().position.getDataPtr());
+  Simd::Float4 maxPos = minPos;
+
+  for (const Vertex& vertex : vertices) {
+    const Simd::Float4 position = Simd::Float4::load(vertex.position.getDataPtr());
+
+    minPos = Simd::Float4::min(minPos, position);
+    maxPos = Simd::Float4::max(maxPos, position);
+  }
+
+  std::array<float, 4> minValues {};
+  std::array<float, 4> maxValues {};
+  minPos.store(minValues.data());
+  maxPos.store(maxValues.data());
+
+  m_boundingBox = AABB(Vec3f({ maxValues[0], maxValues[1], maxValues[2] }), Vec3f({ minValues[0], minValues[1], minValues[2] }));
+
+  // The sphere is centered on the box, its radius reaching the farthest vertex; it is thus tighter than the sphere enclosing the box
+  const Vec3f centroid = m_boundingBox.computeCentroid();
+  float maxSqDist = 0.f;
+
+  for (const Vertex& vertex : vertices)
+    maxSqDist = std::max(maxSqDist, (vertex.position - centroid).computeSquaredLength());
+
+  m_boundingSphere = Sphere(centroid, std::sqrt(maxSqDist));
+}
+
+void Submesh::computeBvh() {
+  const std::vector<Vertex>& vertices      = getVertices();
+  const std::vector<unsigned int>& indices = getIndices();
+
+  std::vector<AABB> triangleBoxes;
+  triangleBoxes.reserve(indices.size() / 3);
+
+  for (std::size_t triangleIndex = 0; triangleIndex < indices.size() / 3; ++triangleIndex) {
+    const Triangle triangle(vertices[indices[triangleIndex * 3]].position,
+                            vertices[indices[triangleIndex * 3 + 1]].position,
+                            vertices[indices[triangleIndex * 3 + 2]].position);
+    triangleBoxes.emplace_back(triangle.computeBoundingBox());
+  }
+
+  m_bvh.build(triangleBoxes);
+}
+
+bool Submesh::intersects(const Ray& ray, RayHit* hit, float maxDistance) const {
+  const std::vector<Vertex>& vertices      = getVertices();
+  const std::vector<unsigned int>& indices = getIndices();
+
+  RayHit closestHit;
+  closestHit.distance = maxDistance;
+
+  const auto checkTriangle = [&vertices, &indices, &ray, &closestHit] (std::size_t triangleIndex, float& maxDist) {
+    const Triangle triangle(vertices[indices[triangleIndex * 3]].position,
+                            vertices[indices[triangleIndex * 3 + 1]].position,
+                            vertices[indices[triangleIndex * 3 + 2]].position);
+
+    RayHit triangleHit;
+
+    if (!ray.intersects(triangle, &triangleHit) || triangleHit.distance >= maxDist)
+      return false;
+
+    closestHit               = triangleHit;
+    closestHit.triangleIndex = triangleIndex;
+    maxDist                  = triangleHit.distance;
+
+    return true;
+  };
+
+  bool hasHit = false;
+
+  if (!m_bvh.isEmpty()) {
+    hasHit = m_bvh.query(ray, maxDistance, checkTriangle);
+  } else {
+    for (std::size_t triangleIndex = 0; triangleIndex < indices.size() / 3; ++triangleIndex)
+      hasHit = checkTriangle(triangleIndex, maxDistance) || hasHit;
+  }
+
+  if (hasHit && hit)
+    *hit = closestHit;
+
+  return hasHit;
+}
+
+void Submesh::optimize(float overdrawThreshold) {
+  std::vector<Vertex>& vertices      = getVertices();
+  std::vector<unsigned int>& indices = getIndices();
+
+  MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+  MeshOptimizer::optimizeOverdraw(indices, vertices, overdrawThreshold);
+  MeshOptimizer::optimizeVertexFetch(vertices, indices);
+
+  m_lodIndices.clear();
+  m_lodErrors.clear();
+
+  // Triangles being referenced by their index, the hierarchy is invalidated by their reordering
+  if (!m_bvh.isEmpty())
+    computeBvh();
+}
+
+void Submesh::generateLods(std::size_t lodCount, float reductionRatio, float maxError) {
+  m_lodIndices.clear();
+  m_lodErrors.clear();
+
+  const std::vector<Vertex>& vertices = getVertices();
+
+  for (std::size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex) {
+    const std::vector<unsigned int>& prevIndices = getLodIndices(lodIndex);
+    const std::size_t targetIndexCount           = static_cast<std::size_t>(static_cast<float>(prevIndices.size() / 3) * reductionRatio) * 3;
+
+    // Each level being simplified from the previous one, its error is the sum of all errors so far
+    float error = 0.f;
+    std::vector<unsigned int> lodIndices = MeshSimplifier::simplify(vertices, prevIndices, targetIndexCount, maxError - getLodError(lodIndex), &error);
+
+    // A level barely simpler than the previous one would only take memory
+    if (lodIndices.empty() || static_cast<float>(lodIndices.size()) > static_cast<float>(prevIndices.size()) * 0.95f)
+      break;
+
+    MeshOptimizer::optimizeVertexCache(lodIndices, vertices.size());
+
+    m_lodIndices.emplace_back(std::move(lodIndices));
+    m_lodErrors.emplace_back(getLodError(lodIndex) + error);
+  }
+}
+
+void Submesh::load(const VertexLayout& layout) const {
+  unload();
+
   m_vao.bind();
+  m_vao.getEbo().bind();
 
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-               static_cast<int64_t>(sizeof(getIndices().front()) * getIndices().size()),
-               getIndices().data(),
-               GL_STATIC_DRAW);
+  // Indices only address the submesh's own vertices; they can thus be stored on 16 bits if there are few enough of them
+  m_indexType = (getVertexCount() <= std::size_t(std::numeric_limits<uint16_t>::max()) + 1 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT);
+
+  const std::vector<unsigned int> indices = gatherLodIndices();
+
+  if (m_indexType == GL_UNSIGNED_SHORT) {
+    const std::vector<uint16_t> shortIndices(indices.cbegin(), indices.cend());
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 static_cast<int64_t>(sizeof(uint16_t) * shortIndices.size()),
+                 shortIndices.data(),
+                 GL_STATIC_DRAW);
+  } else {
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 static_cast<int64_t>(sizeof(unsigned int) * indices.size()),
+                 indices.data(),
+                 GL_STATIC_DRAW);
+  }
+
+  const std::vector<uint8_t> vertexData = layout.packVertices(getVertices(), m_boundingBox);
 
   m_vbo.bind();
   glBufferData(GL_ARRAY_BUFFER,
-               static_cast<int64_t>(sizeof(getVertices().front()) * getVertices().size()),
-               getVertices().data(),
+               static_cast<int64_t>(vertexData.size()),
+               vertexData.data(),
                GL_STATIC_DRAW);
 
-  const uint8_t stride = sizeof(getVertices().front());
-
-  glVertexAttribPointer(0, 3,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        nullptr);
-  glEnableVertexAttribArray(0);
-
-  const std::size_t positionSize = sizeof(getVertices().front().position);
-  glVertexAttribPointer(1, 2,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        reinterpret_cast<void*>(positionSize));
-  glEnableVertexAttribArray(1);
-
-  const std::size_t texcoordsSize = sizeof(getVertices().front().texcoords);
-  glVertexAttribPointer(2, 3,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        reinterpret_cast<void*>(positionSize + texcoordsSize));
-  glEnableVertexAttribArray(2);
-
-  const std::size_t normalSize = sizeof(getVertices().front().normal);
-  glVertexAttribPointer(3, 3,
-                        GL_FLOAT, GL_FALSE,
-                        stride,
-                        reinterpret_cast<void*>(positionSize + texcoordsSize + normalSize));
-  glEnableVertexAttribArray(3);
+  m_vbo.setupAttributes(layout);
+
+  if (layout.positionFormat == PositionFormat::QUANTIZED_UNORM16) {
+    VertexPacking::computeDequantization(m_boundingBox, m_positionOffset, m_positionScale);
+  } else {
+    m_positionOffset = Vec3f(0.f);
+    m_positionScale  = Vec3f(1.f);
+  }
 
   m_vbo.unbind();
   m_vao.unbind();
 }
 
+void Submesh::load(GeometryArena& arena) const {
+  if (getVertices().empty() || getIndices().empty() || getVertexCount() > arena.getMaxGeometryVertexCount()) {
+    load(arena.getLayout());
+    return;
+  }
+
+  unload();
+
+  m_arenaHandle = arena.add(getVertices(), gatherLodIndices());
+  m_arena       = &arena;
+
+  m_positionOffset = Vec3f(0.f);
+  m_positionScale  = Vec3f(1.f);
+}
+
+void Submesh::unload() const {
+  if (m_arena == nullptr)
+    return;
+
+  m_arena->remove(m_arenaHandle);
+  m_arena = nullptr;
+}
+
+void Submesh::sendPositionDequantization(const ShaderProgram& program) const {
+  program.sendUniform("uniPositionOffset", m_positionOffset);
+  program.sendUniform("uniPositionScale", m_positionScale);
+}
+
+void Submesh::drawElements(std::size_t lodIndex) const {
+  const GeometryRange* range   = recoverGeometryRange();
+  const GLenum indexType       = recoverIndexType();
+  const auto indexCount        = static_cast<int>(getLodIndices(lodIndex).size());
+  const std::size_t firstIndex = (range ? range->firstIndex : 0) + computeLodFirstIndex(lodIndex);
+  const auto indexOffset       = reinterpret_cast<void*>(firstIndex * computeIndexSize(indexType));
+
+  if (range == nullptr) {
+    glDrawElements(GL_TRIANGLES, indexCount, indexType, indexOffset);
+    return;
+  }
+
+  glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, indexType, indexOffset, static_cast<int>(range->firstVertex));
+}
+
+void Submesh::drawElementsInstanced(std::size_t instanceCount, std::size_t baseInstance, std::size_t lodIndex) const {
+  const GeometryRange* range = recoverGeometryRange();
+  const GLenum indexType     = recoverIndexType();
+  const auto indexCount      = static_cast<int>(getLodIndices(lodIndex).size());
+
+  // Submeshes in an arena start at their own range, their indices being relative to their first vertex
+  const std::size_t firstIndex = (range ? range->firstIndex : 0) + computeLodFirstIndex(lodIndex);
+  const auto indexOffset       = reinterpret_cast<void*>(firstIndex * computeIndexSize(indexType));
+
+  if (range == nullptr) {
+    if (baseInstance == 0) {
+      glDrawElementsInstanced(GL_TRIANGLES, indexCount, indexType, indexOffset, static_cast<int>(instanceCount));
+      return;
+    }
+
+    glDrawElementsInstancedBaseInstance(GL_TRIANGLES, indexCount, indexType, indexOffset,
+                                        static_cast<int>(instanceCount), static_cast<GLuint>(baseInstance));
+    return;
+  }
+
+  const auto vertexOffset = static_cast<int>(range->firstVertex);
+
+  if (baseInstance == 0) {
+    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, indexCount, indexType, indexOffset, static_cast<int>(instanceCount), vertexOffset);
+    return;
+  }
+
+  glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, indexCount, indexType, indexOffset,
+                                                static_cast<int>(instanceCount), vertexOffset, static_cast<GLuint>(baseInstance));
+}
+
 void Submesh::draw() const {
-  m_vao.bind();
-  glDrawElements(GL_TRIANGLES, static_cast<int>(getIndexCount()), GL_UNSIGNED_INT, nullptr);
+  bind();
+  drawElements();
+}
+
+std::vector<unsigned int> Submesh::gatherLodIndices() const {
+  std::vector<unsigned int> indices;
+  indices.reserve(computeLodFirstIndex(getLodCount()));
+
+  for (std::size_t lodIndex = 0; lodIndex < getLodCount(); ++lodIndex)
+    indices.insert(indices.end(), getLodIndices(lodIndex).cbegin(), getLodIndices(lodIndex).cend());
+
+  return indices;
 }
 
 } // namespace Raz
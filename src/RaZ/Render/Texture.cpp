@@ -5,7 +5,34 @@
 
 namespace Raz {
 
-Texture::Texture(unsigned int width, unsigned int height, ImageColorspace colorspace) : Texture() {
+namespace {
+
+GLint recoverInternalFormat(ImageColorspace colorspace, ImageDataType dataType) {
+  if (dataType == ImageDataType::BYTE)
+    return static_cast<GLint>(colorspace);
+
+  switch (colorspace) {
+    case ImageColorspace::GRAY:
+      return GL_R32F;
+
+    case ImageColorspace::GRAY_ALPHA:
+      return GL_RG16F;
+
+    case ImageColorspace::RGB:
+      return GL_RGB16F;
+
+    case ImageColorspace::RGBA:
+    default:
+      return GL_RGBA16F;
+
+    case ImageColorspace::DEPTH:
+      return GL_DEPTH_COMPONENT32F;
+  }
+}
+
+} // namespace
+
+Texture::Texture(unsigned int width, unsigned int height, ImageColorspace colorspace, ImageDataType dataType) : Texture() {
   bind();
 
   if (colorspace != ImageColorspace::DEPTH) {
@@ -14,12 +41,12 @@ Texture::Texture(unsigned int width, unsigned int height, ImageColorspace colors
 
     glTexImage2D(GL_TEXTURE_2D,
                  0,
-                 static_cast<unsigned int>(colorspace),
+                 recoverInternalFormat(colorspace, dataType),
                  static_cast<int>(width),
                  static_cast<int>(height),
                  0,
                  static_cast<unsigned int>(colorspace),
-                 GL_UNSIGNED_BYTE,
+                 (dataType == ImageDataType::FLOAT ? GL_FLOAT : GL_UNSIGNED_BYTE),
                  nullptr);
     glGenerateMipmap(GL_TEXTURE_2D);
   } else {
@@ -49,72 +76,100 @@ TexturePtr Texture::recoverTexture(TexturePreset preset) {
   return texturePresets[static_cast<std::size_t>(preset)];
 }
 
-void Texture::load(const std::string& fileName) {
-  m_image = Image::create(fileName);
+void Texture::load(ImagePtr image) {
+  m_image = std::move(image);
 
   if (!m_image->isEmpty()) {
-    bind();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    uploadImage(m_image->getDataPtr());
+  } else { // Image not found, deleting it & defaulting texture to pure white
+    m_image.reset();
+    makePlainColored(Vec3b(static_cast<uint8_t>(TexturePreset::WHITE)));
+  }
+}
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+void Texture::loadFromUnpackBuffer(ImagePtr image, std::size_t bufferOffset) {
+  m_image = std::move(image);
+  uploadImage(reinterpret_cast<const void*>(bufferOffset));
+}
 
-    if (m_image->getColorspace() == ImageColorspace::GRAY || m_image->getColorspace() == ImageColorspace::GRAY_ALPHA) {
-      const std::array<int, 4> swizzle = { GL_RED,
-                                           GL_RED,
-                                           GL_RED,
-                                           (m_image->getColorspace() == ImageColorspace::GRAY ? GL_ONE : GL_GREEN) };
-      glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle.data());
-    }
+void Texture::uploadImage(const void* pixels) const {
+  bind();
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+  if (m_image->getColorspace() == ImageColorspace::GRAY || m_image->getColorspace() == ImageColorspace::GRAY_ALPHA) {
+    const std::array<int, 4> swizzle = { GL_RED,
+                                         GL_RED,
+                                         GL_RED,
+                                         (m_image->getColorspace() == ImageColorspace::GRAY ? GL_ONE : GL_GREEN) };
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle.data());
+  }
 
-    // Default internal format is the own image's colorspace; modified if the image is a floating point one
-    auto colorFormat = static_cast<int>(m_image->getColorspace());
+  // Default internal format is the own image's colorspace; modified if the image is a floating point one
+  auto colorFormat = static_cast<int>(m_image->getColorspace());
 
-    if (m_image->getDataType() == ImageDataType::FLOAT) {
-      switch (m_image->getColorspace()) {
-        case ImageColorspace::GRAY:
-          colorFormat = GL_R16F;
-          break;
+  if (m_image->getDataType() == ImageDataType::FLOAT) {
+    switch (m_image->getColorspace()) {
+      case ImageColorspace::GRAY:
+        colorFormat = GL_R16F;
+        break;
 
-        case ImageColorspace::GRAY_ALPHA:
-          colorFormat = GL_RG16F;
-          break;
+      case ImageColorspace::GRAY_ALPHA:
+        colorFormat = GL_RG16F;
+        break;
 
-        case ImageColorspace::RGB:
-          colorFormat = GL_RGB16F;
-          break;
+      case ImageColorspace::RGB:
+        colorFormat = GL_RGB16F;
+        break;
 
-        case ImageColorspace::RGBA:
-          colorFormat = GL_RGBA16F;
-          break;
+      case ImageColorspace::RGBA:
+        colorFormat = GL_RGBA16F;
+        break;
 
-        case ImageColorspace::DEPTH: // Unhandled here
-          break;
-      }
+      case ImageColorspace::DEPTH: // Unhandled here
+        break;
     }
-
-    glTexImage2D(GL_TEXTURE_2D,
-                 0,
-                 colorFormat,
-                 static_cast<int>(m_image->getWidth()),
-                 static_cast<int>(m_image->getHeight()),
-                 0,
-                 static_cast<unsigned int>(m_image->getColorspace()),
-                 (m_image->getDataType() == ImageDataType::FLOAT ? GL_FLOAT : GL_UNSIGNED_BYTE),
-                 m_image->getDataPtr());
-    glGenerateMipmap(GL_TEXTURE_2D);
-    unbind();
-  } else { // Image not found, deleting it & defaulting texture to pure white
-    m_image.reset();
-    makePlainColored(Vec3b(static_cast<uint8_t>(TexturePreset::WHITE)));
   }
+
+  glTexImage2D(GL_TEXTURE_2D,
+               0,
+               colorFormat,
+               static_cast<int>(m_image->getWidth()),
+               static_cast<int>(m_image->getHeight()),
+               0,
+               static_cast<unsigned int>(m_image->getColorspace()),
+               (m_image->getDataType() == ImageDataType::FLOAT ? GL_FLOAT : GL_UNSIGNED_BYTE),
+               pixels);
+  glGenerateMipmap(GL_TEXTURE_2D);
+  unbind();
 }
 
 void Texture::makePlainColored(const Vec3b& color) const {
   bind();
+
+  // Having no mipmap, the texture would be incomplete with the default minification filter
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
   glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, color.getDataPtr());
   unbind();
 }
 
+void TextureBindings::bind(const Texture& texture, uint8_t unit) {
+  if (m_textureIndices[unit] == texture.getIndex())
+    return;
+
+  Texture::activate(unit);
+  texture.bind();
+
+  m_textureIndices[unit] = texture.getIndex();
+  ++m_bindCount;
+}
+
+void TextureBindings::reset() {
+  m_textureIndices.fill(0);
+  m_bindCount = 0;
+}
+
 } // namespace Raz
@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+#include "RaZ/Render/TextureStreamer.hpp"
+
+namespace Raz {
+
+constexpr std::size_t TextureStreamer::DefaultUploadBudget;
+
+namespace {
+
+std::size_t computeImageSize(const Image& image) {
+  return static_cast<std::size_t>(image.getWidth()) * image.getHeight() * image.getChannelCount()
+       * (image.getDataType() == ImageDataType::FLOAT ? sizeof(float) : sizeof(uint8_t));
+}
+
+} // namespace
+
+TextureStreamer& TextureStreamer::get() {
+  static TextureStreamer textureStreamer;
+  return textureStreamer;
+}
+
+std::size_t TextureStreamer::getPendingCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pendingCount;
+}
+
+TexturePtr TextureStreamer::load(const std::string& filePath, TexturePreset placeholder) {
+  TexturePtr texture = Texture::create(static_cast<uint8_t>(placeholder == TexturePreset::WHITE ? 255 : 0));
+
+  if (m_threadPool == nullptr)
+    m_threadPool = std::make_unique<ThreadPool>();
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_pendingCount;
+  }
+
+  m_threadPool->addTask([this, filePath, weakTexture = std::weak_ptr<Texture>(texture)] () {
+    ImagePtr image;
+
+    // An image which cannot be decoded is uploaded empty, which makes the texture plain white as if it were loaded directly
+    try {
+      image = Image::create(filePath);
+    } catch (...) {
+      image = Image::create();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_decodedTextures.push_back({ weakTexture, std::move(image) });
+  });
+
+  return texture;
+}
+
+void TextureStreamer::update() {
+  uploadDecodedTextures(m_uploadBudget);
+}
+
+void TextureStreamer::flush() {
+  if (m_threadPool)
+    m_threadPool->wait();
+
+  uploadDecodedTextures(std::numeric_limits<std::size_t>::max());
+}
+
+void TextureStreamer::uploadDecodedTextures(std::size_t uploadBudget) {
+  // Buffers whose fence has been signaled can be written again
+  for (UnpackBuffer& buffer : m_unpackBuffers) {
+    if (buffer.fence == nullptr)
+      continue;
+
+    GLint syncStatus {};
+    glGetSynciv(buffer.fence, GL_SYNC_STATUS, 1, nullptr, &syncStatus);
+
+    if (syncStatus == GL_SIGNALED) {
+      glDeleteSync(buffer.fence);
+      buffer.fence = nullptr;
+    }
+  }
+
+  std::vector<DecodedTexture> decodedTextures;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_pendingCount == 0) {
+      const bool isReading = std::any_of(m_unpackBuffers.cbegin(), m_unpackBuffers.cend(), [] (const UnpackBuffer& buffer) {
+        return (buffer.fence != nullptr);
+      });
+
+      if (!isReading)
+        release();
+
+      return;
+    }
+
+    std::size_t uploadSize   = 0;
+    std::size_t textureCount = 0;
+
+    for (const DecodedTexture& decodedTexture : m_decodedTextures) {
+      const std::size_t imageSize = computeImageSize(*decodedTexture.image);
+
+      if (textureCount > 0 && uploadSize + imageSize > uploadBudget)
+        break;
+
+      uploadSize += imageSize;
+      ++textureCount;
+    }
+
+    decodedTextures.reserve(textureCount);
+    std::move(m_decodedTextures.begin(), m_decodedTextures.begin() + static_cast<std::ptrdiff_t>(textureCount), std::back_inserter(decodedTextures));
+    m_decodedTextures.erase(m_decodedTextures.begin(), m_decodedTextures.begin() + static_cast<std::ptrdiff_t>(textureCount));
+    m_pendingCount -= textureCount;
+  }
+
+  if (decodedTextures.empty())
+    return;
+
+  StateCache& stateCache = StateCache::get();
+
+  for (DecodedTexture& decodedTexture : decodedTextures) {
+    const TexturePtr texture = decodedTexture.texture.lock();
+
+    // The texture may have been destroyed while its image was being decoded
+    if (texture == nullptr)
+      continue;
+
+    if (decodedTexture.image->isEmpty()) {
+      stateCache.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+      texture->load(std::move(decodedTexture.image));
+      continue;
+    }
+
+    const std::size_t imageSize = computeImageSize(*decodedTexture.image);
+    UnpackBuffer& buffer        = recoverUnpackBuffer(imageSize);
+
+    void* bufferData = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(imageSize), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    std::memcpy(bufferData, decodedTexture.image->getDataPtr(), imageSize);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    // The rows of an image are tightly packed, whatever their size
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    texture->loadFromUnpackBuffer(std::move(decodedTexture.image), 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+
+  // Other uploads must not read from the unpack buffer
+  stateCache.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+TextureStreamer::UnpackBuffer& TextureStreamer::recoverUnpackBuffer(std::size_t size) {
+  UnpackBuffer* availableBuffer = nullptr;
+
+  for (UnpackBuffer& buffer : m_unpackBuffers) {
+    if (buffer.fence != nullptr)
+      continue;
+
+    // A buffer large enough is preferred, as it does not have to be reallocated
+    if (availableBuffer == nullptr || (availableBuffer->size < size && buffer.size > availableBuffer->size))
+      availableBuffer = &buffer;
+  }
+
+  if (availableBuffer == nullptr) {
+    m_unpackBuffers.emplace_back();
+    availableBuffer = &m_unpackBuffers.back();
+    glGenBuffers(1, &availableBuffer->index);
+  }
+
+  StateCache::get().bindBuffer(GL_PIXEL_UNPACK_BUFFER, availableBuffer->index);
+
+  if (availableBuffer->size < size) {
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+    availableBuffer->size = size;
+  }
+
+  return *availableBuffer;
+}
+
+void TextureStreamer::release() {
+  m_threadPool.reset();
+
+  for (UnpackBuffer& buffer : m_unpackBuffers) {
+    if (buffer.fence)
+      glDeleteSync(buffer.fence);
+
+    StateCache::get().deleteBuffer(buffer.index);
+  }
+
+  m_unpackBuffers.clear();
+}
+
+} // namespace Raz
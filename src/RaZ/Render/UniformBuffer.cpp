@@ -5,7 +5,7 @@ namespace Raz {
 UniformBuffer::UniformBuffer(unsigned int size, unsigned int bindingIndex) : UniformBuffer() {
   bind();
   glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_STATIC_DRAW);
-  glBindBufferRange(GL_UNIFORM_BUFFER, bindingIndex, m_index, 0, size);
+  StateCache::get().bindBufferRange(GL_UNIFORM_BUFFER, bindingIndex, m_index, 0, size);
   unbind();
 }
 
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/VertexLayout.hpp"
+#include "RaZ/Utils/FloatUtils.hpp"
+
+namespace Raz {
+
+namespace {
+
+/// Converts a value in [-1; 1] to a normalized signed integer of the given bit count, stored in the lowest bits of the result.
+uint32_t packSnorm(float value, unsigned int bitCount) {
+  const auto maxValue = static_cast<float>((1 << (bitCount - 1)) - 1);
+  const auto intValue = static_cast<int32_t>(std::round(std::min(std::max(value, -1.f), 1.f) * maxValue));
+
+  return (static_cast<uint32_t>(intValue) & ((1u << bitCount) - 1));
+}
+
+/// Converts a normalized signed integer of the given bit count, stored in the lowest bits of the given value, back to [-1; 1].
+float unpackSnorm(uint32_t bits, unsigned int bitCount) {
+  // Shifting the sign bit to the top & back extends it
+  const int32_t intValue = static_cast<int32_t>(bits << (32 - bitCount)) >> (32 - bitCount);
+  const auto maxValue    = static_cast<float>((1 << (bitCount - 1)) - 1);
+
+  return std::max(static_cast<float>(intValue) / maxValue, -1.f);
+}
+
+template <typename T>
+void writeValue(uint8_t*& dataPtr, const T& value) {
+  std::memcpy(dataPtr, &value, sizeof(T));
+  dataPtr += sizeof(T);
+}
+
+void defineAttribute(GLuint location, GLint componentCount, GLenum type, bool normalized, std::size_t stride, std::size_t& offset, std::size_t size) {
+  glVertexAttribPointer(location, componentCount,
+                        type, (normalized ? GL_TRUE : GL_FALSE),
+                        static_cast<GLsizei>(stride),
+                        reinterpret_cast<void*>(offset));
+  glEnableVertexAttribArray(location);
+
+  offset += size;
+}
+
+} // namespace
+
+VertexLayout VertexLayout::compressed(bool quantizePositions) {
+  VertexLayout layout;
+  layout.positionFormat  = (quantizePositions ? PositionFormat::QUANTIZED_UNORM16 : PositionFormat::FLOAT);
+  layout.texcoordsFormat = TexcoordsFormat::HALF_FLOAT;
+  layout.directionFormat = DirectionFormat::PACKED_10_10_10_2;
+
+  return layout;
+}
+
+std::vector<uint8_t> VertexLayout::packVertices(const std::vector<Vertex>& vertices, const AABB& bounds) const {
+  std::vector<uint8_t> data(vertices.size() * computeStride());
+
+  // The default layout matches the vertices' own
+  if (!isCompressed()) {
+    static_assert(sizeof(Vertex) == sizeof(float) * 11, "Error: Vertices must not contain padding.");
+
+    if (!vertices.empty())
+      std::memcpy(data.data(), vertices.data(), data.size());
+
+    return data;
+  }
+
+  uint8_t* dataPtr = data.data();
+
+  for (const Vertex& vertex : vertices) {
+    if (positionFormat == PositionFormat::FLOAT)
+      writeValue(dataPtr, vertex.position);
+    else
+      writeValue(dataPtr, VertexPacking::quantizePosition(vertex.position, bounds));
+
+    if (texcoordsFormat == TexcoordsFormat::FLOAT) {
+      writeValue(dataPtr, vertex.texcoords);
+    } else {
+      writeValue(dataPtr, FloatUtils::packHalfFloat(vertex.texcoords[0]));
+      writeValue(dataPtr, FloatUtils::packHalfFloat(vertex.texcoords[1]));
+    }
+
+    if (directionFormat == DirectionFormat::FLOAT) {
+      writeValue(dataPtr, vertex.normal);
+      writeValue(dataPtr, vertex.tangent);
+    } else {
+      // Vertices do not hold their bitangent's direction; tangent frames are thus right-handed, as the shaders assume
+      writeValue(dataPtr, VertexPacking::packDirection(vertex.normal, 0.f));
+      writeValue(dataPtr, VertexPacking::packDirection(vertex.tangent, 1.f));
+    }
+  }
+
+  return data;
+}
+
+void VertexLayout::setupAttributes() const {
+  const std::size_t stride = computeStride();
+  std::size_t offset = 0;
+
+  if (positionFormat == PositionFormat::FLOAT)
+    defineAttribute(0, 3, GL_FLOAT, false, stride, offset, computePositionSize());
+  else
+    defineAttribute(0, 3, GL_UNSIGNED_SHORT, true, stride, offset, computePositionSize());
+
+  if (texcoordsFormat == TexcoordsFormat::FLOAT)
+    defineAttribute(1, 2, GL_FLOAT, false, stride, offset, computeTexcoordsSize());
+  else
+    defineAttribute(1, 2, GL_HALF_FLOAT, false, stride, offset, computeTexcoordsSize());
+
+  if (directionFormat == DirectionFormat::FLOAT) {
+    defineAttribute(2, 3, GL_FLOAT, false, stride, offset, computeDirectionSize());
+    defineAttribute(3, 3, GL_FLOAT, false, stride, offset, computeDirectionSize());
+  } else {
+    defineAttribute(2, 4, GL_INT_2_10_10_10_REV, true, stride, offset, computeDirectionSize());
+    defineAttribute(3, 4, GL_INT_2_10_10_10_REV, true, stride, offset, computeDirectionSize());
+  }
+}
+
+namespace VertexPacking {
+
+std::array<uint16_t, 4> quantizePosition(const Vec3f& position, const AABB& bounds) {
+  const Vec3f& minPos = bounds.getLeftBottomBackPos();
+  const Vec3f& maxPos = bounds.getRightTopFrontPos();
+
+  std::array<uint16_t, 4> quantizedPos {};
+
+  for (std::size_t compIndex = 0; compIndex < 3; ++compIndex) {
+    const float extent = maxPos[compIndex] - minPos[compIndex];
+
+    // Flat boxes map all their positions to 0 along their null axes
+    if (extent <= 0.f)
+      continue;
+
+    const float normalizedComp = std::min(std::max((position[compIndex] - minPos[compIndex]) / extent, 0.f), 1.f);
+    quantizedPos[compIndex] = static_cast<uint16_t>(std::round(normalizedComp * 65535.f));
+  }
+
+  return quantizedPos;
+}
+
+void computeDequantization(const AABB& bounds, Vec3f& offset, Vec3f& scale) {
+  offset = bounds.getLeftBottomBackPos();
+  scale  = bounds.getRightTopFrontPos() - bounds.getLeftBottomBackPos();
+}
+
+uint32_t packDirection(const Vec3f& direction, float w) {
+  return packSnorm(direction[0], 10)
+      | (packSnorm(direction[1], 10) << 10)
+      | (packSnorm(direction[2], 10) << 20)
+      | (packSnorm(w, 2) << 30);
+}
+
+Vec3f unpackDirection(uint32_t packedDirection, float* w) {
+  if (w)
+    *w = unpackSnorm(packedDirection >> 30, 2);
+
+  return Vec3f({ unpackSnorm(packedDirection & 0x3FFu, 10),
+                 unpackSnorm((packedDirection >> 10) & 0x3FFu, 10),
+                 unpackSnorm((packedDirection >> 20) & 0x3FFu, 10) });
+}
+
+} // namespace VertexPacking
+
+} // namespace Raz
@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "RaZ/Utils/BoundingVolumeHierarchy.hpp"
+
+namespace Raz {
+
+namespace {
+
+void expandBounds(Vec3f& minPos, Vec3f& maxPos, const Vec3f& newMinPos, const Vec3f& newMaxPos) {
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    minPos[axisIndex] = std::min(minPos[axisIndex], newMinPos[axisIndex]);
+    maxPos[axisIndex] = std::max(maxPos[axisIndex], newMaxPos[axisIndex]);
+  }
+}
+
+} // namespace
+
+AABB BoundingVolumeHierarchy::recoverRootBox() const {
+  if (m_nodes.empty())
+    throw std::runtime_error("Error: Cannot recover the root box of an empty bounding volume hierarchy.");
+
+  return AABB(m_nodes.front().maxPos, m_nodes.front().minPos);
+}
+
+void BoundingVolumeHierarchy::build(const std::vector<AABB>& primitiveBoxes) {
+  m_nodes.clear();
+  m_primitiveIndices.resize(primitiveBoxes.size());
+
+  if (primitiveBoxes.empty())
+    return;
+
+  std::iota(m_primitiveIndices.begin(), m_primitiveIndices.end(), 0);
+
+  std::vector<Vec3f> centroids(primitiveBoxes.size());
+
+  for (std::size_t primIndex = 0; primIndex < primitiveBoxes.size(); ++primIndex)
+    centroids[primIndex] = primitiveBoxes[primIndex].computeCentroid();
+
+  // A binary tree with leaves of at least one primitive cannot have more than twice as many nodes as primitives
+  m_nodes.reserve(primitiveBoxes.size() * 2);
+  buildNode(primitiveBoxes, centroids, 0, primitiveBoxes.size(), 0);
+}
+
+void BoundingVolumeHierarchy::refit(const std::vector<AABB>& primitiveBoxes) {
+  if (primitiveBoxes.size() != m_primitiveIndices.size())
+    throw std::runtime_error("Error: Cannot refit a bounding volume hierarchy with a different number of primitives.");
+
+  // Children being always stored after their parent, going backward guarantees they are updated before it
+  for (std::size_t nodeIndex = m_nodes.size(); nodeIndex-- > 0;) {
+    Node& node = m_nodes[nodeIndex];
+
+    node.minPos = Vec3f(std::numeric_limits<float>::max());
+    node.maxPos = Vec3f(std::numeric_limits<float>::lowest());
+
+    if (node.primitiveCount > 0) {
+      for (std::size_t primIndex = node.index; primIndex < node.index + node.primitiveCount; ++primIndex) {
+        const AABB& primBox = primitiveBoxes[m_primitiveIndices[primIndex]];
+        expandBounds(node.minPos, node.maxPos, primBox.getLeftBottomBackPos(), primBox.getRightTopFrontPos());
+      }
+    } else {
+      const Node& firstChild  = m_nodes[nodeIndex + 1];
+      const Node& secondChild = m_nodes[node.index];
+
+      expandBounds(node.minPos, node.maxPos, firstChild.minPos, firstChild.maxPos);
+      expandBounds(node.minPos, node.maxPos, secondChild.minPos, secondChild.maxPos);
+    }
+  }
+}
+
+std::size_t BoundingVolumeHierarchy::buildNode(const std::vector<AABB>& primitiveBoxes, const std::vector<Vec3f>& centroids,
+                                               std::size_t firstIndex, std::size_t primitiveCount, std::size_t depth) {
+  const std::size_t nodeIndex = m_nodes.size();
+  m_nodes.emplace_back();
+
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+  Vec3f minCentroid(std::numeric_limits<float>::max());
+  Vec3f maxCentroid(std::numeric_limits<float>::lowest());
+
+  for (std::size_t primIndex = firstIndex; primIndex < firstIndex + primitiveCount; ++primIndex) {
+    const std::size_t primitive = m_primitiveIndices[primIndex];
+
+    expandBounds(minPos, maxPos, primitiveBoxes[primitive].getLeftBottomBackPos(), primitiveBoxes[primitive].getRightTopFrontPos());
+    expandBounds(minCentroid, maxCentroid, centroids[primitive], centroids[primitive]);
+  }
+
+  m_nodes[nodeIndex].minPos = minPos;
+  m_nodes[nodeIndex].maxPos = maxPos;
+
+  if (primitiveCount <= MaxLeafPrimitiveCount || depth + 1 >= MaxDepth) {
+    m_nodes[nodeIndex].index          = firstIndex;
+    m_nodes[nodeIndex].primitiveCount = primitiveCount;
+
+    return nodeIndex;
+  }
+
+  // Splitting the primitives in two halves along the axis on which their centroids are the most spread
+  const Vec3f centroidExtent = maxCentroid - minCentroid;
+  std::size_t splitAxis = 0;
+
+  if (centroidExtent[1] > centroidExtent[splitAxis])
+    splitAxis = 1;
+
+  if (centroidExtent[2] > centroidExtent[splitAxis])
+    splitAxis = 2;
+
+  const std::size_t firstHalfCount = primitiveCount / 2;
+  const auto firstIter = m_primitiveIndices.begin() + static_cast<std::ptrdiff_t>(firstIndex);
+
+  std::nth_element(firstIter,
+                   firstIter + static_cast<std::ptrdiff_t>(firstHalfCount),
+                   firstIter + static_cast<std::ptrdiff_t>(primitiveCount),
+                   [&centroids, splitAxis] (std::size_t primIndex1, std::size_t primIndex2) {
+                     return (centroids[primIndex1][splitAxis] < centroids[primIndex2][splitAxis]);
+                   });
+
+  buildNode(primitiveBoxes, centroids, firstIndex, firstHalfCount, depth + 1);
+  const std::size_t secondChildIndex = buildNode(primitiveBoxes, centroids, firstIndex + firstHalfCount, primitiveCount - firstHalfCount, depth + 1);
+
+  m_nodes[nodeIndex].index          = secondChildIndex;
+  m_nodes[nodeIndex].primitiveCount = 0;
+
+  return nodeIndex;
+}
+
+bool BoundingVolumeHierarchy::intersectsNode(const Node& node, const Ray& ray, float maxDistance, float& hitDistance) const {
+  const Vec3f firstHits  = (node.minPos - ray.getOrigin()) * ray.getInverseDirection();
+  const Vec3f secondHits = (node.maxPos - ray.getOrigin()) * ray.getInverseDirection();
+
+  const float minHitDist = std::max({ std::min(firstHits[0], secondHits[0]),
+                                      std::min(firstHits[1], secondHits[1]),
+                                      std::min(firstHits[2], secondHits[2]),
+                                      0.f });
+  const float maxHitDist = std::min({ std::max(firstHits[0], secondHits[0]),
+                                      std::max(firstHits[1], secondHits[1]),
+                                      std::max(firstHits[2], secondHits[2]) });
+
+  hitDistance = minHitDist;
+
+  return (minHitDist <= maxHitDist && minHitDist < maxDistance);
+}
+
+} // namespace Raz
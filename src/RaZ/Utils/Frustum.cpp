@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "RaZ/Utils/Frustum.hpp"
+#include "RaZ/Utils/Simd.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
+
+namespace Raz {
+
+constexpr std::size_t BoxArray::PackSize;
+
+namespace {
+
+/// Creates a normalized plane from the coefficients of its equation (ax + by + cz + d = 0), the inside being where it is positive.
+Plane computePlane(float coeffA, float coeffB, float coeffC, float coeffD) {
+  const Vec3f normal({ coeffA, coeffB, coeffC });
+  const float normalLength = normal.computeLength();
+
+  return Plane(-coeffD / normalLength, normal / normalLength);
+}
+
+/// Computes a plane's equation from the combination of two columns of a matrix.
+/// Points being multiplied on the left of matrices, the clip coordinates are obtained from their dot product with the matrix's columns.
+Plane computePlane(const Mat4f& mat, std::size_t firstColIndex, std::size_t secondColIndex, float secondColFactor) {
+  return computePlane(mat[firstColIndex] + mat[secondColIndex] * secondColFactor,
+                      mat[4 + firstColIndex] + mat[4 + secondColIndex] * secondColFactor,
+                      mat[8 + firstColIndex] + mat[8 + secondColIndex] * secondColFactor,
+                      mat[12 + firstColIndex] + mat[12 + secondColIndex] * secondColFactor);
+}
+
+constexpr std::size_t MaskBitCount = 32;
+
+// Number of boxes checked by each task when spreading the work among threads; must be a multiple of the mask size
+constexpr std::size_t TaskBoxCount = MaskBitCount * 256;
+
+} // namespace
+
+void BoxArray::reserve(std::size_t boxCount) {
+  const std::size_t paddedCount = (boxCount + PackSize - 1) / PackSize * PackSize;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    m_centroids[axisIndex].reserve(paddedCount);
+    m_halfExtents[axisIndex].reserve(paddedCount);
+  }
+}
+
+void BoxArray::addBox(const AABB& box) {
+  // Adding a whole pack of null boxes when the previous one is full, so that the arrays stay padded
+  if (m_boxCount % PackSize == 0) {
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      m_centroids[axisIndex].resize(m_boxCount + PackSize);
+      m_halfExtents[axisIndex].resize(m_boxCount + PackSize);
+    }
+  }
+
+  ++m_boxCount;
+  setBox(m_boxCount - 1, box);
+}
+
+void BoxArray::setBox(std::size_t boxIndex, const AABB& box) {
+  const Vec3f centroid    = box.computeCentroid();
+  const Vec3f halfExtents = box.computeHalfExtents();
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    m_centroids[axisIndex][boxIndex]   = centroid[axisIndex];
+    m_halfExtents[axisIndex][boxIndex] = halfExtents[axisIndex];
+  }
+}
+
+void BoxArray::clear() {
+  m_boxCount = 0;
+
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    m_centroids[axisIndex].clear();
+    m_halfExtents[axisIndex].clear();
+  }
+}
+
+Frustum::Frustum(const Mat4f& viewProjMat) : m_planes{ { computePlane(viewProjMat, 3, 0, 1.f),   // Left
+                                                        computePlane(viewProjMat, 3, 0, -1.f),  // Right
+                                                        computePlane(viewProjMat, 3, 1, 1.f),   // Bottom
+                                                        computePlane(viewProjMat, 3, 1, -1.f),  // Top
+                                                        computePlane(viewProjMat, 3, 2, 1.f),   // Near
+                                                        computePlane(viewProjMat, 3, 2, -1.f) } // Far
+                                                   } {}
+
+bool Frustum::contains(const Vec3f& point) const {
+  for (const Plane& plane : m_planes) {
+    if (plane.getNormal().dot(point) - plane.getDistance() < 0.f)
+      return false;
+  }
+
+  return true;
+}
+
+bool Frustum::intersects(const Sphere& sphere) const {
+  for (const Plane& plane : m_planes) {
+    if (plane.getNormal().dot(sphere.getCenter()) - plane.getDistance() < -sphere.getRadius())
+      return false;
+  }
+
+  return true;
+}
+
+bool Frustum::intersects(const AABB& box) const {
+  const Vec3f centroid    = box.computeCentroid();
+  const Vec3f halfExtents = box.computeHalfExtents();
+
+  // The box is outside if, for any plane, even its corner the farthest along the plane's normal is behind it
+  for (const Plane& plane : m_planes) {
+    const Vec3f& normal = plane.getNormal();
+
+    const float projExtent = halfExtents[0] * std::abs(normal[0])
+                           + halfExtents[1] * std::abs(normal[1])
+                           + halfExtents[2] * std::abs(normal[2]);
+
+    if (normal.dot(centroid) - plane.getDistance() < -projExtent)
+      return false;
+  }
+
+  return true;
+}
+
+void Frustum::computeVisibility(const BoxArray& boxes, std::vector<uint32_t>& visibilityMasks, std::size_t firstIndex, std::size_t boxCount) const {
+  if (firstIndex % MaskBitCount != 0)
+    throw std::runtime_error("Error: The index of the first box to check the visibility of must be a multiple of " + std::to_string(MaskBitCount) + ".");
+
+  const std::size_t maskCount = (boxes.getSize() + MaskBitCount - 1) / MaskBitCount;
+
+  if (visibilityMasks.size() < maskCount)
+    visibilityMasks.resize(maskCount);
+
+  const std::size_t lastIndex = firstIndex + std::min(boxCount, boxes.getSize() - std::min(firstIndex, boxes.getSize()));
+
+  // Broadcasting each plane's normal components, their absolute values & distance
+  std::array<std::array<Simd::Float8, 7>, 6> planePacks {};
+
+  for (std::size_t planeIndex = 0; planeIndex < m_planes.size(); ++planeIndex) {
+    const Plane& plane = m_planes[planeIndex];
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      planePacks[planeIndex][axisIndex]     = Simd::Float8(plane.getNormal()[axisIndex]);
+      planePacks[planeIndex][axisIndex + 3] = Simd::Float8(std::abs(plane.getNormal()[axisIndex]));
+    }
+
+    planePacks[planeIndex][6] = Simd::Float8(plane.getDistance());
+  }
+
+  const Simd::Float8 zero(0.f);
+
+  for (std::size_t packIndex = firstIndex; packIndex < lastIndex; packIndex += BoxArray::PackSize) {
+    const Simd::Float8 centroidX = Simd::Float8::load(boxes.getCentroids(0).data() + packIndex);
+    const Simd::Float8 centroidY = Simd::Float8::load(boxes.getCentroids(1).data() + packIndex);
+    const Simd::Float8 centroidZ = Simd::Float8::load(boxes.getCentroids(2).data() + packIndex);
+    const Simd::Float8 extentX   = Simd::Float8::load(boxes.getHalfExtents(0).data() + packIndex);
+    const Simd::Float8 extentY   = Simd::Float8::load(boxes.getHalfExtents(1).data() + packIndex);
+    const Simd::Float8 extentZ   = Simd::Float8::load(boxes.getHalfExtents(2).data() + packIndex);
+
+    uint32_t outsideMask = 0;
+
+    // A box is outside if, for any plane, even its corner the farthest along the plane's normal is behind it
+    for (const std::array<Simd::Float8, 7>& planePack : planePacks) {
+      const Simd::Float8 centroidDist = planePack[0] * centroidX + planePack[1] * centroidY + planePack[2] * centroidZ - planePack[6];
+      const Simd::Float8 projExtent   = planePack[3] * extentX + planePack[4] * extentY + planePack[5] * extentZ;
+
+      outsideMask |= (centroidDist + projExtent < zero).computeMask();
+    }
+
+    // Discarding the padding boxes after the last one
+    const std::size_t validCount = std::min(BoxArray::PackSize, lastIndex - packIndex);
+    const uint32_t validMask     = (1u << validCount) - 1;
+    const uint32_t visibleMask   = ~outsideMask & validMask;
+
+    uint32_t& visibilityMask = visibilityMasks[packIndex / MaskBitCount];
+    const std::size_t bitShift = packIndex % MaskBitCount;
+
+    visibilityMask = (visibilityMask & ~(((1u << BoxArray::PackSize) - 1) << bitShift)) | (visibleMask << bitShift);
+  }
+}
+
+void Frustum::computeVisibility(const BoxArray& boxes, std::vector<uint32_t>& visibilityMasks, ThreadPool& threadPool) const {
+  visibilityMasks.resize((boxes.getSize() + MaskBitCount - 1) / MaskBitCount);
+
+  // Each task checks a range of boxes starting on a new mask, so that no mask is written by several threads at once
+  for (std::size_t firstIndex = 0; firstIndex < boxes.getSize(); firstIndex += TaskBoxCount) {
+    threadPool.addTask([this, &boxes, &visibilityMasks, firstIndex] () {
+      computeVisibility(boxes, visibilityMasks, firstIndex, TaskBoxCount);
+    });
+  }
+
+  threadPool.wait();
+}
+
+} // namespace Raz
@@ -7,6 +7,44 @@
 
 namespace Raz {
 
+Image::Image(unsigned int width, unsigned int height, ImageColorspace colorspace, ImageDataType dataType)
+  : m_width{ width }, m_height{ height }, m_colorspace{ colorspace } {
+  switch (colorspace) {
+    case ImageColorspace::GRAY:
+    case ImageColorspace::DEPTH:
+      m_channelCount = 1;
+      break;
+
+    case ImageColorspace::GRAY_ALPHA:
+      m_channelCount = 2;
+      break;
+
+    case ImageColorspace::RGB:
+      m_channelCount = 3;
+      break;
+
+    case ImageColorspace::RGBA:
+      m_channelCount = 4;
+      break;
+  }
+
+  const std::size_t valueCount = static_cast<std::size_t>(width) * height * m_channelCount;
+
+  if (dataType == ImageDataType::FLOAT) {
+    ImageDataFPtr imgData = ImageDataF::create();
+    imgData->data.resize(valueCount);
+
+    m_bitDepth = 32;
+    m_data     = std::move(imgData);
+  } else {
+    ImageDataBPtr imgData = ImageDataB::create();
+    imgData->data.resize(valueCount);
+
+    m_bitDepth = 8;
+    m_data     = std::move(imgData);
+  }
+}
+
 void Image::read(const std::string& filePath, bool reverse) {
   std::ifstream file(filePath, std::ios_base::in | std::ios_base::binary);
 
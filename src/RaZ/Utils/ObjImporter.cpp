@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Render/TextureStreamer.hpp"
 #include "RaZ/Utils/FileUtils.hpp"
 
 namespace Raz {
@@ -34,7 +35,7 @@ TexturePtr loadTexture(const std::string& mtlFilePath, const std::string& textur
     map = loadedTexturePos->second;
   } else {
     const auto texturePath = FileUtils::extractPathToFile(mtlFilePath) + textureFileName;
-    map = Texture::create(texturePath);
+    map = (TextureStreamer::get().isEnabled() ? TextureStreamer::get().load(texturePath) : Texture::create(texturePath));
     loadedTextures.emplace(textureFileName, map);
   }
 
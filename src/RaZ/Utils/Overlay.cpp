@@ -1,5 +1,6 @@
 #include "imgui/imgui.h"
 #include "imgui/imgui_impl_glfw.h"
+#include "RaZ/Render/GpuProfiler.hpp"
 #include "RaZ/Utils/Overlay.hpp"
 
 namespace Raz {
@@ -44,6 +45,16 @@ void Overlay::addFpsCounter(const std::string& formattedText) {
   addElement(OverlayElementType::FPS_COUNTER, formattedText);
 }
 
+void Overlay::addGpuProfiler(const GpuProfiler& profiler) {
+  // Showing both frame times tells whether the frame is bound by the CPU or the GPU
+  addElement(OverlayElementType::GPU_PROFILER, "", [&profiler] () {
+    ImGui::Text("Frame time: %.3f ms (CPU) / %.3f ms (GPU)", 1000.f / ImGui::GetIO().Framerate, profiler.getFrameTime());
+
+    for (const GpuScopeTiming& timing : profiler.getScopeTimings())
+      ImGui::Text("%*s%s: %.3f ms", static_cast<int>(timing.depth * 2 + 2), "", timing.name.c_str(), timing.duration);
+  });
+}
+
 void Overlay::render() {
   ImGui_ImplGlfw_NewFrame();
 
@@ -84,6 +95,10 @@ void Overlay::render() {
       case OverlayElementType::FPS_COUNTER:
         ImGui::Text(std::get<1>(element).c_str(), ImGui::GetIO().Framerate);
         break;
+
+      case OverlayElementType::GPU_PROFILER:
+        std::get<2>(element)();
+        break;
     }
   }
 
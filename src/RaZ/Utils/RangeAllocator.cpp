@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "RaZ/Utils/RangeAllocator.hpp"
+
+namespace Raz {
+
+constexpr std::size_t RangeAllocator::InvalidOffset;
+
+RangeAllocator::RangeAllocator(std::size_t capacity) : m_capacity{ capacity } {
+  if (capacity > 0)
+    m_freeRanges.push_back(Range{ 0, capacity });
+}
+
+std::size_t RangeAllocator::computeLargestFreeSize() const {
+  std::size_t largestSize = 0;
+
+  for (const Range& freeRange : m_freeRanges)
+    largestSize = std::max(largestSize, freeRange.size);
+
+  return largestSize;
+}
+
+std::size_t RangeAllocator::allocate(std::size_t size) {
+  if (size == 0)
+    throw std::runtime_error("Error: Cannot allocate an empty range.");
+
+  const auto freeRangeIter = std::find_if(m_freeRanges.begin(), m_freeRanges.end(), [size] (const Range& freeRange) {
+    return (freeRange.size >= size);
+  });
+
+  if (freeRangeIter == m_freeRanges.end())
+    return InvalidOffset;
+
+  const std::size_t offset = freeRangeIter->offset;
+
+  // The allocation is taken from the free range's beginning, its remainder staying free
+  if (freeRangeIter->size == size) {
+    m_freeRanges.erase(freeRangeIter);
+  } else {
+    freeRangeIter->offset += size;
+    freeRangeIter->size   -= size;
+  }
+
+  m_allocations.emplace(offset, size);
+  m_allocatedSize += size;
+
+  return offset;
+}
+
+void RangeAllocator::free(std::size_t offset) {
+  const auto allocationIter = m_allocations.find(offset);
+
+  if (allocationIter == m_allocations.end())
+    throw std::runtime_error("Error: Cannot free a range which has not been allocated.");
+
+  m_allocatedSize -= allocationIter->second;
+  addFreeRange(Range{ offset, allocationIter->second });
+
+  m_allocations.erase(allocationIter);
+}
+
+void RangeAllocator::grow(std::size_t capacity) {
+  if (capacity < m_capacity)
+    throw std::runtime_error("Error: A range allocator's capacity cannot be reduced.");
+
+  if (capacity == m_capacity)
+    return;
+
+  addFreeRange(Range{ m_capacity, capacity - m_capacity });
+  m_capacity = capacity;
+}
+
+std::vector<RangeRelocation> RangeAllocator::defragment() {
+  std::vector<RangeRelocation> relocations;
+
+  std::map<std::size_t, std::size_t> packedAllocations;
+  std::size_t packedOffset = 0;
+
+  // Allocations being ordered by offset, each one can only move backward, to where the previous ones end
+  for (const std::pair<const std::size_t, std::size_t>& allocation : m_allocations) {
+    if (allocation.first != packedOffset)
+      relocations.push_back(RangeRelocation{ allocation.first, packedOffset, allocation.second });
+
+    packedAllocations.emplace_hint(packedAllocations.end(), packedOffset, allocation.second);
+    packedOffset += allocation.second;
+  }
+
+  m_allocations = std::move(packedAllocations);
+  m_freeRanges.clear();
+
+  if (packedOffset < m_capacity)
+    m_freeRanges.push_back(Range{ packedOffset, m_capacity - packedOffset });
+
+  return relocations;
+}
+
+void RangeAllocator::addFreeRange(Range range) {
+  auto nextRangeIter = std::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), range.offset, [] (const Range& freeRange, std::size_t offset) {
+    return (freeRange.offset < offset);
+  });
+
+  // Merging with the following range if contiguous
+  if (nextRangeIter != m_freeRanges.end() && range.offset + range.size == nextRangeIter->offset) {
+    range.size += nextRangeIter->size;
+    nextRangeIter = m_freeRanges.erase(nextRangeIter);
+  }
+
+  // Merging with the preceding range if contiguous, extending it instead of inserting a new one
+  if (nextRangeIter != m_freeRanges.begin()) {
+    Range& prevRange = *(nextRangeIter - 1);
+
+    if (prevRange.offset + prevRange.size == range.offset) {
+      prevRange.size += range.size;
+      return;
+    }
+  }
+
+  m_freeRanges.insert(nextRangeIter, range);
+}
+
+} // namespace Raz
@@ -29,24 +29,105 @@ bool solveQuadratic(float a, float b, float c, float& firstHitDist, float& secon
 
 } // namespace
 
-bool Ray::intersects(const Vec3f& point) const {
-  if (point == m_origin)
+bool Ray::intersects(const Vec3f& point, RayHit* hit) const {
+  if (point == m_origin) {
+    if (hit) {
+      hit->position = point;
+      hit->normal   = -m_direction;
+      hit->distance = 0.f;
+    }
+
     return true;
+  }
+
+  const Vec3f pointVec  = point - m_origin;
+  const float pointDist = pointVec.computeLength();
+  const Vec3f pointDir  = pointVec / pointDist;
 
-  const Vec3f pointDir = (point - m_origin).normalize();
+  if (!FloatUtils::checkNearEquality(pointDir.dot(m_direction), 1.f))
+    return false;
+
+  if (hit) {
+    hit->position = point;
+    hit->normal   = -m_direction;
+    hit->distance = pointDist;
+  }
 
-  return FloatUtils::checkNearEquality(pointDir.dot(m_direction), 1.f);
+  return true;
 }
 
-bool Ray::intersects(const Line&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Ray::intersects(const Line& line, RayHit* hit) const {
+  const Vec3f lineVec      = line.getEndPos() - line.getBeginPos();
+  const float lineSqLength = lineVec.dot(lineVec);
+
+  // A line with both extremities at the same position is a mere point
+  if (FloatUtils::checkNearEquality(lineSqLength, 0.f))
+    return intersects(line.getBeginPos(), hit);
+
+  // Computing the closest points between the ray & the line, which must coincide for them to intersect
+  // See: Real-Time Collision Detection (Christer Ericson), 5.1.9 - Closest Points of Two Line Segments
+  const Vec3f lineStartDir = m_origin - line.getBeginPos();
+  const float raySqLength  = m_direction.dot(m_direction);
+  const float rayLineAngle = m_direction.dot(lineVec);
+  const float rayStartDist = m_direction.dot(lineStartDir);
+  const float lineDist     = lineVec.dot(lineStartDir);
+  const float denominator  = raySqLength * lineSqLength - rayLineAngle * rayLineAngle;
+
+  // If the denominator is 0, both are parallel; any point of the ray can then be taken
+  float rayHitDist  = (denominator != 0.f ? std::max((rayLineAngle * lineDist - rayStartDist * lineSqLength) / denominator, 0.f) : 0.f);
+  float lineHitDist = (rayLineAngle * rayHitDist + lineDist) / lineSqLength;
+
+  if (lineHitDist < 0.f) {
+    lineHitDist = 0.f;
+    rayHitDist  = std::max(-rayStartDist / raySqLength, 0.f);
+  } else if (lineHitDist > 1.f) {
+    lineHitDist = 1.f;
+    rayHitDist  = std::max((rayLineAngle - rayStartDist) / raySqLength, 0.f);
+  }
+
+  const Vec3f rayPoint  = m_origin + m_direction * rayHitDist;
+  const Vec3f linePoint = line.getBeginPos() + lineVec * lineHitDist;
+
+  if (rayPoint != linePoint)
+    return false;
+
+  if (hit) {
+    // The normal is the component of the ray's opposite direction which is orthogonal to the line
+    Vec3f normal = -m_direction + lineVec * (m_direction.dot(lineVec) / lineSqLength);
+
+    if (FloatUtils::checkNearEquality(normal.computeSquaredLength(), 0.f))
+      normal = -m_direction;
+
+    hit->position = linePoint;
+    hit->normal   = normal.normalize();
+    hit->distance = rayHitDist * std::sqrt(raySqLength);
+  }
+
+  return true;
 }
 
-bool Ray::intersects(const Plane&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Ray::intersects(const Plane& plane, RayHit* hit) const {
+  const float dirAngle = plane.getNormal().dot(m_direction);
+
+  // If near 0, the ray & the plane are parallel to each other
+  if (FloatUtils::checkNearEquality(dirAngle, 0.f))
+    return false;
+
+  const float hitDist = (plane.getDistance() - plane.getNormal().dot(m_origin)) / dirAngle;
+
+  if (hitDist <= 0.f)
+    return false;
+
+  if (hit) {
+    hit->position = m_origin + m_direction * hitDist;
+    hit->normal   = plane.getNormal();
+    hit->distance = hitDist;
+  }
+
+  return true;
 }
 
-bool Ray::intersects(const Sphere& sphere) const {
+bool Ray::intersects(const Sphere& sphere, RayHit* hit) const {
   const Vec3f sphereDir = m_origin - sphere.getCenter();
 
   const float raySqLength = m_direction.dot(m_direction);
@@ -59,10 +140,22 @@ bool Ray::intersects(const Sphere& sphere) const {
     return false;
 
   // If the hit distances are negative, we've hit a sphere located behind the ray's origin
-  return (firstHitDist > 0.f || secondHitDist > 0.f);
+  if (firstHitDist <= 0.f && secondHitDist <= 0.f)
+    return false;
+
+  if (hit) {
+    // If only the first hit is negative, the ray's origin is inside the sphere
+    const float hitDist = (firstHitDist > 0.f ? firstHitDist : secondHitDist);
+
+    hit->position = m_origin + m_direction * hitDist;
+    hit->normal   = (hit->position - sphere.getCenter()).normalize();
+    hit->distance = hitDist;
+  }
+
+  return true;
 }
 
-bool Ray::intersects(const Triangle& triangle) const {
+bool Ray::intersects(const Triangle& triangle, RayHit* hit) const {
   const Vec3f firstEdge   = triangle.getSecondPos() - triangle.getFirstPos();
   const Vec3f secondEdge  = triangle.getThirdPos() - triangle.getFirstPos();
   const Vec3f pVec        = m_direction.cross(secondEdge);
@@ -87,15 +180,34 @@ bool Ray::intersects(const Triangle& triangle) const {
 
   const float hitDist = secondEdge.dot(qVec) * invDeterm;
 
-  return (hitDist > 0.f);
+  if (hitDist <= 0.f)
+    return false;
+
+  if (hit) {
+    hit->position = m_origin + m_direction * hitDist;
+    hit->normal   = firstEdge.cross(secondEdge).normalize();
+    hit->distance = hitDist;
+  }
+
+  return true;
 }
 
-bool Ray::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Ray::intersects(const Quad& quad, RayHit* hit) const {
+  //   leftTop        rightTop
+  //          x------x
+  //          |    / |
+  //          |  /   |
+  //          |/     |
+  //          x------x
+  // leftBottom      rightBottom
+
+  const Triangle topTriangle(quad.getLeftTopPos(), quad.getRightTopPos(), quad.getRightBottomPos());
+  const Triangle bottomTriangle(quad.getLeftTopPos(), quad.getRightBottomPos(), quad.getLeftBottomPos());
+
+  return (intersects(topTriangle, hit) || intersects(bottomTriangle, hit));
 }
 
-bool Ray::intersects(const AABB& aabb) const {
-  const Vec3f invDir({ 1.f / m_direction[0], 1.f / m_direction[1], 1.f / m_direction[2] });
+bool Ray::intersects(const AABB& aabb, RayHit* hit) const {
   Vec3f minPos = aabb.getLeftBottomBackPos();
   Vec3f maxPos = aabb.getRightTopFrontPos();
 
@@ -108,13 +220,38 @@ bool Ray::intersects(const AABB& aabb) const {
   if (m_direction[2] < 0.f)
     std::swap(minPos[2], maxPos[2]);
 
-  const Vec3f minHitPos = (minPos - m_origin) * invDir;
-  const Vec3f maxHitPos = (maxPos - m_origin) * invDir;
+  const Vec3f minHitPos = (minPos - m_origin) * m_invDirection;
+  const Vec3f maxHitPos = (maxPos - m_origin) * m_invDirection;
 
   const float minHitDist = std::max(minHitPos[0], std::max(minHitPos[1], std::max(minHitPos[2], 0.f)));
   const float maxHitDist = std::min(maxHitPos[0], std::min(maxHitPos[1], maxHitPos[2]));
 
-  return (minHitDist <= maxHitDist);
+  if (minHitDist > maxHitDist)
+    return false;
+
+  if (hit) {
+    // If the closest hit is behind the ray's origin, the latter is inside the box; the hit is then where the ray exits it
+    const bool isInside = (minHitDist <= 0.f);
+    const Vec3f& hitPos = (isInside ? maxHitPos : minHitPos);
+    const float hitDist = (isInside ? maxHitDist : minHitDist);
+
+    // The face hit is the one orthogonal to the axis on which the hit distance has been found
+    std::size_t hitAxis = 0;
+
+    for (std::size_t axisIndex = 1; axisIndex < 3; ++axisIndex) {
+      if (hitPos[axisIndex] == hitDist)
+        hitAxis = axisIndex;
+    }
+
+    Vec3f normal(0.f);
+    normal[hitAxis] = ((m_direction[hitAxis] < 0.f) != isInside ? 1.f : -1.f);
+
+    hit->position = m_origin + m_direction * hitDist;
+    hit->normal   = normal;
+    hit->distance = hitDist;
+  }
+
+  return true;
 }
 
 Vec3f Ray::computeProjection(const Vec3f& point) const {
@@ -0,0 +1,212 @@
+#include <cassert>
+#include <type_traits>
+
+#include "RaZ/Utils/RayPacket.hpp"
+#include "RaZ/Utils/Simd.hpp"
+
+namespace Raz {
+
+namespace {
+
+template <std::size_t Size>
+using PackType = typename std::conditional<Size == 8, Simd::Float8, Simd::Float4>::type;
+
+template <typename PackT>
+struct PackedVec3 {
+  PackT x {};
+  PackT y {};
+  PackT z {};
+};
+
+template <typename PackT>
+PackedVec3<PackT> broadcast(const Vec3f& vec) {
+  return { PackT(vec[0]), PackT(vec[1]), PackT(vec[2]) };
+}
+
+template <typename PackT>
+PackT dot(const PackedVec3<PackT>& vec1, const PackedVec3<PackT>& vec2) {
+  return vec1.x * vec2.x + vec1.y * vec2.y + vec1.z * vec2.z;
+}
+
+template <typename PackT>
+PackedVec3<PackT> cross(const PackedVec3<PackT>& vec1, const PackedVec3<PackT>& vec2) {
+  return { vec1.y * vec2.z - vec1.z * vec2.y,
+           vec1.z * vec2.x - vec1.x * vec2.z,
+           vec1.x * vec2.y - vec1.y * vec2.x };
+}
+
+template <typename PackT>
+PackedVec3<PackT> subtract(const PackedVec3<PackT>& vec1, const PackedVec3<PackT>& vec2) {
+  return { vec1.x - vec2.x, vec1.y - vec2.y, vec1.z - vec2.z };
+}
+
+} // namespace
+
+template <std::size_t Size>
+RayPacket<Size>::RayPacket(std::initializer_list<Ray> rays) {
+  assert("Error: A ray packet cannot be created with more rays than its size." && rays.size() <= Size);
+
+  std::size_t rayIndex = 0;
+
+  for (const Ray& ray : rays)
+    setRay(rayIndex++, ray);
+}
+
+template <std::size_t Size>
+void RayPacket<Size>::setRay(std::size_t index, const Ray& ray) {
+  assert("Error: Ray index is out of the packet's bounds." && index < Size);
+
+  m_originsX[index] = ray.getOrigin()[0];
+  m_originsY[index] = ray.getOrigin()[1];
+  m_originsZ[index] = ray.getOrigin()[2];
+
+  m_directionsX[index] = ray.getDirection()[0];
+  m_directionsY[index] = ray.getDirection()[1];
+  m_directionsZ[index] = ray.getDirection()[2];
+
+  m_invDirectionsX[index] = ray.getInverseDirection()[0];
+  m_invDirectionsY[index] = ray.getInverseDirection()[1];
+  m_invDirectionsZ[index] = ray.getInverseDirection()[2];
+
+  m_activeMask |= (1u << index);
+}
+
+template <std::size_t Size>
+Ray RayPacket<Size>::recoverRay(std::size_t index) const {
+  assert("Error: Ray index is out of the packet's bounds." && index < Size);
+
+  return Ray(Vec3f({ m_originsX[index], m_originsY[index], m_originsZ[index] }),
+             Vec3f({ m_directionsX[index], m_directionsY[index], m_directionsZ[index] }));
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const Sphere& sphere) const {
+  DistanceArray hitDistances = recoverInfiniteDistances();
+  return intersects(sphere, hitDistances);
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const Sphere& sphere, DistanceArray& hitDistances) const {
+  using PackT = PackType<Size>;
+
+  const PackedVec3<PackT> directions { PackT::load(m_directionsX.data()), PackT::load(m_directionsY.data()), PackT::load(m_directionsZ.data()) };
+  const PackedVec3<PackT> sphereDirs = subtract(PackedVec3<PackT>{ PackT::load(m_originsX.data()),
+                                                                   PackT::load(m_originsY.data()),
+                                                                   PackT::load(m_originsZ.data()) },
+                                                broadcast<PackT>(sphere.getCenter()));
+
+  // Solving the quadratic equation, halving the linear term to simplify the computations
+  const PackT raySqLengths = dot(directions, directions);
+  const PackT rayDiffs     = dot(directions, sphereDirs);
+  const PackT sphereDiffs  = dot(sphereDirs, sphereDirs) - PackT(sphere.getRadius() * sphere.getRadius());
+  const PackT discriminant = rayDiffs * rayDiffs - raySqLengths * sphereDiffs;
+
+  const PackT discriminantRoot = PackT::max(discriminant, PackT(0.f)).sqrt();
+  const PackT firstHitDists    = (-rayDiffs - discriminantRoot) / raySqLengths;
+  const PackT secondHitDists   = (-rayDiffs + discriminantRoot) / raySqLengths;
+
+  // If the closest hit is behind the ray's origin, the ray starts inside the sphere and hits it on its way out
+  const PackT zero(0.f);
+  const PackT closestHitDists = PackT::select(firstHitDists > zero, firstHitDists, secondHitDists);
+
+  const PackT maxDists = PackT::load(hitDistances.data());
+  const PackT hitMask  = (discriminant >= zero) & (closestHitDists > zero) & (closestHitDists < maxDists);
+
+  PackT::select(hitMask, closestHitDists, maxDists).store(hitDistances.data());
+
+  return (hitMask.computeMask() & m_activeMask);
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const Triangle& triangle) const {
+  DistanceArray hitDistances = recoverInfiniteDistances();
+  return intersects(triangle, hitDistances);
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const Triangle& triangle, DistanceArray& hitDistances) const {
+  using PackT = PackType<Size>;
+
+  const PackedVec3<PackT> firstEdge  = broadcast<PackT>(triangle.getSecondPos() - triangle.getFirstPos());
+  const PackedVec3<PackT> secondEdge = broadcast<PackT>(triangle.getThirdPos() - triangle.getFirstPos());
+
+  const PackedVec3<PackT> directions { PackT::load(m_directionsX.data()), PackT::load(m_directionsY.data()), PackT::load(m_directionsZ.data()) };
+  const PackedVec3<PackT> pVecs      = cross(directions, secondEdge);
+  const PackT determinants           = dot(firstEdge, pVecs);
+  const PackT invDeterms             = PackT(1.f) / determinants;
+
+  const PackedVec3<PackT> invPlaneDirs = subtract(PackedVec3<PackT>{ PackT::load(m_originsX.data()),
+                                                                     PackT::load(m_originsY.data()),
+                                                                     PackT::load(m_originsZ.data()) },
+                                                  broadcast<PackT>(triangle.getFirstPos()));
+  const PackT firstBaryCoords = dot(invPlaneDirs, pVecs) * invDeterms;
+
+  const PackedVec3<PackT> qVecs = cross(invPlaneDirs, firstEdge);
+  const PackT secondBaryCoords  = dot(qVecs, directions) * invDeterms;
+  const PackT hitDists          = dot(secondEdge, qVecs) * invDeterms;
+
+  const PackT zero(0.f);
+  const PackT epsilon(std::numeric_limits<float>::epsilon());
+  const PackT maxDists = PackT::load(hitDistances.data());
+
+  // Rays parallel to the triangle have a null determinant, in which case the barycentric coordinates are not valid
+  const PackT hitMask = (PackT::max(determinants, -determinants) > epsilon)
+                      & (firstBaryCoords >= zero)
+                      & (secondBaryCoords >= zero)
+                      & (firstBaryCoords + secondBaryCoords <= PackT(1.f))
+                      & (hitDists > zero)
+                      & (hitDists < maxDists);
+
+  PackT::select(hitMask, hitDists, maxDists).store(hitDistances.data());
+
+  return (hitMask.computeMask() & m_activeMask);
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const AABB& aabb) const {
+  return intersects(aabb, recoverInfiniteDistances());
+}
+
+template <std::size_t Size>
+uint32_t RayPacket<Size>::intersects(const AABB& aabb, const DistanceArray& maxDistances) const {
+  using PackT = PackType<Size>;
+
+  const Vec3f& minPos = aabb.getLeftBottomBackPos();
+  const Vec3f& maxPos = aabb.getRightTopFrontPos();
+
+  const PackT originsX = PackT::load(m_originsX.data());
+  const PackT originsY = PackT::load(m_originsY.data());
+  const PackT originsZ = PackT::load(m_originsZ.data());
+
+  const PackT invDirsX = PackT::load(m_invDirectionsX.data());
+  const PackT invDirsY = PackT::load(m_invDirectionsY.data());
+  const PackT invDirsZ = PackT::load(m_invDirectionsZ.data());
+
+  const PackT firstHitsX  = (PackT(minPos[0]) - originsX) * invDirsX;
+  const PackT secondHitsX = (PackT(maxPos[0]) - originsX) * invDirsX;
+  const PackT firstHitsY  = (PackT(minPos[1]) - originsY) * invDirsY;
+  const PackT secondHitsY = (PackT(maxPos[1]) - originsY) * invDirsY;
+  const PackT firstHitsZ  = (PackT(minPos[2]) - originsZ) * invDirsZ;
+  const PackT secondHitsZ = (PackT(maxPos[2]) - originsZ) * invDirsZ;
+
+  // Taking the min/max of each slab's hits avoids having to swap them depending on the rays' directions
+  const PackT minHitDists = PackT::max(PackT::max(PackT::min(firstHitsX, secondHitsX), PackT::min(firstHitsY, secondHitsY)),
+                                       PackT::max(PackT::min(firstHitsZ, secondHitsZ), PackT(0.f)));
+  const PackT maxHitDists = PackT::min(PackT::min(PackT::max(firstHitsX, secondHitsX), PackT::max(firstHitsY, secondHitsY)),
+                                       PackT::min(PackT::max(firstHitsZ, secondHitsZ), PackT::load(maxDistances.data())));
+
+  return ((minHitDists <= maxHitDists).computeMask() & m_activeMask);
+}
+
+template <std::size_t Size>
+typename RayPacket<Size>::DistanceArray RayPacket<Size>::recoverInfiniteDistances() {
+  DistanceArray distances {};
+  distances.fill(std::numeric_limits<float>::infinity());
+
+  return distances;
+}
+
+template class RayPacket<4>;
+template class RayPacket<8>;
+
+} // namespace Raz
@@ -1,11 +1,71 @@
+#include "RaZ/Physics/Gjk.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
 
+namespace {
+
+Vec3f computeMinPosition(const Vec3f& firstPos, const Vec3f& secondPos) {
+  return Vec3f({ std::min(firstPos[0], secondPos[0]), std::min(firstPos[1], secondPos[1]), std::min(firstPos[2], secondPos[2]) });
+}
+
+Vec3f computeMaxPosition(const Vec3f& firstPos, const Vec3f& secondPos) {
+  return Vec3f({ std::max(firstPos[0], secondPos[0]), std::max(firstPos[1], secondPos[1]), std::max(firstPos[2], secondPos[2]) });
+}
+
+/// Computes the closest point of a triangle to a given point, checking in which Voronoi region of the triangle the point lies.
+/// See: Real-Time Collision Detection (Christer Ericson), 5.1.5 - Closest Point on Triangle to Point
+Vec3f computeTriangleProjection(const Vec3f& point, const Vec3f& firstPos, const Vec3f& secondPos, const Vec3f& thirdPos) {
+  const Vec3f firstEdge  = secondPos - firstPos;
+  const Vec3f secondEdge = thirdPos - firstPos;
+
+  const Vec3f firstDir   = point - firstPos;
+  const float firstDist1 = firstEdge.dot(firstDir);
+  const float firstDist2 = secondEdge.dot(firstDir);
+
+  if (firstDist1 <= 0.f && firstDist2 <= 0.f)
+    return firstPos;
+
+  const Vec3f secondDir   = point - secondPos;
+  const float secondDist1 = firstEdge.dot(secondDir);
+  const float secondDist2 = secondEdge.dot(secondDir);
+
+  if (secondDist1 >= 0.f && secondDist2 <= secondDist1)
+    return secondPos;
+
+  const float thirdWeight = firstDist1 * secondDist2 - secondDist1 * firstDist2;
+
+  if (thirdWeight <= 0.f && firstDist1 >= 0.f && secondDist1 <= 0.f)
+    return firstPos + firstEdge * (firstDist1 / (firstDist1 - secondDist1));
+
+  const Vec3f thirdDir   = point - thirdPos;
+  const float thirdDist1 = firstEdge.dot(thirdDir);
+  const float thirdDist2 = secondEdge.dot(thirdDir);
+
+  if (thirdDist2 >= 0.f && thirdDist1 <= thirdDist2)
+    return thirdPos;
+
+  const float secondWeight = thirdDist1 * firstDist2 - firstDist1 * thirdDist2;
+
+  if (secondWeight <= 0.f && firstDist2 >= 0.f && thirdDist2 <= 0.f)
+    return firstPos + secondEdge * (firstDist2 / (firstDist2 - thirdDist2));
+
+  const float firstWeight = secondDist1 * thirdDist2 - thirdDist1 * secondDist2;
+
+  if (firstWeight <= 0.f && (secondDist2 - secondDist1) >= 0.f && (thirdDist1 - thirdDist2) >= 0.f)
+    return secondPos + (thirdPos - secondPos) * ((secondDist2 - secondDist1) / ((secondDist2 - secondDist1) + (thirdDist1 - thirdDist2)));
+
+  // The point is inside the face region; its projection is expressed with its barycentric coordinates
+  const float weightFactor = 1.f / (firstWeight + secondWeight + thirdWeight);
+  return firstPos + firstEdge * (secondWeight * weightFactor) + secondEdge * (thirdWeight * weightFactor);
+}
+
+} // namespace
+
 // Line functions
 
-bool Line::intersects(const Line&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Line& line) const {
+  return Gjk::intersects(*this, line);
 }
 
 bool Line::intersects(const Plane& plane) const {
@@ -29,16 +89,16 @@ bool Line::intersects(const Sphere& sphere) const {
   return sphere.contains(projPoint);
 }
 
-bool Line::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Triangle& triangle) const {
+  return Gjk::intersects(*this, triangle);
 }
 
-bool Line::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const Quad& quad) const {
+  return Gjk::intersects(*this, quad);
 }
 
-bool Line::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Line::intersects(const AABB& aabb) const {
+  return Gjk::intersects(*this, aabb);
 }
 
 Vec3f Line::computeProjection(const Vec3f& point) const {
@@ -58,6 +118,10 @@ Vec3f Line::computeProjection(const Vec3f& point) const {
   return m_beginPos + lineVec * std::min(1.f, std::max(pointDist, 0.f));
 }
 
+AABB Line::computeBoundingBox() const {
+  return AABB(computeMaxPosition(m_beginPos, m_endPos), computeMinPosition(m_beginPos, m_endPos));
+}
+
 // Plane functions
 
 bool Plane::intersects(const Plane& plane) const {
@@ -70,12 +134,24 @@ bool Plane::intersects(const Sphere& sphere) const {
   return sphere.contains(projPoint);
 }
 
-bool Plane::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Plane::intersects(const Triangle& triangle) const {
+  // The triangle intersects the plane if its vertices are not all strictly on the same side of it
+  const float firstDist  = m_normal.dot(triangle.getFirstPos()) - m_distance;
+  const float secondDist = m_normal.dot(triangle.getSecondPos()) - m_distance;
+  const float thirdDist  = m_normal.dot(triangle.getThirdPos()) - m_distance;
+
+  return (std::min({ firstDist, secondDist, thirdDist }) <= 0.f && std::max({ firstDist, secondDist, thirdDist }) >= 0.f);
 }
 
-bool Plane::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Plane::intersects(const Quad& quad) const {
+  // The quad intersects the plane if its corners are not all strictly on the same side of it
+  const float leftTopDist     = m_normal.dot(quad.getLeftTopPos()) - m_distance;
+  const float rightTopDist    = m_normal.dot(quad.getRightTopPos()) - m_distance;
+  const float rightBottomDist = m_normal.dot(quad.getRightBottomPos()) - m_distance;
+  const float leftBottomDist  = m_normal.dot(quad.getLeftBottomPos()) - m_distance;
+
+  return (std::min({ leftTopDist, rightTopDist, rightBottomDist, leftBottomDist }) <= 0.f
+       && std::max({ leftTopDist, rightTopDist, rightBottomDist, leftBottomDist }) >= 0.f);
 }
 
 bool Plane::intersects(const AABB& aabb) const {
@@ -89,6 +165,14 @@ bool Plane::intersects(const AABB& aabb) const {
   return (std::abs(boxDist) <= topBoxDist);
 }
 
+AABB Plane::computeBoundingBox() const {
+  return AABB(Vec3f(std::numeric_limits<float>::infinity()), Vec3f(-std::numeric_limits<float>::infinity()));
+}
+
+Vec3f Plane::computeSupportPoint(const Vec3f&) const {
+  throw std::runtime_error("Error: A plane is infinite & has no support point.");
+}
+
 // Sphere functions
 
 bool Sphere::contains(const Vec3f& point) const {
@@ -97,10 +181,10 @@ bool Sphere::contains(const Vec3f& point) const {
 }
 
 bool Sphere::intersects(const Sphere& sphere) const {
-  const float sqDist  = (m_centerPos - sphere.getCenter()).computeSquaredLength();
-  const float sqRadii = (m_radius * m_radius) + (sphere.getRadius() * sphere.getRadius());
+  const float sqDist   = (m_centerPos - sphere.getCenter()).computeSquaredLength();
+  const float radiiSum = m_radius + sphere.getRadius();
 
-  return (sqDist <= sqRadii);
+  return (sqDist <= radiiSum * radiiSum);
 }
 
 bool Sphere::intersects(const Triangle& triangle) const {
@@ -118,22 +202,48 @@ bool Sphere::intersects(const AABB& aabb) const {
   return contains(projPoint);
 }
 
+AABB Sphere::computeBoundingBox() const {
+  return AABB(m_centerPos + m_radius, m_centerPos - m_radius);
+}
+
+Vec3f Sphere::computeSupportPoint(const Vec3f& direction) const {
+  const float dirLength = direction.computeLength();
+
+  // Any point of the surface is farthest in a null direction
+  if (dirLength <= 0.f)
+    return m_centerPos + Vec3f({ m_radius, 0.f, 0.f });
+
+  return m_centerPos + direction * (m_radius / dirLength);
+}
+
+Sphere Sphere::computeTransformedSphere(const Mat4f& transform) const {
+  // The largest scale is the length of the longest basis vector, which are the 3x3 matrix's rows
+  float maxSqScale = 0.f;
+
+  for (std::size_t rowIndex = 0; rowIndex < 3; ++rowIndex) {
+    const Vec3f basisVec({ transform[rowIndex * 4], transform[rowIndex * 4 + 1], transform[rowIndex * 4 + 2] });
+    maxSqScale = std::max(maxSqScale, basisVec.computeSquaredLength());
+  }
+
+  return Sphere(Vec3f(Vec4f(m_centerPos, 1.f) * transform), m_radius * std::sqrt(maxSqScale));
+}
+
 // Triangle functions
 
-bool Triangle::intersects(const Triangle&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const Triangle& triangle) const {
+  return Gjk::intersects(*this, triangle);
 }
 
-bool Triangle::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const Quad& quad) const {
+  return Gjk::intersects(*this, quad);
 }
 
-bool Triangle::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Triangle::intersects(const AABB& aabb) const {
+  return Gjk::intersects(*this, aabb);
 }
 
-Vec3f Triangle::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Triangle::computeProjection(const Vec3f& point) const {
+  return computeTriangleProjection(point, m_firstPos, m_secondPos, m_thirdPos);
 }
 
 Vec3f Triangle::computeNormal() const {
@@ -152,18 +262,50 @@ void Triangle::makeCounterClockwise(const Vec3f& normal) {
   std::swap(m_firstPos, m_secondPos);
 }
 
+AABB Triangle::computeBoundingBox() const {
+  return AABB(computeMaxPosition(m_firstPos, computeMaxPosition(m_secondPos, m_thirdPos)),
+              computeMinPosition(m_firstPos, computeMinPosition(m_secondPos, m_thirdPos)));
+}
+
+Vec3f Triangle::computeSupportPoint(const Vec3f& direction) const {
+  const float firstDist  = m_firstPos.dot(direction);
+  const float secondDist = m_secondPos.dot(direction);
+  const float thirdDist  = m_thirdPos.dot(direction);
+
+  if (firstDist >= secondDist && firstDist >= thirdDist)
+    return m_firstPos;
+
+  return (secondDist >= thirdDist ? m_secondPos : m_thirdPos);
+}
+
 // Quad functions
 
-bool Quad::intersects(const Quad&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+bool Quad::intersects(const Quad& quad) const {
+  return Gjk::intersects(*this, quad);
+}
+
+bool Quad::intersects(const AABB& aabb) const {
+  return Gjk::intersects(*this, aabb);
 }
 
-bool Quad::intersects(const AABB&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Quad::computeProjection(const Vec3f& point) const {
+  // The quad is considered as two triangles sharing its diagonal, the closest projection being kept
+  const Vec3f firstProj  = computeTriangleProjection(point, m_leftTopPos, m_rightTopPos, m_rightBottomPos);
+  const Vec3f secondProj = computeTriangleProjection(point, m_leftTopPos, m_rightBottomPos, m_leftBottomPos);
+
+  return ((point - firstProj).computeSquaredLength() <= (point - secondProj).computeSquaredLength() ? firstProj : secondProj);
 }
 
-Vec3f Quad::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+AABB Quad::computeBoundingBox() const {
+  return AABB(computeMaxPosition(computeMaxPosition(m_leftTopPos, m_rightTopPos), computeMaxPosition(m_rightBottomPos, m_leftBottomPos)),
+              computeMinPosition(computeMinPosition(m_leftTopPos, m_rightTopPos), computeMinPosition(m_rightBottomPos, m_leftBottomPos)));
+}
+
+Vec3f Quad::computeSupportPoint(const Vec3f& direction) const {
+  const Vec3f& topPos    = (m_leftTopPos.dot(direction) >= m_rightTopPos.dot(direction) ? m_leftTopPos : m_rightTopPos);
+  const Vec3f& bottomPos = (m_rightBottomPos.dot(direction) >= m_leftBottomPos.dot(direction) ? m_rightBottomPos : m_leftBottomPos);
+
+  return (topPos.dot(direction) >= bottomPos.dot(direction) ? topPos : bottomPos);
 }
 
 // AABB functions
@@ -216,4 +358,28 @@ Vec3f AABB::computeProjection(const Vec3f& point) const {
   return Vec3f({ closestX, closestY, closestZ });
 }
 
+Vec3f AABB::computeSupportPoint(const Vec3f& direction) const {
+  return Vec3f({ (direction[0] >= 0.f ? m_rightTopFrontPos[0] : m_leftBottomBackPos[0]),
+                 (direction[1] >= 0.f ? m_rightTopFrontPos[1] : m_leftBottomBackPos[1]),
+                 (direction[2] >= 0.f ? m_rightTopFrontPos[2] : m_leftBottomBackPos[2]) });
+}
+
+AABB AABB::computeTransformedBox(const Mat4f& transform) const {
+  // Each transformed bound is the translation plus the extreme contributions of every axis
+  Vec3f minPos({ transform[12], transform[13], transform[14] });
+  Vec3f maxPos = minPos;
+
+  for (std::size_t rowIndex = 0; rowIndex < 3; ++rowIndex) {
+    for (std::size_t colIndex = 0; colIndex < 3; ++colIndex) {
+      const float firstVal  = transform[rowIndex * 4 + colIndex] * m_leftBottomBackPos[rowIndex];
+      const float secondVal = transform[rowIndex * 4 + colIndex] * m_rightTopFrontPos[rowIndex];
+
+      minPos[colIndex] += std::min(firstVal, secondVal);
+      maxPos[colIndex] += std::max(firstVal, secondVal);
+    }
+  }
+
+  return AABB(maxPos, minPos);
+}
+
 } // namespace Raz
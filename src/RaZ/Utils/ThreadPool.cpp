@@ -0,0 +1,70 @@
+#include <algorithm>
+
+#include "RaZ/Utils/ThreadPool.hpp"
+
+namespace Raz {
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+  if (threadCount == 0)
+    threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+  m_threads.reserve(threadCount);
+
+  for (std::size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+    m_threads.emplace_back([this] () {
+      while (true) {
+        std::function<void()> task;
+
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_taskCondition.wait(lock, [this] () { return (m_shouldStop || !m_tasks.empty()); });
+
+          if (m_tasks.empty())
+            return;
+
+          task = std::move(m_tasks.front());
+          m_tasks.pop();
+          ++m_runningTaskCount;
+        }
+
+        task();
+
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          --m_runningTaskCount;
+
+          if (m_tasks.empty() && m_runningTaskCount == 0)
+            m_finishCondition.notify_all();
+        }
+      }
+    });
+  }
+}
+
+void ThreadPool::addTask(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.emplace(std::move(task));
+  }
+
+  m_taskCondition.notify_one();
+}
+
+void ThreadPool::wait() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_finishCondition.wait(lock, [this] () { return (m_tasks.empty() && m_runningTaskCount == 0); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shouldStop = true;
+  }
+
+  m_taskCondition.notify_all();
+
+  for (std::thread& thread : m_threads)
+    thread.join();
+}
+
+} // namespace Raz
@@ -1,5 +1,9 @@
+#include <algorithm>
 #include <iostream>
 
+#include "RaZ/Render/GpuProfiler.hpp"
+#include "RaZ/Render/StateCache.hpp"
+#include "RaZ/Render/TextureStreamer.hpp"
 #include "RaZ/Utils/Window.hpp"
 
 namespace Raz {
@@ -49,8 +53,8 @@ void GLAPIENTRY callbackDebugLog(GLenum source,
 
 } // namespace
 
-Window::Window(unsigned int width, unsigned int height, const std::string& title, uint8_t AASampleCount) : m_width{ width },
-                                                                                                           m_height{ height } {
+Window::Window(unsigned int width, unsigned int height,
+               const std::string& title, uint8_t AASampleCount, bool isHeadless) : m_width{ width }, m_height{ height }, m_isHeadless{ isHeadless } {
   glfwSetErrorCallback([] (int error, const char* description) {
     std::cerr << "GLFW error " << error << ": " << description << std::endl;
   });
@@ -62,7 +66,9 @@ Window::Window(unsigned int width, unsigned int height, const std::string& title
   glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
   glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
   glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
-  glfwWindowHint(GLFW_SAMPLES, AASampleCount);
+  glfwWindowHint(GLFW_VISIBLE, !isHeadless);
+  // The default framebuffer of a hidden window is never displayed, and must not be multisampled in vain
+  glfwWindowHint(GLFW_SAMPLES, (isHeadless ? 0 : AASampleCount));
 
 #if defined(__APPLE__) // Setting the OpenGL forward compatibility is required on macOS
   glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
@@ -89,8 +95,47 @@ Window::Window(unsigned int width, unsigned int height, const std::string& title
 
   glfwSetWindowUserPointer(m_window, this);
 
+  if (isHeadless)
+    createOffscreenFramebuffers(AASampleCount);
+
   enableFaceCulling();
-  glEnable(GL_DEPTH_TEST);
+  StateCache::get().setCapability(GL_DEPTH_TEST, true);
+}
+
+void Window::createOffscreenFramebuffers(uint8_t AASampleCount) {
+  glGenRenderbuffers(static_cast<GLsizei>(m_renderbufferIndices.size()), m_renderbufferIndices.data());
+
+  const auto width          = static_cast<GLsizei>(m_width);
+  const auto height         = static_cast<GLsizei>(m_height);
+  const GLsizei sampleCount = (AASampleCount > 1 ? AASampleCount : 0);
+
+  glBindRenderbuffer(GL_RENDERBUFFER, m_renderbufferIndices[0]);
+  glRenderbufferStorageMultisample(GL_RENDERBUFFER, sampleCount, GL_RGBA8, width, height);
+  glBindRenderbuffer(GL_RENDERBUFFER, m_renderbufferIndices[1]);
+  glRenderbufferStorageMultisample(GL_RENDERBUFFER, sampleCount, GL_DEPTH_COMPONENT24, width, height);
+  glBindRenderbuffer(GL_RENDERBUFFER, m_renderbufferIndices[2]);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+  StateCache& stateCache = StateCache::get();
+
+  glGenFramebuffers(1, &m_frontFramebufferIndex);
+  stateCache.bindFramebuffer(m_frontFramebufferIndex);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_renderbufferIndices[2]);
+
+  glGenFramebuffers(1, &m_framebufferIndex);
+  stateCache.bindFramebuffer(m_framebufferIndex);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_renderbufferIndices[0]);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_renderbufferIndices[1]);
+
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+    close();
+    throw std::runtime_error("Error: Failed to create the headless window's framebuffer");
+  }
+
+  // The back framebuffer stays bound, so that everything is rendered into it
+  glClearColor(m_clearColor[0], m_clearColor[1], m_clearColor[2], m_clearColor[3]);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
 void Window::setIcon(const Image& img) const {
@@ -101,10 +146,7 @@ void Window::setIcon(const Image& img) const {
 }
 
 void Window::enableFaceCulling(bool value) const {
-  if (value)
-    glEnable(GL_CULL_FACE);
-  else
-    glDisable(GL_CULL_FACE);
+  StateCache::get().setCapability(GL_CULL_FACE, value);
 }
 
 bool Window::recoverVerticalSyncState() const {
@@ -261,7 +303,11 @@ void Window::addOverlayFpsCounter(const std::string& formattedText) {
   m_overlay->addFpsCounter(formattedText);
 }
 
-bool Window::run(float deltaTime) {
+void Window::addOverlayGpuProfiler(const GpuProfiler& profiler) {
+  m_overlay->addGpuProfiler(profiler);
+}
+
+bool Window::run(float deltaTime, GpuProfiler* gpuProfiler) {
   if (glfwWindowShouldClose(m_window))
     return false;
 
@@ -287,10 +333,29 @@ bool Window::run(float deltaTime) {
       ++actionIter;
   }
 
-  if (m_overlay)
+  if (m_overlay) {
+    GpuProfilerScope overlayScope(gpuProfiler, "Overlay");
     m_overlay->render();
+  }
+
+  if (gpuProfiler)
+    gpuProfiler->endFrame();
 
-  glfwSwapBuffers(m_window);
+  if (m_isHeadless) {
+    // The front framebuffer being bound through the cache, only the read binding has to be changed & restored around the copy
+    StateCache& stateCache = StateCache::get();
+    stateCache.bindFramebuffer(m_frontFramebufferIndex);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_framebufferIndex);
+    glBlitFramebuffer(0, 0, static_cast<GLint>(m_width), static_cast<GLint>(m_height),
+                      0, 0, static_cast<GLint>(m_width), static_cast<GLint>(m_height),
+                      GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_frontFramebufferIndex);
+
+    stateCache.bindFramebuffer(m_framebufferIndex);
+  } else {
+    glfwSwapBuffers(m_window);
+  }
 
   glClearColor(m_clearColor[0], m_clearColor[1], m_clearColor[2], m_clearColor[3]);
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -298,6 +363,33 @@ bool Window::run(float deltaTime) {
   return true;
 }
 
+Image Window::captureFrame() const {
+  Image frame(m_width, m_height, ImageColorspace::RGBA);
+
+  StateCache& stateCache = StateCache::get();
+  stateCache.bindFramebuffer(m_frontFramebufferIndex);
+
+  if (!m_isHeadless)
+    glReadBuffer(GL_FRONT);
+
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadPixels(0, 0, static_cast<GLsizei>(m_width), static_cast<GLsizei>(m_height), GL_RGBA, GL_UNSIGNED_BYTE, frame.getDataPtr());
+
+  if (!m_isHeadless)
+    glReadBuffer(GL_BACK);
+
+  stateCache.bindFramebuffer(m_framebufferIndex);
+
+  // OpenGL's rows start from the bottom
+  auto* frameData         = static_cast<uint8_t*>(frame.getDataPtr());
+  const std::size_t width = static_cast<std::size_t>(m_width) * 4;
+
+  for (std::size_t rowIndex = 0; rowIndex < m_height / 2; ++rowIndex)
+    std::swap_ranges(frameData + rowIndex * width, frameData + (rowIndex + 1) * width, frameData + (m_height - rowIndex - 1) * width);
+
+  return frame;
+}
+
 Vec2f Window::recoverMousePosition() const {
   double xPos {}, yPos {};
   glfwGetCursorPos(m_window, &xPos, &yPos);
@@ -307,6 +399,16 @@ Vec2f Window::recoverMousePosition() const {
 
 void Window::close() {
   disableOverlay();
+  TextureStreamer::get().release();
+
+  if (m_framebufferIndex != 0) {
+    StateCache::get().deleteFramebuffer(m_framebufferIndex);
+    StateCache::get().deleteFramebuffer(m_frontFramebufferIndex);
+
+    glDeleteRenderbuffers(static_cast<GLsizei>(m_renderbufferIndices.size()), m_renderbufferIndices.data());
+    m_renderbufferIndices.fill(0);
+  }
+
   glfwTerminate();
 }
 
@@ -1,11 +1,134 @@
+#include <algorithm>
+#include <cmath>
+
 #include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Mesh.hpp"
 
 namespace Raz {
 
+namespace {
+
+bool matchesComponents(const Entity& entity, const Bitset& componentMask) {
+  const Bitset& enabledComponents = entity.getEnabledComponents();
+
+  for (std::size_t compIndex = 0; compIndex < componentMask.getSize(); ++compIndex) {
+    if (componentMask[compIndex] && (compIndex >= enabledComponents.getSize() || !enabledComponents[compIndex]))
+      return false;
+  }
+
+  return true;
+}
+
+Mat4f recoverTransformMatrix(const Entity& entity) {
+  return (entity.hasComponent<Transform>() ? entity.getComponent<Transform>().computeTransformMatrix() : Mat4f::identity());
+}
+
+void expandBox(Vec3f& minPos, Vec3f& maxPos, const AABB& box) {
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    minPos[axisIndex] = std::min(minPos[axisIndex], box.getLeftBottomBackPos()[axisIndex]);
+    maxPos[axisIndex] = std::max(maxPos[axisIndex], box.getRightTopFrontPos()[axisIndex]);
+  }
+}
+
+template <typename ShapeT>
+void expandShapeBox(const Entity& entity, Vec3f& minPos, Vec3f& maxPos, bool& hasGeometry) {
+  if (!entity.hasComponent<ShapeT>())
+    return;
+
+  expandBox(minPos, maxPos, entity.getComponent<ShapeT>().computeBoundingBox());
+  hasGeometry = true;
+}
+
+/// Computes the world-space box of an entity's shapes & mesh, computing the latter's hierarchies if needed.
+/// \return True if the entity has any geometry, false otherwise.
+bool computeEntityBox(Entity& entity, Vec3f& minPos, Vec3f& maxPos) {
+  minPos = Vec3f(std::numeric_limits<float>::max());
+  maxPos = Vec3f(std::numeric_limits<float>::lowest());
+
+  bool hasGeometry = false;
+
+  expandShapeBox<Line>(entity, minPos, maxPos, hasGeometry);
+  expandShapeBox<Plane>(entity, minPos, maxPos, hasGeometry);
+  expandShapeBox<Sphere>(entity, minPos, maxPos, hasGeometry);
+  expandShapeBox<Triangle>(entity, minPos, maxPos, hasGeometry);
+  expandShapeBox<Quad>(entity, minPos, maxPos, hasGeometry);
+  expandShapeBox<AABB>(entity, minPos, maxPos, hasGeometry);
+
+  if (entity.hasComponent<Mesh>()) {
+    const Mat4f transform = recoverTransformMatrix(entity);
+
+    for (const SubmeshPtr& submesh : entity.getComponent<Mesh>().getSubmeshes()) {
+      if (submesh->getBvh().isEmpty())
+        submesh->computeBvh();
+
+      if (submesh->getBvh().isEmpty())
+        continue;
+
+      expandBox(minPos, maxPos, submesh->getBvh().recoverRootBox().computeTransformedBox(transform));
+      hasGeometry = true;
+    }
+  }
+
+  return hasGeometry;
+}
+
+template <typename ShapeT>
+void checkShape(const Entity& entity, const Ray& ray, RayHit& closestHit, bool& hasHit) {
+  RayHit shapeHit;
+
+  if (!entity.hasComponent<ShapeT>() || !ray.intersects(entity.getComponent<ShapeT>(), &shapeHit) || shapeHit.distance >= closestHit.distance)
+    return;
+
+  closestHit = shapeHit;
+  hasHit     = true;
+}
+
+bool intersectsEntity(Entity& entity, const Ray& ray, float maxDistance, RayHit& hit) {
+  RayHit closestHit;
+  closestHit.distance = maxDistance;
+
+  bool hasHit = false;
+
+  checkShape<Line>(entity, ray, closestHit, hasHit);
+  checkShape<Plane>(entity, ray, closestHit, hasHit);
+  checkShape<Sphere>(entity, ray, closestHit, hasHit);
+  checkShape<Triangle>(entity, ray, closestHit, hasHit);
+  checkShape<Quad>(entity, ray, closestHit, hasHit);
+  checkShape<AABB>(entity, ray, closestHit, hasHit);
+
+  if (entity.hasComponent<Mesh>()) {
+    // The ray is brought into the mesh's local space; its direction is not normalized so that the hit distances remain the same
+    const Mat4f transform    = recoverTransformMatrix(entity);
+    const Mat4f invTransform = transform.inverse();
+    const Ray localRay(Vec3f(Vec4f(ray.getOrigin(), 1.f) * invTransform), Vec3f(Vec4f(ray.getDirection(), 0.f) * invTransform));
+
+    RayHit meshHit;
+
+    if (entity.getComponent<Mesh>().intersects(localRay, &meshHit, closestHit.distance)) {
+      closestHit          = meshHit;
+      closestHit.position = ray.getOrigin() + ray.getDirection() * meshHit.distance;
+      closestHit.normal   = Vec3f(Vec4f(meshHit.normal, 0.f) * invTransform.transpose()).normalize();
+      hasHit              = true;
+    }
+  }
+
+  if (!hasHit)
+    return false;
+
+  hit        = closestHit;
+  hit.entity = &entity;
+
+  return true;
+}
+
+} // namespace
+
 Entity& World::addEntity(bool enabled) {
   m_entities.push_back(Entity::create(m_maxEntityIndex++, enabled));
 
   m_activeEntityCount += enabled;
+  m_isSpatialIndexOutdated = true;
 
   return *m_entities.back();
 }
@@ -13,6 +136,9 @@ Entity& World::addEntity(bool enabled) {
 bool World::update(float deltaTime) {
   refresh();
 
+  // Entities may have moved during the previous frame
+  m_isSpatialIndexOutdated = true;
+
   for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
     if (m_activeSystems[systemIndex]) {
       if (!m_systems[systemIndex]->update(deltaTime))
@@ -65,4 +191,98 @@ void World::refresh() {
   }
 }
 
+bool World::raycast(const Ray& ray, RayHit& hit, float maxDistance, const Bitset& componentMask) {
+  if (m_isSpatialIndexOutdated)
+    updateSpatialIndex();
+
+  bool hasHit = false;
+
+  const auto checkEntity = [&ray, &hit, &componentMask, &hasHit] (Entity& entity, float& maxDist) {
+    if (!entity.isEnabled() || !matchesComponents(entity, componentMask) || !intersectsEntity(entity, ray, maxDist, hit))
+      return false;
+
+    // Lowering the maximum distance allows the spatial index to skip all entities farther than this hit
+    maxDist = hit.distance;
+    hasHit  = true;
+
+    return true;
+  };
+
+  for (Entity* entity : m_unboundedEntities)
+    checkEntity(*entity, maxDistance);
+
+  m_spatialIndex.query(ray, maxDistance, [this, &checkEntity] (std::size_t entityIndex, float& maxDist) {
+    return checkEntity(*m_indexedEntities[entityIndex], maxDist);
+  });
+
+  return hasHit;
+}
+
+std::vector<RayHit> World::raycastAll(const Ray& ray, float maxDistance, const Bitset& componentMask) {
+  if (m_isSpatialIndexOutdated)
+    updateSpatialIndex();
+
+  std::vector<RayHit> hits;
+
+  const auto checkEntity = [&ray, &componentMask, &hits] (Entity& entity, float maxDist) {
+    RayHit hit;
+
+    if (!entity.isEnabled() || !matchesComponents(entity, componentMask) || !intersectsEntity(entity, ray, maxDist, hit))
+      return false;
+
+    hits.emplace_back(hit);
+    return true;
+  };
+
+  for (Entity* entity : m_unboundedEntities)
+    checkEntity(*entity, maxDistance);
+
+  m_spatialIndex.query(ray, maxDistance, [this, &checkEntity] (std::size_t entityIndex, float& maxDist) {
+    return checkEntity(*m_indexedEntities[entityIndex], maxDist);
+  });
+
+  std::sort(hits.begin(), hits.end(), [] (const RayHit& hit1, const RayHit& hit2) { return (hit1.distance < hit2.distance); });
+
+  return hits;
+}
+
+void World::updateSpatialIndex() {
+  std::vector<Entity*> boundedEntities;
+  std::vector<AABB> entityBoxes;
+
+  m_unboundedEntities.clear();
+
+  for (const EntityPtr& entity : m_entities) {
+    if (entity == nullptr || !entity->isEnabled())
+      continue;
+
+    Vec3f minPos, maxPos;
+
+    if (!computeEntityBox(*entity, minPos, maxPos))
+      continue;
+
+    // Entities having infinite bounds, like planes, cannot be indexed & are always checked
+    const bool isBounded = std::isfinite(minPos[0]) && std::isfinite(minPos[1]) && std::isfinite(minPos[2])
+                        && std::isfinite(maxPos[0]) && std::isfinite(maxPos[1]) && std::isfinite(maxPos[2]);
+
+    if (!isBounded) {
+      m_unboundedEntities.emplace_back(entity.get());
+      continue;
+    }
+
+    boundedEntities.emplace_back(entity.get());
+    entityBoxes.emplace_back(maxPos, minPos);
+  }
+
+  // If the same entities are indexed, the hierarchy can simply be refitted to their new positions
+  if (!m_spatialIndex.isEmpty() && boundedEntities == m_indexedEntities) {
+    m_spatialIndex.refit(entityBoxes);
+  } else {
+    m_indexedEntities = std::move(boundedEntities);
+    m_spatialIndex.build(entityBoxes);
+  }
+
+  m_isSpatialIndexOutdated = false;
+}
+
 } // namespace Raz
@@ -0,0 +1,127 @@
+#include "catch/catch.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Physics/CollisionSystem.hpp"
+
+#include <random>
+
+namespace {
+
+bool containsPair(const std::vector<Raz::CollisionPair>& pairs, const Raz::Entity& entity1, const Raz::Entity& entity2) {
+  return std::any_of(pairs.cbegin(), pairs.cend(), [&entity1, &entity2] (const Raz::CollisionPair& pair) {
+    return (pair.firstEntity == &entity1 && pair.secondEntity == &entity2) || (pair.firstEntity == &entity2 && pair.secondEntity == &entity1);
+  });
+}
+
+} // namespace
+
+TEST_CASE("CollisionSystem pairs") {
+  Raz::World world(5);
+  const auto& collisionSystem = world.addSystem<Raz::CollisionSystem>();
+
+  //      sphere0 sphere1            sphere2  box0               sphere3 box1
+  //   [ -1 ( 0 ) 1 ]                [ 9 (10) 11 ]               [ 19 (20) 21 ]
+  //          [ 0.5 (1.5) 2.5 ]             [ 10.5; 12 ]                [ 20.8; 21 ]
+  Raz::Entity& sphere0 = world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f(0.f), 1.f);
+  Raz::Entity& sphere1 = world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f({ 1.5f, 0.f, 0.f }), 1.f);
+  Raz::Entity& sphere2 = world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f({ 10.f, 0.f, 0.f }), 1.f);
+  Raz::Entity& box0    = world.addEntityWithComponent<Raz::AABB>(Raz::Vec3f({ 12.f, 1.f, 1.f }), Raz::Vec3f({ 10.5f, -1.f, -1.f }));
+  Raz::Entity& sphere3 = world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f({ 20.f, 0.f, 0.f }), 1.f);
+
+  // The second box only overlaps the last sphere's bounding box, not the sphere itself
+  Raz::Entity& box1 = world.addEntityWithComponent<Raz::AABB>(Raz::Vec3f(21.f), Raz::Vec3f({ 20.8f, 0.8f, 0.8f }));
+
+  world.update(0.f);
+
+  REQUIRE(collisionSystem.getSweepAxis() == 0);
+
+  REQUIRE(collisionSystem.getOverlappingPairs().size() == 3);
+  REQUIRE(containsPair(collisionSystem.getOverlappingPairs(), sphere0, sphere1));
+  REQUIRE(containsPair(collisionSystem.getOverlappingPairs(), sphere2, box0));
+  REQUIRE(containsPair(collisionSystem.getOverlappingPairs(), sphere3, box1));
+
+  REQUIRE(collisionSystem.getCollisions().size() == 2);
+  REQUIRE(containsPair(collisionSystem.getCollisions(), sphere0, sphere1));
+  REQUIRE(containsPair(collisionSystem.getCollisions(), sphere2, box0));
+
+  // Moving the first sphere next to the last one, the previous order being then refined
+  sphere0.addComponent<Raz::Sphere>(Raz::Vec3f({ 19.f, 0.f, 0.f }), 1.f);
+  box0.disable();
+
+  world.update(0.f);
+
+  REQUIRE(collisionSystem.getOverlappingPairs().size() == 2);
+  REQUIRE(containsPair(collisionSystem.getOverlappingPairs(), sphere0, sphere3));
+  REQUIRE(containsPair(collisionSystem.getOverlappingPairs(), sphere3, box1));
+
+  REQUIRE(collisionSystem.getCollisions().size() == 1);
+  REQUIRE(containsPair(collisionSystem.getCollisions(), sphere0, sphere3));
+}
+
+TEST_CASE("CollisionSystem unbounded shapes") {
+  Raz::World world(3);
+  const auto& collisionSystem = world.addSystem<Raz::CollisionSystem>();
+
+  Raz::Entity& ground  = world.addEntityWithComponent<Raz::Plane>(-0.5f);
+  Raz::Entity& sphere0 = world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f(0.f), 1.f);
+  Raz::Entity& sphere1 = world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f({ 100.f, 10.f, 0.f }), 1.f);
+
+  world.update(0.f);
+
+  // Both spheres' bounding boxes overlap the plane's infinite one, but only the first actually crosses it
+  REQUIRE(collisionSystem.getOverlappingPairs().size() == 2);
+  REQUIRE(collisionSystem.getCollisions().size() == 1);
+  REQUIRE(containsPair(collisionSystem.getCollisions(), ground, sphere0));
+  REQUIRE_FALSE(containsPair(collisionSystem.getCollisions(), ground, sphere1));
+}
+
+TEST_CASE("CollisionSystem brute force comparison") {
+  constexpr std::size_t sphereCount = 500;
+
+  Raz::World world(sphereCount);
+  const auto& collisionSystem = world.addSystem<Raz::CollisionSystem>();
+
+  std::mt19937 randomEngine(42);
+  std::uniform_real_distribution<float> posDistrib(-50.f, 50.f);
+  std::uniform_real_distribution<float> radiusDistrib(0.5f, 3.f);
+
+  std::vector<Raz::Entity*> entities;
+
+  const auto placeSpheres = [&] () {
+    for (Raz::Entity* entity : entities) {
+      // The spheres are spread more along the Z axis, on which they are expected to be sorted
+      entity->addComponent<Raz::Sphere>(Raz::Vec3f({ posDistrib(randomEngine), posDistrib(randomEngine), posDistrib(randomEngine) * 4.f }),
+                                        radiusDistrib(randomEngine));
+    }
+  };
+
+  for (std::size_t sphereIndex = 0; sphereIndex < sphereCount; ++sphereIndex)
+    entities.emplace_back(&world.addEntity());
+
+  placeSpheres();
+
+  for (std::size_t updateIndex = 0; updateIndex < 3; ++updateIndex) {
+    world.update(0.f);
+
+    std::size_t collisionCount = 0;
+
+    for (std::size_t firstIndex = 0; firstIndex < sphereCount; ++firstIndex) {
+      for (std::size_t secondIndex = firstIndex + 1; secondIndex < sphereCount; ++secondIndex) {
+        const Raz::Entity& firstEntity  = *entities[firstIndex];
+        const Raz::Entity& secondEntity = *entities[secondIndex];
+
+        if (!firstEntity.getComponent<Raz::Sphere>().intersects(secondEntity.getComponent<Raz::Sphere>()))
+          continue;
+
+        ++collisionCount;
+        REQUIRE(containsPair(collisionSystem.getCollisions(), firstEntity, secondEntity));
+      }
+    }
+
+    REQUIRE(collisionSystem.getCollisions().size() == collisionCount);
+    REQUIRE(collisionSystem.getOverlappingPairs().size() < sphereCount * 4);
+
+    placeSpheres();
+  }
+
+  REQUIRE(collisionSystem.getSweepAxis() == 2);
+}
@@ -0,0 +1,81 @@
+#include "catch/catch.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/Gjk.hpp"
+
+TEST_CASE("Gjk intersection") {
+  const Raz::Sphere sphere(Raz::Vec3f(0.f), 1.f);
+  const Raz::AABB aabb1(Raz::Vec3f({ 2.f, 0.5f, 0.5f }), Raz::Vec3f({ 0.5f, -0.5f, -0.5f }));
+  const Raz::AABB aabb2(Raz::Vec3f({ 3.f, 0.5f, 0.5f }), Raz::Vec3f({ 1.5f, -0.5f, -0.5f }));
+
+  REQUIRE(Raz::Gjk::intersects(sphere, aabb1));
+  REQUIRE(Raz::Gjk::intersects(aabb1, sphere));
+  REQUIRE_FALSE(Raz::Gjk::intersects(sphere, aabb2));
+  REQUIRE(Raz::Gjk::intersects(aabb1, aabb2));
+
+  // The box's corner is closer to the sphere's center than its radius along each axis, but not along the diagonal
+  const Raz::AABB cornerBox(Raz::Vec3f(2.f), Raz::Vec3f(0.7f));
+  REQUIRE_FALSE(Raz::Gjk::intersects(sphere, cornerBox));
+  REQUIRE(sphere.computeBoundingBox().intersects(cornerBox));
+
+  // A tetrahedral hull & a line going through it
+  const Raz::ConvexHull hull({ Raz::Vec3f(0.f), Raz::Vec3f({ 1.f, 0.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }), Raz::Vec3f({ 0.f, 0.f, 1.f }) });
+  REQUIRE(Raz::Gjk::intersects(hull, Raz::Line(Raz::Vec3f({ 0.2f, 0.2f, -1.f }), Raz::Vec3f({ 0.2f, 0.2f, 1.f }))));
+  REQUIRE_FALSE(Raz::Gjk::intersects(hull, Raz::Line(Raz::Vec3f({ 0.6f, 0.6f, -1.f }), Raz::Vec3f({ 0.6f, 0.6f, 1.f }))));
+  REQUIRE(hull.computeBoundingBox().getRightTopFrontPos() == Raz::Vec3f(1.f));
+}
+
+TEST_CASE("Gjk distance") {
+  const Raz::Sphere sphere(Raz::Vec3f(0.f), 1.f);
+  const Raz::AABB aabb(Raz::Vec3f({ 5.f, 1.f, 1.f }), Raz::Vec3f({ 3.f, -1.f, -1.f }));
+
+  Raz::Vec3f spherePoint;
+  Raz::Vec3f boxPoint;
+  REQUIRE(Raz::Gjk::computeDistance(sphere, aabb, &spherePoint, &boxPoint) == Approx(2.f).epsilon(0.001));
+  REQUIRE(spherePoint[0] == Approx(1.f).epsilon(0.001));
+  REQUIRE(boxPoint[0] == Approx(3.f));
+
+  // Two triangles facing each other, 2 units apart along Z
+  const Raz::Triangle triangle1(Raz::Vec3f({ -1.f, -1.f, 0.f }), Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  const Raz::Triangle triangle2(Raz::Vec3f({ -1.f, -1.f, 2.f }), Raz::Vec3f({ 1.f, -1.f, 2.f }), Raz::Vec3f({ 0.f, 1.f, 2.f }));
+  REQUIRE(Raz::Gjk::computeDistance(triangle1, triangle2) == Approx(2.f));
+
+  // Intersecting shapes are at a null distance
+  REQUIRE(Raz::Gjk::computeDistance(sphere, Raz::Sphere(Raz::Vec3f({ 1.f, 0.f, 0.f }), 1.f)) == 0.f);
+}
+
+TEST_CASE("Gjk warm-starting") {
+  const Raz::Sphere sphere(Raz::Vec3f(0.f), 1.f);
+  const Raz::AABB aabb(Raz::Vec3f({ 5.f, 1.f, 1.f }), Raz::Vec3f({ 3.f, -1.f, -1.f }));
+
+  Raz::Gjk::Simplex simplex;
+  REQUIRE(Raz::Gjk::computeDistance(sphere, aabb, nullptr, nullptr, &simplex) == Approx(2.f).epsilon(0.001));
+  REQUIRE_FALSE(simplex.isEmpty());
+
+  // Moving the sphere slightly, as between two frames, & reusing the previous simplex
+  const Raz::Sphere movedSphere(Raz::Vec3f({ 0.5f, 0.f, 0.f }), 1.f);
+  REQUIRE(Raz::Gjk::computeDistance(movedSphere, aabb, nullptr, nullptr, &simplex) == Approx(1.5f).epsilon(0.001));
+
+  const Raz::Sphere overlappingSphere(Raz::Vec3f({ 2.5f, 0.f, 0.f }), 1.f);
+  REQUIRE(Raz::Gjk::intersects(overlappingSphere, aabb, &simplex));
+}
+
+TEST_CASE("Epa penetration") {
+  const Raz::AABB aabb1(Raz::Vec3f(1.f), Raz::Vec3f(-1.f));
+  const Raz::AABB aabb2(Raz::Vec3f({ 2.5f, 1.f, 1.f }), Raz::Vec3f({ 0.75f, -1.f, -1.f }));
+
+  Raz::Gjk::PenetrationInfo penetration;
+  REQUIRE(Raz::Gjk::computePenetration(aabb1, aabb2, penetration));
+  REQUIRE(penetration.depth == Approx(0.25f).epsilon(0.01));
+  REQUIRE(std::abs(penetration.normal[0]) == Approx(1.f).epsilon(0.01));
+  REQUIRE(penetration.normal[1] == Approx(0.f).margin(0.01));
+  REQUIRE(penetration.normal[2] == Approx(0.f).margin(0.01));
+
+  const Raz::Sphere sphere1(Raz::Vec3f(0.f), 1.f);
+  const Raz::Sphere sphere2(Raz::Vec3f({ 0.f, 1.5f, 0.f }), 1.f);
+
+  REQUIRE(Raz::Gjk::computePenetration(sphere1, sphere2, penetration));
+  REQUIRE(penetration.depth == Approx(0.5f).epsilon(0.02));
+  REQUIRE(std::abs(penetration.normal[1]) == Approx(1.f).epsilon(0.02));
+
+  REQUIRE_FALSE(Raz::Gjk::computePenetration(sphere1, Raz::Sphere(Raz::Vec3f({ 0.f, 3.f, 0.f }), 1.f), penetration));
+}
@@ -0,0 +1,125 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/FrameGraph.hpp"
+
+namespace {
+
+const Raz::FrameGraphTextureDescriptor colorDescriptor { 1280, 720, Raz::ImageColorspace::RGBA, Raz::ImageDataType::BYTE };
+const Raz::FrameGraphTextureDescriptor hdrDescriptor { 1280, 720, Raz::ImageColorspace::RGBA, Raz::ImageDataType::FLOAT };
+
+} // namespace
+
+TEST_CASE("Frame graph culling") {
+  Raz::FrameGraph graph;
+
+  const std::size_t sceneColor = graph.addTexture("Scene color", colorDescriptor);
+  const std::size_t ssaoColor  = graph.addTexture("SSAO", colorDescriptor);
+  const std::size_t unusedBlur = graph.addTexture("Unused blur", colorDescriptor);
+
+  const std::size_t scenePass = graph.addPass("Scene", nullptr);
+  graph.addPassOutput(scenePass, sceneColor);
+
+  const std::size_t ssaoPass = graph.addPass("SSAO", nullptr);
+  graph.addPassInput(ssaoPass, sceneColor);
+  graph.addPassOutput(ssaoPass, ssaoColor);
+
+  // Nothing reads this pass' output
+  const std::size_t blurPass = graph.addPass("Blur", nullptr);
+  graph.addPassInput(blurPass, sceneColor);
+  graph.addPassOutput(blurPass, unusedBlur);
+
+  const std::size_t displayPass = graph.addPass("Display", nullptr, true);
+  graph.addPassInput(displayPass, ssaoColor);
+
+  graph.compile();
+
+  REQUIRE_FALSE(graph.isPassCulled(scenePass));
+  REQUIRE_FALSE(graph.isPassCulled(ssaoPass));
+  REQUIRE(graph.isPassCulled(blurPass));
+  REQUIRE_FALSE(graph.isPassCulled(displayPass));
+  REQUIRE(graph.getExecutionOrder() == std::vector<std::size_t>({ scenePass, ssaoPass, displayPass }));
+  REQUIRE(graph.getPhysicalTextureIndex(unusedBlur) == Raz::FrameGraph::InvalidIndex);
+
+  // Marking the texture as an output keeps its pass
+  graph.markOutput(unusedBlur);
+  graph.compile();
+
+  REQUIRE_FALSE(graph.isPassCulled(blurPass));
+  REQUIRE(graph.getExecutionOrder().size() == 4);
+
+  // Without any side effect nor output, everything is culled
+  graph.clear();
+
+  const std::size_t lonePass = graph.addPass("Lone", nullptr);
+  graph.addPassOutput(lonePass, graph.addTexture("Lone texture", colorDescriptor));
+  graph.compile();
+
+  REQUIRE(graph.isPassCulled(lonePass));
+  REQUIRE(graph.getExecutionOrder().empty());
+}
+
+TEST_CASE("Frame graph ordering") {
+  Raz::FrameGraph graph;
+
+  const std::size_t sceneColor = graph.addTexture("Scene color", hdrDescriptor);
+  const std::size_t bloomColor = graph.addTexture("Bloom", hdrDescriptor);
+
+  // Passes are declared in reverse order, their dependencies restoring the right one
+  const std::size_t displayPass = graph.addPass("Display", nullptr, true);
+  graph.addPassInput(displayPass, bloomColor);
+
+  const std::size_t bloomPass = graph.addPass("Bloom", nullptr);
+  graph.addPassInput(bloomPass, sceneColor);
+  graph.addPassOutput(bloomPass, bloomColor);
+
+  const std::size_t scenePass = graph.addPass("Scene", nullptr);
+  graph.addPassOutput(scenePass, sceneColor);
+
+  // Writing the same texture, this pass is executed after the scene one as it has been declared after it
+  const std::size_t overlayPass = graph.addPass("Overlay", nullptr);
+  graph.addPassOutput(overlayPass, sceneColor);
+
+  graph.compile();
+  REQUIRE(graph.getExecutionOrder() == std::vector<std::size_t>({ scenePass, overlayPass, bloomPass, displayPass }));
+
+  // Reading its own output from another pass creates a cycle
+  graph.addPassInput(scenePass, bloomColor);
+  REQUIRE_THROWS(graph.compile());
+}
+
+TEST_CASE("Frame graph aliasing") {
+  Raz::FrameGraph graph;
+
+  const Raz::FrameGraphTextureDescriptor halfDescriptor { 640, 360, Raz::ImageColorspace::RGBA, Raz::ImageDataType::BYTE };
+
+  const std::size_t sceneColor = graph.addTexture("Scene color", colorDescriptor);
+  const std::size_t ssaoColor  = graph.addTexture("SSAO", colorDescriptor);
+  const std::size_t halfColor  = graph.addTexture("Half", halfDescriptor);
+  const std::size_t ssrColor   = graph.addTexture("SSR", colorDescriptor);
+  const std::size_t finalColor = graph.addTexture("Final", colorDescriptor);
+
+  const auto addPass = [&graph] (const std::string& name, std::size_t input, std::size_t output) {
+    const std::size_t passIndex = graph.addPass(name, nullptr);
+    graph.addPassInput(passIndex, input);
+    graph.addPassOutput(passIndex, output);
+  };
+
+  graph.addPassOutput(graph.addPass("Scene", nullptr), sceneColor);
+  addPass("SSAO", sceneColor, ssaoColor);
+  addPass("Downsample", ssaoColor, halfColor);
+  addPass("SSR", halfColor, ssrColor);
+  addPass("Final", ssrColor, finalColor);
+  graph.addPassInput(graph.addPass("Display", nullptr, true), finalColor);
+
+  graph.compile();
+
+  // The scene color is no longer needed once the SSAO is computed, the SSR can thus reuse it; the SSAO is then free for the final color
+  REQUIRE(graph.getPhysicalTextureIndex(ssrColor) == graph.getPhysicalTextureIndex(sceneColor));
+  REQUIRE(graph.getPhysicalTextureIndex(finalColor) == graph.getPhysicalTextureIndex(ssaoColor));
+  REQUIRE(graph.getPhysicalTextureIndex(sceneColor) != graph.getPhysicalTextureIndex(ssaoColor));
+
+  // Textures with different properties are never aliased
+  REQUIRE(graph.getPhysicalTextureIndex(halfColor) != graph.getPhysicalTextureIndex(sceneColor));
+  REQUIRE(graph.getPhysicalTextureIndex(halfColor) != graph.getPhysicalTextureIndex(ssaoColor));
+
+  REQUIRE(graph.getPhysicalTextureCount() == 3);
+}
@@ -0,0 +1,87 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/LightClusterGrid.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+bool clusterContainsLight(const Raz::LightClusterGrid& grid, std::size_t clusterIndex, uint32_t lightIndex) {
+  const uint32_t offset = grid.getClusterRanges()[clusterIndex * 2];
+  const uint32_t count  = grid.getClusterRanges()[clusterIndex * 2 + 1];
+
+  const auto clusterBegin = grid.getLightIndices().cbegin() + offset;
+  return (std::find(clusterBegin, clusterBegin + count, lightIndex) != clusterBegin + count);
+}
+
+} // namespace
+
+TEST_CASE("Light cluster grid slices") {
+  REQUIRE_THROWS(Raz::LightClusterGrid(0, 9, 24));
+  REQUIRE_THROWS(Raz::LightClusterGrid(16, 9, 0));
+
+  Raz::LightClusterGrid grid(16, 9, 24);
+  REQUIRE(grid.getClusterCount() == 16 * 9 * 24);
+  REQUIRE(grid.getClusterRanges().size() == grid.getClusterCount() * 2);
+  REQUIRE(grid.computeClusterIndex(15, 8, 23) == grid.getClusterCount() - 1);
+
+  const Raz::Camera camera(1600, 900, 45.f, 1.f, 100.f);
+  grid.build(camera.getProjectionMatrix(), 1.f, 100.f, {});
+
+  REQUIRE(grid.getGlobalLightCount() == 0);
+  REQUIRE(grid.getLightIndices().empty());
+
+  // Slices are distributed exponentially, the middle one being at the geometric mean of the planes
+  REQUIRE(grid.computeSliceIndex(1.f) == 0);
+  REQUIRE(grid.computeSliceIndex(10.1f) == 12);
+  REQUIRE(grid.computeSliceIndex(99.f) == 23);
+
+  // Depths outside of the planes are clamped
+  REQUIRE(grid.computeSliceIndex(0.5f) == 0);
+  REQUIRE(grid.computeSliceIndex(1000.f) == 23);
+}
+
+TEST_CASE("Light cluster grid assignment") {
+  Raz::LightClusterGrid grid(16, 9, 24);
+
+  // The camera is at the origin, looking towards +Z
+  const Raz::Camera camera(1600, 900, 45.f, 1.f, 100.f);
+
+  const std::vector<Raz::Sphere> lightVolumes = {
+    Raz::Sphere(Raz::Vec3f(0.f), std::numeric_limits<float>::infinity()), // Global light
+    Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 50.f }), 1.f),                     // In front of the camera
+    Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, -10.f }), 1.f),                    // Behind the camera
+    Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 200.f }), 1.f),                    // Beyond the far plane
+    Raz::Sphere(Raz::Vec3f({ 500.f, 0.f, 50.f }), 1.f)                    // Out of the screen
+  };
+
+  grid.build(camera.getProjectionMatrix(), 1.f, 100.f, lightVolumes);
+
+  REQUIRE(grid.getGlobalLightCount() == 1);
+  REQUIRE(grid.getLightIndices()[0] == 0);
+
+  // The global light is not part of any cluster, being implicitly affecting all of them
+  for (std::size_t clusterIndex = 0; clusterIndex < grid.getClusterCount(); ++clusterIndex) {
+    REQUIRE_FALSE(clusterContainsLight(grid, clusterIndex, 0));
+    REQUIRE_FALSE(clusterContainsLight(grid, clusterIndex, 2));
+    REQUIRE_FALSE(clusterContainsLight(grid, clusterIndex, 3));
+    REQUIRE_FALSE(clusterContainsLight(grid, clusterIndex, 4));
+  }
+
+  // The light in front of the camera only affects the clusters around the screen's center, at its depth
+  const unsigned int lightSlice = grid.computeSliceIndex(50.f);
+
+  REQUIRE(clusterContainsLight(grid, grid.computeClusterIndex(8, 4, lightSlice), 1));
+  REQUIRE_FALSE(clusterContainsLight(grid, grid.computeClusterIndex(0, 0, lightSlice), 1));
+  REQUIRE_FALSE(clusterContainsLight(grid, grid.computeClusterIndex(8, 4, 0), 1));
+
+  std::size_t lightClusterCount = 0;
+
+  for (std::size_t clusterIndex = 0; clusterIndex < grid.getClusterCount(); ++clusterIndex)
+    lightClusterCount += grid.getClusterRanges()[clusterIndex * 2 + 1];
+
+  REQUIRE(lightClusterCount > 0);
+  REQUIRE(lightClusterCount <= 4);
+  REQUIRE(grid.getLightIndices().size() == grid.getGlobalLightCount() + lightClusterCount);
+}
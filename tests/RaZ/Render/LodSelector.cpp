@@ -0,0 +1,40 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Constants.hpp"
+#include "RaZ/Render/LodSelector.hpp"
+
+#include <limits>
+
+TEST_CASE("LOD selector screen size") {
+  // With a 90° field of view, the screen's half height at a given distance is that distance
+  REQUIRE(Raz::LodSelector::computeScreenSize(1.f, 10.f, Raz::PI<float> / 2.f) == Approx(0.1f));
+  REQUIRE(Raz::LodSelector::computeScreenSize(2.f, 10.f, Raz::PI<float> / 2.f) == Approx(0.2f));
+
+  // Being inside the sphere, it covers the whole screen
+  REQUIRE(Raz::LodSelector::computeScreenSize(1.f, 0.5f, Raz::PI<float> / 2.f) == std::numeric_limits<float>::infinity());
+}
+
+TEST_CASE("LOD selector selection") {
+  const Raz::LodSelector lodSelector({ 0.5f, 0.25f }, 0.1f);
+
+  REQUIRE(lodSelector.select(1.f, 0, 3) == 0);
+  REQUIRE(lodSelector.select(0.3f, 0, 3) == 1);
+  REQUIRE(lodSelector.select(0.1f, 0, 3) == 2);
+  REQUIRE(lodSelector.select(1.f, 2, 3) == 0);
+
+  // Levels beyond the available ones are never selected
+  REQUIRE(lodSelector.select(0.1f, 0, 2) == 1);
+  REQUIRE(lodSelector.select(0.1f, 0, 1) == 0);
+  REQUIRE(lodSelector.select(0.1f, 5, 2) == 1);
+}
+
+TEST_CASE("LOD selector hysteresis") {
+  const Raz::LodSelector lodSelector({ 0.5f }, 0.1f);
+
+  // Around the threshold, the current level is kept
+  REQUIRE(lodSelector.select(0.48f, 0, 2) == 0);
+  REQUIRE(lodSelector.select(0.52f, 1, 2) == 1);
+
+  // Once crossed by more than the hysteresis ratio, the level changes
+  REQUIRE(lodSelector.select(0.44f, 0, 2) == 1);
+  REQUIRE(lodSelector.select(0.56f, 1, 2) == 0);
+}
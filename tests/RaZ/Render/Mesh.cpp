@@ -0,0 +1,78 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/Window.hpp"
+
+#include <cmath>
+
+namespace {
+
+Raz::Vertex createVertex(const Raz::Vec3f& position, const Raz::Vec2f& texcoords = Raz::Vec2f(0.f)) {
+  Raz::Vertex vertex {};
+  vertex.position  = position;
+  vertex.texcoords = texcoords;
+
+  return vertex;
+}
+
+} // namespace
+
+TEST_CASE("Mesh bounds") {
+  // Window created to setup the OpenGL context, which Raz::Mesh needs to be instantiated
+  Raz::Window window(1, 1);
+
+  Raz::Mesh mesh;
+
+  // The texcoords follow the positions & are loaded in the 4th SIMD lane; they must not change the bounds
+  mesh.getSubmeshes().front()->getVertices() = { createVertex(Raz::Vec3f({ -1.f, 0.f, 2.f }), Raz::Vec2f({ -1000.f, 1000.f })),
+                                                 createVertex(Raz::Vec3f({ 3.f, -2.f, 1.f }), Raz::Vec2f({ 1000.f, -1000.f })),
+                                                 createVertex(Raz::Vec3f({ 1.f, 4.f, -3.f }), Raz::Vec2f({ -1000.f, -1000.f })) };
+  mesh.computeBounds();
+
+  const Raz::Submesh& firstSubmesh = *mesh.getSubmeshes().front();
+
+  REQUIRE(firstSubmesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f({ -1.f, -2.f, -3.f }));
+  REQUIRE(firstSubmesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f({ 3.f, 4.f, 2.f }));
+
+  // The sphere is centered on the box, reaching the farthest vertex
+  REQUIRE(firstSubmesh.getBoundingSphere().getCenter() == Raz::Vec3f({ 1.f, 1.f, -0.5f }));
+  REQUIRE(firstSubmesh.getBoundingSphere().getRadius() == Approx(std::sqrt(15.25f)));
+
+  // With a single submesh, the mesh's bounds are the submesh's ones
+  REQUIRE(mesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f({ -1.f, -2.f, -3.f }));
+  REQUIRE(mesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f({ 3.f, 4.f, 2.f }));
+  REQUIRE(mesh.getBoundingSphere().getCenter() == Raz::Vec3f({ 1.f, 1.f, -0.5f }));
+  REQUIRE(mesh.getBoundingSphere().getRadius() == Approx(std::sqrt(15.25f)));
+
+  // The mesh's bounds enclose all its submeshes
+  Raz::SubmeshPtr secondSubmesh = Raz::Submesh::create();
+  secondSubmesh->getVertices() = { createVertex(Raz::Vec3f({ 5.f, 0.f, 0.f })),
+                                   createVertex(Raz::Vec3f({ 6.f, 1.f, 1.f })) };
+  mesh.addSubmesh(std::move(secondSubmesh));
+  mesh.computeBounds();
+
+  REQUIRE(mesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f({ -1.f, -2.f, -3.f }));
+  REQUIRE(mesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f({ 6.f, 4.f, 2.f }));
+  REQUIRE(mesh.getBoundingSphere().getCenter() == Raz::Vec3f({ 2.5f, 1.f, -0.5f }));
+
+  for (const Raz::SubmeshPtr& submesh : mesh.getSubmeshes()) {
+    for (const Raz::Vertex& vertex : submesh->getVertices())
+      REQUIRE((vertex.position - mesh.getBoundingSphere().getCenter()).computeLength() <= mesh.getBoundingSphere().getRadius());
+  }
+
+  // An empty submesh has null bounds, and is ignored by the mesh's ones
+  const Raz::Sphere unionSphere = mesh.getBoundingSphere();
+
+  mesh.addSubmesh(Raz::Submesh::create());
+  mesh.computeBounds();
+
+  const Raz::Submesh& emptySubmesh = *mesh.getSubmeshes().back();
+
+  REQUIRE(emptySubmesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f(0.f));
+  REQUIRE(emptySubmesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f(0.f));
+  REQUIRE(emptySubmesh.getBoundingSphere().getRadius() == 0.f);
+
+  REQUIRE(mesh.getBoundingBox().getLeftBottomBackPos() == Raz::Vec3f({ -1.f, -2.f, -3.f }));
+  REQUIRE(mesh.getBoundingBox().getRightTopFrontPos() == Raz::Vec3f({ 6.f, 4.f, 2.f }));
+  REQUIRE(mesh.getBoundingSphere().getCenter() == unionSphere.getCenter());
+  REQUIRE(mesh.getBoundingSphere().getRadius() == Approx(unionSphere.getRadius()));
+}
@@ -0,0 +1,156 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+namespace {
+
+// Grid of quads on the XY plane, whose triangles are shuffled
+void createShuffledGrid(std::size_t sideQuadCount, std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices) {
+  const std::size_t sideVertexCount = sideQuadCount + 1;
+
+  vertices.resize(sideVertexCount * sideVertexCount);
+
+  for (std::size_t y = 0; y < sideVertexCount; ++y) {
+    for (std::size_t x = 0; x < sideVertexCount; ++x)
+      vertices[y * sideVertexCount + x].position = Raz::Vec3f({ static_cast<float>(x), static_cast<float>(y), 0.f });
+  }
+
+  std::vector<std::array<unsigned int, 3>> triangles;
+
+  for (std::size_t y = 0; y < sideQuadCount; ++y) {
+    for (std::size_t x = 0; x < sideQuadCount; ++x) {
+      const auto bottomLeft = static_cast<unsigned int>(y * sideVertexCount + x);
+      const auto topLeft    = static_cast<unsigned int>(bottomLeft + sideVertexCount);
+
+      triangles.push_back({{ bottomLeft, bottomLeft + 1, topLeft + 1 }});
+      triangles.push_back({{ bottomLeft, topLeft + 1, topLeft }});
+    }
+  }
+
+  std::shuffle(triangles.begin(), triangles.end(), std::mt19937(42));
+
+  indices.clear();
+
+  for (const std::array<unsigned int, 3>& triangle : triangles)
+    indices.insert(indices.end(), triangle.cbegin(), triangle.cend());
+}
+
+// Triangles defined by their vertices' positions, each one rotated to start with its smallest index so that the winding is kept
+std::vector<std::array<unsigned int, 3>> recoverTriangles(const std::vector<Raz::Vertex>& vertices, const std::vector<unsigned int>& indices) {
+  std::vector<std::array<unsigned int, 3>> triangles;
+
+  for (std::size_t index = 0; index < indices.size(); index += 3) {
+    std::array<unsigned int, 3> triangle {};
+
+    // Positions being integers on the grid, they can be turned back into their original indices
+    for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+      const Raz::Vec3f& position = vertices[indices[index + cornerIndex]].position;
+      triangle[cornerIndex] = static_cast<unsigned int>(position[1] * 1000.f + position[0]);
+    }
+
+    std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+    triangles.emplace_back(triangle);
+  }
+
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+} // namespace
+
+TEST_CASE("Mesh optimizer ACMR") {
+  REQUIRE(Raz::MeshOptimizer::computeAcmr({}, 0) == 0.f);
+
+  // Triangles sharing no vertex miss all of them
+  REQUIRE(Raz::MeshOptimizer::computeAcmr({ 0, 1, 2, 3, 4, 5 }, 6) == 3.f);
+
+  // A strip only misses a single vertex per triangle after the first one
+  REQUIRE(Raz::MeshOptimizer::computeAcmr({ 0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4 }, 6) == 1.5f);
+
+  // With a single entry, nothing is ever reused
+  REQUIRE(Raz::MeshOptimizer::computeAcmr({ 0, 1, 2, 1, 3, 2 }, 4, 1) == 3.f);
+}
+
+TEST_CASE("Mesh optimizer vertex cache") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createShuffledGrid(40, vertices, indices);
+
+  const std::vector<std::array<unsigned int, 3>> originalTriangles = recoverTriangles(vertices, indices);
+  const float originalAcmr = Raz::MeshOptimizer::computeAcmr(indices, vertices.size());
+
+  Raz::MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+  const float optimizedAcmr = Raz::MeshOptimizer::computeAcmr(indices, vertices.size());
+
+  REQUIRE(originalAcmr > 2.5f);
+  REQUIRE(optimizedAcmr < 0.8f);
+  REQUIRE(recoverTriangles(vertices, indices) == originalTriangles);
+
+  // Reordering the clusters only slightly degrades the cache's efficiency
+  Raz::MeshOptimizer::optimizeOverdraw(indices, vertices, 1.05f);
+
+  REQUIRE(Raz::MeshOptimizer::computeAcmr(indices, vertices.size()) <= optimizedAcmr * 1.1f);
+  REQUIRE(recoverTriangles(vertices, indices) == originalTriangles);
+}
+
+TEST_CASE("Mesh optimizer overdraw partial first triangle") {
+  // The first triangle repeats a vertex, thus never missing all of them; it must still start the first cluster
+  std::vector<Raz::Vertex> vertices(6);
+  std::vector<unsigned int> indices = { 0, 0, 1,
+                                        1, 2, 3,
+                                        3, 4, 5 };
+
+  for (std::size_t vertexIndex = 0; vertexIndex < vertices.size(); ++vertexIndex)
+    vertices[vertexIndex].position = Raz::Vec3f({ static_cast<float>(vertexIndex), 0.f, 0.f });
+
+  const std::vector<std::array<unsigned int, 3>> originalTriangles = recoverTriangles(vertices, indices);
+
+  Raz::MeshOptimizer::optimizeOverdraw(indices, vertices, 1.05f);
+
+  REQUIRE(indices.size() == 9);
+  REQUIRE(recoverTriangles(vertices, indices) == originalTriangles);
+
+  // On a whole mesh, the optimized indices are a permutation of the original triangles, including a first one sharing its vertices
+  createShuffledGrid(10, vertices, indices);
+  indices.insert(indices.begin(), { indices[0], indices[0], indices[1] });
+
+  const std::vector<std::array<unsigned int, 3>> originalGridTriangles = recoverTriangles(vertices, indices);
+  const std::size_t originalIndexCount = indices.size();
+
+  Raz::MeshOptimizer::optimizeOverdraw(indices, vertices, 1.05f);
+
+  REQUIRE(indices.size() == originalIndexCount);
+  REQUIRE(recoverTriangles(vertices, indices) == originalGridTriangles);
+}
+
+TEST_CASE("Mesh optimizer vertex fetch") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createShuffledGrid(10, vertices, indices);
+
+  // An unreferenced vertex is removed
+  vertices.emplace_back();
+
+  const std::vector<std::array<unsigned int, 3>> originalTriangles = recoverTriangles(vertices, indices);
+  const std::size_t originalVertexCount = vertices.size();
+
+  Raz::MeshOptimizer::optimizeVertexFetch(vertices, indices);
+
+  REQUIRE(vertices.size() == originalVertexCount - 1);
+  REQUIRE(recoverTriangles(vertices, indices) == originalTriangles);
+
+  // Vertices are referenced for the first time in their order
+  unsigned int nextNewIndex = 0;
+
+  for (const unsigned int index : indices) {
+    REQUIRE(index <= nextNewIndex);
+
+    if (index == nextNewIndex)
+      ++nextNewIndex;
+  }
+
+  REQUIRE(nextNewIndex == vertices.size());
+}
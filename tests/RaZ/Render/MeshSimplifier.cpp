@@ -0,0 +1,149 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/MeshSimplifier.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// Flat grid of quads on the XY plane
+void createGrid(std::size_t sideQuadCount, std::vector<Raz::Vertex>& vertices, std::vector<unsigned int>& indices) {
+  const std::size_t sideVertexCount = sideQuadCount + 1;
+
+  vertices.resize(sideVertexCount * sideVertexCount);
+
+  for (std::size_t y = 0; y < sideVertexCount; ++y) {
+    for (std::size_t x = 0; x < sideVertexCount; ++x) {
+      const auto posX = static_cast<float>(x);
+      const auto posY = static_cast<float>(y);
+
+      vertices[y * sideVertexCount + x].position = Raz::Vec3f({ posX, posY, 0.f });
+    }
+  }
+
+  indices.clear();
+
+  for (std::size_t y = 0; y < sideQuadCount; ++y) {
+    for (std::size_t x = 0; x < sideQuadCount; ++x) {
+      const auto bottomLeft = static_cast<unsigned int>(y * sideVertexCount + x);
+      const auto topLeft    = static_cast<unsigned int>(bottomLeft + sideVertexCount);
+
+      indices.insert(indices.end(), { bottomLeft, bottomLeft + 1, topLeft + 1 });
+      indices.insert(indices.end(), { bottomLeft, topLeft + 1, topLeft });
+    }
+  }
+}
+
+bool isOnBorder(const Raz::Vec3f& position, float maxCoord) {
+  return (position[0] == 0.f || position[1] == 0.f || position[0] == maxCoord || position[1] == maxCoord);
+}
+
+} // namespace
+
+TEST_CASE("Mesh simplifier flat grid") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createGrid(16, vertices, indices);
+
+  float error = -1.f;
+  const std::vector<unsigned int> simplifiedIndices = Raz::MeshSimplifier::simplify(vertices, indices, indices.size() / 4, 0.01f, &error);
+
+  // A plane can be simplified without any error, down to the vertices which cannot be moved
+  REQUIRE(simplifiedIndices.size() % 3 == 0);
+  REQUIRE(simplifiedIndices.size() <= indices.size() / 2);
+  REQUIRE(error == 0.f);
+
+  float area = 0.f;
+
+  for (std::size_t index = 0; index < simplifiedIndices.size(); index += 3) {
+    const Raz::Vec3f& pos1 = vertices[simplifiedIndices[index]].position;
+    const Raz::Vec3f& pos2 = vertices[simplifiedIndices[index + 1]].position;
+    const Raz::Vec3f& pos3 = vertices[simplifiedIndices[index + 2]].position;
+
+    // Triangles keep facing the same direction
+    const Raz::Vec3f normal = (pos2 - pos1).cross(pos3 - pos1);
+    REQUIRE(normal[2] > 0.f);
+
+    area += normal[2] * 0.5f;
+  }
+
+  // The surface is still entirely covered
+  REQUIRE(area == Approx(256.f));
+
+  // Border vertices are never removed
+  for (std::size_t vertexIndex = 0; vertexIndex < vertices.size(); ++vertexIndex) {
+    if (!isOnBorder(vertices[vertexIndex].position, 16.f))
+      continue;
+
+    REQUIRE(std::find(simplifiedIndices.cbegin(), simplifiedIndices.cend(), vertexIndex) != simplifiedIndices.cend());
+  }
+}
+
+TEST_CASE("Mesh simplifier error") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createGrid(16, vertices, indices);
+
+  // Raising a peak in the middle, which cannot be removed without deforming the surface
+  const unsigned int peakIndex = 8 * 17 + 8;
+  vertices[peakIndex].position[2] = 4.f;
+
+  const std::vector<unsigned int> strictIndices = Raz::MeshSimplifier::simplify(vertices, indices, 0, 0.001f);
+  REQUIRE(std::find(strictIndices.cbegin(), strictIndices.cend(), peakIndex) != strictIndices.cend());
+
+  // Allowing a higher error reduces the geometry further
+  float error = 0.f;
+  const std::vector<unsigned int> looseIndices = Raz::MeshSimplifier::simplify(vertices, indices, 0, 1.f, &error);
+
+  REQUIRE(looseIndices.size() < strictIndices.size());
+  REQUIRE(error > 0.f);
+  REQUIRE(error <= 1.f);
+}
+
+TEST_CASE("Mesh simplifier seams") {
+  std::vector<Raz::Vertex> vertices;
+  std::vector<unsigned int> indices;
+  createGrid(8, vertices, indices);
+
+  // Duplicating the vertices of the middle column for the triangles on its right, as a texture seam would
+  const std::size_t originalVertexCount = vertices.size();
+
+  for (std::size_t index = 0; index < indices.size(); index += 3) {
+    const Raz::Vec3f& pos1 = vertices[indices[index]].position;
+    const Raz::Vec3f& pos2 = vertices[indices[index + 1]].position;
+    const Raz::Vec3f& pos3 = vertices[indices[index + 2]].position;
+
+    if (std::min({ pos1[0], pos2[0], pos3[0] }) < 4.f)
+      continue;
+
+    for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+      unsigned int& vertexIndex = indices[index + cornerIndex];
+
+      if (vertexIndex >= originalVertexCount || vertices[vertexIndex].position[0] != 4.f)
+        continue;
+
+      Raz::Vertex seamVertex = vertices[vertexIndex];
+      seamVertex.texcoords   = Raz::Vec2f({ 1.f, 0.f });
+
+      const auto seamIter = std::find_if(vertices.cbegin() + static_cast<std::ptrdiff_t>(originalVertexCount), vertices.cend(), [&seamVertex] (const Raz::Vertex& vertex) {
+        return (vertex.position == seamVertex.position);
+      });
+
+      if (seamIter == vertices.cend()) {
+        vertexIndex = static_cast<unsigned int>(vertices.size());
+        vertices.emplace_back(seamVertex);
+      } else {
+        vertexIndex = static_cast<unsigned int>(seamIter - vertices.cbegin());
+      }
+    }
+  }
+
+  const std::vector<unsigned int> simplifiedIndices = Raz::MeshSimplifier::simplify(vertices, indices, 0, 0.01f);
+
+  REQUIRE(simplifiedIndices.size() < indices.size());
+
+  // All the vertices of the seam are kept, on both of its sides
+  for (std::size_t vertexIndex = 0; vertexIndex < vertices.size(); ++vertexIndex) {
+    if (vertices[vertexIndex].position[0] == 4.f)
+      REQUIRE(std::find(simplifiedIndices.cbegin(), simplifiedIndices.cend(), vertexIndex) != simplifiedIndices.cend());
+  }
+}
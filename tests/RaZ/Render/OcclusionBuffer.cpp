@@ -0,0 +1,68 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/OcclusionBuffer.hpp"
+
+namespace {
+
+// Declaring an occlusion buffer seen from a camera at the origin looking towards +Z, with a 10x10 wall at 10 units in front of it
+//
+//    camera        wall
+//      |   ->       |
+//   [ 0; 0; 0 ] [ -5/5; -5/5; 10 ]
+
+Raz::OcclusionBuffer createBuffer() {
+  Raz::Camera camera(256, 128, 90.f, 0.1f, 100.f);
+  const Raz::Transform cameraTrans;
+
+  const Raz::Mat4f& viewMat = camera.computeViewMatrix(cameraTrans.computeTranslationMatrix(true), cameraTrans.getRotation().inverse());
+
+  Raz::OcclusionBuffer buffer;
+  buffer.clear(viewMat * camera.getProjectionMatrix());
+
+  buffer.rasterizeTriangle(Raz::Vec3f({ -5.f, 5.f, 10.f }), Raz::Vec3f({ 5.f, 5.f, 10.f }), Raz::Vec3f({ 5.f, -5.f, 10.f }));
+  buffer.rasterizeTriangle(Raz::Vec3f({ -5.f, 5.f, 10.f }), Raz::Vec3f({ -5.f, -5.f, 10.f }), Raz::Vec3f({ 5.f, -5.f, 10.f })); // Opposite winding
+  buffer.buildHierarchy();
+
+  return buffer;
+}
+
+} // namespace
+
+TEST_CASE("OcclusionBuffer rasterization") {
+  REQUIRE_THROWS(Raz::OcclusionBuffer(30, 16));
+
+  const Raz::OcclusionBuffer buffer = createBuffer();
+
+  REQUIRE(buffer.getWidth() == 256);
+  REQUIRE(buffer.getHeight() == 128);
+  REQUIRE(buffer.getLevelCount() == 9); // From 256x128 down to 1x1
+
+  // The wall's depth is stored as the inverse of its distance to the camera; nothing has been rasterized on the borders
+  const std::vector<float>& depths = buffer.getLevel(0);
+  REQUIRE(depths[64 * 256 + 128] == Approx(0.1f));
+  REQUIRE(depths[64 * 256 + 2] == 0.f);
+  REQUIRE(depths[2 * 256 + 128] == 0.f);
+
+  // Each level keeps the farthest depth of the blocks it covers
+  REQUIRE(buffer.getLevel(1)[32 * 128 + 64] == Approx(0.1f));
+  REQUIRE(buffer.getLevel(buffer.getLevelCount() - 1).front() == 0.f);
+}
+
+TEST_CASE("OcclusionBuffer occlusion") {
+  const Raz::OcclusionBuffer buffer = createBuffer();
+
+  // Behind the wall
+  REQUIRE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 21.f }), Raz::Vec3f({ -1.f, -1.f, 19.f }))));
+  REQUIRE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 3.f, 3.f, 50.f }), Raz::Vec3f({ -3.f, -3.f, 40.f }))));
+
+  // In front of the wall, crossing it, or behind it but larger than what it hides
+  REQUIRE_FALSE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 6.f }), Raz::Vec3f({ -1.f, -1.f, 4.f }))));
+  REQUIRE_FALSE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 12.f }), Raz::Vec3f({ -1.f, -1.f, 8.f }))));
+  REQUIRE_FALSE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 12.f, 1.f, 21.f }), Raz::Vec3f({ -12.f, -1.f, 19.f }))));
+
+  // Beside the wall, behind the camera or crossing its plane
+  REQUIRE_FALSE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 16.f, 1.f, 21.f }), Raz::Vec3f({ 14.f, -1.f, 19.f }))));
+  REQUIRE_FALSE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, -19.f }), Raz::Vec3f({ -1.f, -1.f, -21.f }))));
+  REQUIRE_FALSE(buffer.isOccluded(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 21.f }), Raz::Vec3f({ -1.f, -1.f, -1.f }))));
+}
@@ -0,0 +1,112 @@
+#include "catch/catch.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Light.hpp"
+#include "RaZ/Render/RayTracer.hpp"
+
+namespace {
+
+constexpr unsigned int imageSize = 32;
+
+// Declaring a world with a sphere at its center, seen by a camera & lit by a light both located in front of it
+//
+//   camera & light      sphere
+//     [ 0; 0; -5 ]  ->  ( [ 0; 0; 0 ], radius 1 )
+
+Raz::World createWorld() {
+  Raz::World world(3);
+
+  world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f(0.f), 1.f);
+
+  Raz::Entity& light = world.addEntityWithComponent<Raz::Light>(Raz::LightType::POINT, 10.f);
+  light.addComponent<Raz::Transform>(Raz::Vec3f({ 0.f, 0.f, -5.f }));
+
+  return world;
+}
+
+const uint8_t* recoverPixel(const Raz::Image& image, unsigned int pixelX, unsigned int pixelY) {
+  return static_cast<const uint8_t*>(image.getDataPtr()) + (pixelY * image.getWidth() + pixelX) * 3;
+}
+
+} // namespace
+
+TEST_CASE("RayTracer render") {
+  Raz::World world = createWorld();
+
+  Raz::Entity cameraEntity(0);
+  cameraEntity.addComponent<Raz::Camera>(imageSize, imageSize);
+  cameraEntity.addComponent<Raz::Transform>(Raz::Vec3f({ 0.f, 0.f, -5.f }));
+
+  Raz::RayTracer rayTracer(imageSize, imageSize, 2);
+  REQUIRE(rayTracer.getThreadCount() == 2);
+  REQUIRE(rayTracer.getSampleCount() == 0);
+
+  rayTracer.render(world, cameraEntity);
+  REQUIRE(rayTracer.getSampleCount() == 1);
+
+  // Every pixel casts a primary ray, and those hitting the sphere a shadow ray
+  REQUIRE(rayTracer.getRayCount() > imageSize * imageSize);
+  REQUIRE(rayTracer.getRayCount() < imageSize * imageSize * 2);
+  REQUIRE(rayTracer.computeMegaRaysPerSecond() > 0.f);
+
+  const Raz::Image image = rayTracer.recoverImage();
+  REQUIRE(image.getWidth() == imageSize);
+  REQUIRE(image.getHeight() == imageSize);
+  REQUIRE(image.getColorspace() == Raz::ImageColorspace::RGB);
+
+  // The sphere is lit at the image's center, and the background is left black
+  const uint8_t* centerPixel = recoverPixel(image, imageSize / 2, imageSize / 2);
+  REQUIRE(centerPixel[0] > 0);
+  REQUIRE(centerPixel[0] == centerPixel[1]);
+  REQUIRE(centerPixel[0] == centerPixel[2]);
+
+  const uint8_t* cornerPixel = recoverPixel(image, 0, 0);
+  REQUIRE(cornerPixel[0] == 0);
+
+  // Adding samples progressively refines the image
+  rayTracer.render(world, cameraEntity);
+  rayTracer.render(world, cameraEntity);
+  REQUIRE(rayTracer.getSampleCount() == 3);
+
+  rayTracer.reset();
+  REQUIRE(rayTracer.getSampleCount() == 0);
+  REQUIRE(recoverPixel(rayTracer.recoverImage(), imageSize / 2, imageSize / 2)[0] == 0);
+
+  // A camera entity without any Camera component cannot be rendered from
+  REQUIRE_THROWS(rayTracer.render(world, Raz::Entity(1)));
+}
+
+TEST_CASE("RayTracer shadows") {
+  Raz::World world = createWorld();
+
+  Raz::Entity cameraEntity(0);
+  cameraEntity.addComponent<Raz::Camera>(imageSize, imageSize);
+  cameraEntity.addComponent<Raz::Transform>(Raz::Vec3f({ 0.f, 0.f, -5.f }));
+
+  Raz::RayTracer rayTracer(imageSize, imageSize);
+
+  rayTracer.render(world, cameraEntity);
+  const uint8_t litValue = recoverPixel(rayTracer.recoverImage(), imageSize / 2, imageSize / 2)[0];
+
+  // Moving the light behind the sphere leaves its visible side in the shadow, only lit by the ambient term
+  world.getEntities()[1]->getComponent<Raz::Transform>().setPosition(0.f, 0.f, 5.f);
+
+  rayTracer.reset();
+  rayTracer.render(world, cameraEntity);
+  REQUIRE(recoverPixel(rayTracer.recoverImage(), imageSize / 2, imageSize / 2)[0] < litValue);
+
+  // Placing the light next to the camera with an occluder in between also shadows the sphere
+  world.getEntities()[1]->getComponent<Raz::Transform>().setPosition(3.f, 0.f, -5.f);
+  world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f({ 1.5f, 0.f, -2.5f }), 0.5f);
+
+  rayTracer.reset();
+  rayTracer.render(world, cameraEntity);
+  const uint8_t shadowedValue = recoverPixel(rayTracer.recoverImage(), imageSize / 2, imageSize / 2)[0];
+
+  world.getEntities()[2]->disable();
+
+  rayTracer.reset();
+  rayTracer.render(world, cameraEntity);
+  REQUIRE(shadowedValue < recoverPixel(rayTracer.recoverImage(), imageSize / 2, imageSize / 2)[0]);
+}
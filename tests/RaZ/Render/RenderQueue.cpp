@@ -0,0 +1,78 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/RenderQueue.hpp"
+
+#include <algorithm>
+#include <random>
+
+TEST_CASE("Render queue sort key") {
+  // Each state takes precedence over all the following ones, whatever their values
+  REQUIRE(Raz::RenderQueue::computeSortKey(1, 0, 0, 0, 0.f) > Raz::RenderQueue::computeSortKey(0, 65535, 4095, 4095, 1000.f));
+  REQUIRE(Raz::RenderQueue::computeSortKey(0, 1, 0, 0, 0.f) > Raz::RenderQueue::computeSortKey(0, 0, 4095, 4095, 1000.f));
+  REQUIRE(Raz::RenderQueue::computeSortKey(0, 0, 1, 0, 0.f) > Raz::RenderQueue::computeSortKey(0, 0, 0, 4095, 1000.f));
+  REQUIRE(Raz::RenderQueue::computeSortKey(0, 0, 0, 1, 0.f) > Raz::RenderQueue::computeSortKey(0, 0, 0, 0, 1000.f));
+
+  // Closer depths are sorted first, negative ones being considered as 0
+  REQUIRE(Raz::RenderQueue::computeSortKey(0, 0, 0, 0, 1.f) < Raz::RenderQueue::computeSortKey(0, 0, 0, 0, 2.f));
+  REQUIRE(Raz::RenderQueue::computeSortKey(0, 0, 0, 0, 0.5f) < Raz::RenderQueue::computeSortKey(0, 0, 0, 0, 1000.f));
+  REQUIRE(Raz::RenderQueue::computeSortKey(0, 0, 0, 0, -5.f) == Raz::RenderQueue::computeSortKey(0, 0, 0, 0, 0.f));
+
+  // Indices exceeding their bit count are wrapped, never spilling over the other states
+  REQUIRE(Raz::RenderQueue::computeSortKey(0, 0, 0, 4096, 0.f) == Raz::RenderQueue::computeSortKey(0, 0, 0, 0, 0.f));
+  REQUIRE(Raz::RenderQueue::computeSortKey(256, 0, 0, 0, 0.f) == 0);
+}
+
+TEST_CASE("Render queue sort") {
+  Raz::RenderQueue queue;
+  queue.sort(); // Sorting an empty queue does nothing
+
+  std::mt19937_64 randGenerator(42);
+  std::vector<uint64_t> keys;
+
+  for (std::size_t commandIndex = 0; commandIndex < 1000; ++commandIndex) {
+    // Reusing few distinct keys, some sharing their highest bytes, to check that commands with equal keys keep their order
+    const uint64_t key = (randGenerator() % 50) * 0x0101000000000001ull;
+
+    keys.emplace_back(key);
+    queue.addCommand(key, nullptr, nullptr, nullptr, commandIndex);
+  }
+
+  queue.sort();
+  REQUIRE(queue.getCommandCount() == keys.size());
+
+  const std::vector<Raz::RenderCommand>& commands = queue.getCommands();
+
+  for (std::size_t commandIndex = 1; commandIndex < commands.size(); ++commandIndex) {
+    REQUIRE(commands[commandIndex - 1].sortKey <= commands[commandIndex].sortKey);
+
+    if (commands[commandIndex - 1].sortKey == commands[commandIndex].sortKey)
+      REQUIRE(commands[commandIndex - 1].transformIndex < commands[commandIndex].transformIndex);
+  }
+
+  for (const Raz::RenderCommand& command : commands)
+    REQUIRE(command.sortKey == keys[command.transformIndex]);
+
+  queue.clear();
+  REQUIRE(queue.getCommandCount() == 0);
+  REQUIRE(queue.getTransformCount() == 0);
+}
+
+TEST_CASE("Render queue prepared commands") {
+  Raz::RenderQueue queue;
+  queue.addTransform(Raz::Mat4f::identity());
+  queue.addCommand(0, nullptr, nullptr, nullptr, 0);
+
+  Raz::RenderCommand command;
+  command.sortKey        = 42;
+  command.transformIndex = 1;
+  command.instanceCount  = 2;
+
+  // Transformation indices of the prepared commands are offset past the queue's existing ones
+  queue.addCommands({ command, command }, { Raz::Mat4f::identity(), Raz::Mat4f::identity(), Raz::Mat4f::identity() });
+
+  REQUIRE(queue.getCommandCount() == 3);
+  REQUIRE(queue.getTransformCount() == 4);
+  REQUIRE(queue.getCommands()[1].transformIndex == 2);
+  REQUIRE(queue.getCommands()[2].transformIndex == 2);
+  REQUIRE(queue.getCommands()[2].sortKey == 42);
+  REQUIRE(queue.getCommands()[2].instanceCount == 2);
+}
@@ -0,0 +1,131 @@
+#include "catch/catch.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/VertexLayout.hpp"
+#include "RaZ/Utils/FloatUtils.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+TEST_CASE("Vertex layout strides") {
+  const Raz::VertexLayout defaultLayout;
+  REQUIRE_FALSE(defaultLayout.isCompressed());
+  REQUIRE(defaultLayout.computeStride() == sizeof(Raz::Vertex));
+
+  const Raz::VertexLayout compressedLayout = Raz::VertexLayout::compressed();
+  REQUIRE(compressedLayout.isCompressed());
+  REQUIRE(compressedLayout.computeStride() == 24);
+
+  const Raz::VertexLayout quantizedLayout = Raz::VertexLayout::compressed(true);
+  REQUIRE(quantizedLayout.positionFormat == Raz::PositionFormat::QUANTIZED_UNORM16);
+  REQUIRE(quantizedLayout.computeStride() == 20);
+}
+
+TEST_CASE("Half float conversion") {
+  REQUIRE(Raz::FloatUtils::packHalfFloat(0.f) == 0x0000);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(-0.f) == 0x8000);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(1.f) == 0x3C00);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(-2.f) == 0xC000);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(0.5f) == 0x3800);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(65504.f) == 0x7BFF);
+
+  // Values out of range become infinite or null
+  REQUIRE(Raz::FloatUtils::packHalfFloat(65520.f) == 0x7C00);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(-1e10f) == 0xFC00);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(1e-10f) == 0x0000);
+
+  // Denormals
+  REQUIRE(Raz::FloatUtils::packHalfFloat(std::ldexp(1.f, -24)) == 0x0001);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(std::ldexp(1.f, -15)) == 0x0200);
+
+  // Rounding to nearest even
+  REQUIRE(Raz::FloatUtils::packHalfFloat(1.f + std::ldexp(1.f, -11)) == 0x3C00);
+  REQUIRE(Raz::FloatUtils::packHalfFloat(1.f + std::ldexp(3.f, -11)) == 0x3C02);
+
+  REQUIRE(std::isinf(Raz::FloatUtils::unpackHalfFloat(0x7C00)));
+  REQUIRE(std::isnan(Raz::FloatUtils::unpackHalfFloat(Raz::FloatUtils::packHalfFloat(std::numeric_limits<float>::quiet_NaN()))));
+
+  // Every finite half value is converted back exactly
+  for (uint32_t halfBits = 0; halfBits < 0x10000; ++halfBits) {
+    if ((halfBits & 0x7C00) == 0x7C00)
+      continue;
+
+    const float value = Raz::FloatUtils::unpackHalfFloat(static_cast<uint16_t>(halfBits));
+    REQUIRE(Raz::FloatUtils::packHalfFloat(value) == halfBits);
+  }
+
+  REQUIRE(Raz::FloatUtils::unpackHalfFloat(0x3C00) == 1.f);
+  REQUIRE(Raz::FloatUtils::unpackHalfFloat(0xC000) == -2.f);
+  REQUIRE(Raz::FloatUtils::unpackHalfFloat(0x0001) == std::ldexp(1.f, -24));
+}
+
+TEST_CASE("Vertex packing") {
+  // Directions keep 9 bits of precision plus their sign
+  const Raz::Vec3f direction = Raz::Vec3f({ 0.3f, -0.5f, 0.8f }).normalize();
+  float w {};
+  const Raz::Vec3f unpackedDir = Raz::VertexPacking::unpackDirection(Raz::VertexPacking::packDirection(direction, -1.f), &w);
+
+  for (std::size_t compIndex = 0; compIndex < 3; ++compIndex)
+    REQUIRE(std::abs(unpackedDir[compIndex] - direction[compIndex]) <= 0.5f / 511.f);
+
+  REQUIRE(w == -1.f);
+  REQUIRE(Raz::VertexPacking::unpackDirection(Raz::VertexPacking::packDirection(Raz::Vec3f({ 1.f, -1.f, 0.f }))) == Raz::Vec3f({ 1.f, -1.f, 0.f }));
+
+  // Positions are mapped from the box's range to the whole unsigned short range
+  const Raz::AABB bounds(Raz::Vec3f({ 2.f, 1.f, 0.f }), Raz::Vec3f({ -2.f, -1.f, 0.f }));
+  const std::array<uint16_t, 4> minPos = Raz::VertexPacking::quantizePosition(Raz::Vec3f({ -2.f, -1.f, 0.f }), bounds);
+  const std::array<uint16_t, 4> maxPos = Raz::VertexPacking::quantizePosition(Raz::Vec3f({ 2.f, 1.f, 0.f }), bounds);
+  const std::array<uint16_t, 4> midPos = Raz::VertexPacking::quantizePosition(Raz::Vec3f({ 0.f, 0.5f, 0.f }), bounds);
+
+  REQUIRE(minPos == std::array<uint16_t, 4>({{ 0, 0, 0, 0 }}));
+  REQUIRE(maxPos == std::array<uint16_t, 4>({{ 65535, 65535, 0, 0 }}));
+  REQUIRE(midPos == std::array<uint16_t, 4>({{ 32768, 49151, 0, 0 }}));
+
+  Raz::Vec3f offset;
+  Raz::Vec3f scale;
+  Raz::VertexPacking::computeDequantization(bounds, offset, scale);
+
+  REQUIRE(offset == Raz::Vec3f({ -2.f, -1.f, 0.f }));
+  REQUIRE(scale == Raz::Vec3f({ 4.f, 2.f, 0.f }));
+
+  const float dequantizedY = offset[1] + static_cast<float>(midPos[1]) / 65535.f * scale[1];
+  REQUIRE(std::abs(dequantizedY - 0.5f) <= scale[1] / 65535.f);
+
+  Raz::Vertex vertex;
+  vertex.position  = Raz::Vec3f({ 2.f, -1.f, 0.f });
+  vertex.texcoords = Raz::Vec2f({ 0.25f, 1.f });
+  vertex.normal    = Raz::Axis::Z;
+  vertex.tangent   = Raz::Axis::X;
+
+  const std::vector<Raz::Vertex> vertices = { vertex, vertex };
+
+  // The default layout stores the vertices as is
+  const std::vector<uint8_t> defaultData = Raz::VertexLayout().packVertices(vertices, bounds);
+  REQUIRE(defaultData.size() == sizeof(Raz::Vertex) * 2);
+  REQUIRE(std::memcmp(defaultData.data(), vertices.data(), defaultData.size()) == 0);
+
+  const Raz::VertexLayout layout = Raz::VertexLayout::compressed(true);
+  const std::vector<uint8_t> data = layout.packVertices(vertices, bounds);
+  REQUIRE(data.size() == layout.computeStride() * 2);
+
+  // Both vertices are packed identically, one after the other
+  REQUIRE(std::memcmp(data.data(), data.data() + layout.computeStride(), layout.computeStride()) == 0);
+
+  std::array<uint16_t, 4> position {};
+  std::array<uint16_t, 2> texcoords {};
+  uint32_t normal {};
+  uint32_t tangent {};
+  std::memcpy(position.data(), data.data(), sizeof(position));
+  std::memcpy(texcoords.data(), data.data() + 8, sizeof(texcoords));
+  std::memcpy(&normal, data.data() + 12, sizeof(normal));
+  std::memcpy(&tangent, data.data() + 16, sizeof(tangent));
+
+  REQUIRE(position == std::array<uint16_t, 4>({{ 65535, 0, 0, 0 }}));
+  REQUIRE(Raz::FloatUtils::unpackHalfFloat(texcoords[0]) == 0.25f);
+  REQUIRE(Raz::FloatUtils::unpackHalfFloat(texcoords[1]) == 1.f);
+  REQUIRE(Raz::VertexPacking::unpackDirection(normal) == Raz::Axis::Z);
+
+  float handedness {};
+  REQUIRE(Raz::VertexPacking::unpackDirection(tangent, &handedness) == Raz::Axis::X);
+  REQUIRE(handedness == 1.f);
+}
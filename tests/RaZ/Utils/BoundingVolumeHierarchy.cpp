@@ -0,0 +1,152 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/BoundingVolumeHierarchy.hpp"
+
+namespace {
+
+// Declaring a row of 10 unit boxes along the X axis, each one spaced by 1 unit
+//
+//   [ 0; 1 ]  [ 2; 3 ]  [ 4; 5 ]        [ 18; 19 ]
+//    ______    ______    ______          ______
+//   |      |  |      |  |      |        |      |
+//   |  0   |  |  1   |  |  2   |  ...   |  9   |
+//   |______|  |______|  |______|        |______|
+
+std::vector<Raz::AABB> createBoxes() {
+  std::vector<Raz::AABB> boxes;
+
+  for (std::size_t boxIndex = 0; boxIndex < 10; ++boxIndex) {
+    const auto minX = static_cast<float>(boxIndex * 2);
+    boxes.emplace_back(Raz::Vec3f({ minX + 1.f, 0.5f, 0.5f }), Raz::Vec3f({ minX, -0.5f, -0.5f }));
+  }
+
+  return boxes;
+}
+
+} // namespace
+
+TEST_CASE("BVH build") {
+  Raz::BoundingVolumeHierarchy bvh;
+  REQUIRE(bvh.isEmpty());
+
+  bvh.build(createBoxes());
+  REQUIRE_FALSE(bvh.isEmpty());
+  REQUIRE(bvh.getPrimitiveCount() == 10);
+
+  const Raz::AABB rootBox = bvh.recoverRootBox();
+  REQUIRE(rootBox.getLeftBottomBackPos() == Raz::Vec3f({ 0.f, -0.5f, -0.5f }));
+  REQUIRE(rootBox.getRightTopFrontPos() == Raz::Vec3f({ 19.f, 0.5f, 0.5f }));
+}
+
+TEST_CASE("BVH ray query") {
+  const std::vector<Raz::AABB> boxes = createBoxes();
+  const Raz::BoundingVolumeHierarchy bvh(boxes);
+
+  // A ray going along the row finds the first box first; lowering the distance must skip the remaining ones
+  const Raz::Ray ray(Raz::Vec3f({ -5.f, 0.f, 0.f }), Raz::Axis::X);
+
+  std::vector<std::size_t> checkedBoxes;
+  float maxDistance = std::numeric_limits<float>::max();
+
+  REQUIRE(bvh.query(ray, maxDistance, [&] (std::size_t boxIndex, float& maxDist) {
+    checkedBoxes.emplace_back(boxIndex);
+
+    Raz::RayHit hit;
+
+    if (!ray.intersects(boxes[boxIndex], &hit) || hit.distance >= maxDist)
+      return false;
+
+    maxDist = hit.distance;
+    return true;
+  }));
+
+  REQUIRE(maxDistance == Approx(5.f));
+  REQUIRE(checkedBoxes.front() == 0);
+  REQUIRE(checkedBoxes.size() < boxes.size());
+
+  // A ray going upward between the boxes must not reach any of them
+  const Raz::Ray missingRay(Raz::Vec3f({ 1.5f, -5.f, 0.f }), Raz::Axis::Y);
+  maxDistance = std::numeric_limits<float>::max();
+
+  REQUIRE_FALSE(bvh.query(missingRay, maxDistance, [&boxes, &missingRay] (std::size_t boxIndex, float&) {
+    return missingRay.intersects(boxes[boxIndex]);
+  }));
+
+  // A ray going upward through box 5 only reaches it
+  const Raz::Ray upwardRay(Raz::Vec3f({ 10.5f, -5.f, 0.f }), Raz::Axis::Y);
+  maxDistance = std::numeric_limits<float>::max();
+  checkedBoxes.clear();
+
+  REQUIRE(bvh.query(upwardRay, maxDistance, [&] (std::size_t boxIndex, float&) {
+    if (!upwardRay.intersects(boxes[boxIndex]))
+      return false;
+
+    checkedBoxes.emplace_back(boxIndex);
+    return true;
+  }));
+  REQUIRE(checkedBoxes == std::vector<std::size_t>({ 5 }));
+}
+
+TEST_CASE("BVH ray packet query") {
+  const std::vector<Raz::AABB> boxes = createBoxes();
+  const Raz::BoundingVolumeHierarchy bvh(boxes);
+
+  // Rays going upward through boxes 0, 3 & 9, the last one going between boxes 4 & 5
+  const Raz::RayPacket4 packet({ Raz::Ray(Raz::Vec3f({ 0.5f, -5.f, 0.f }), Raz::Axis::Y),
+                                 Raz::Ray(Raz::Vec3f({ 6.5f, -5.f, 0.f }), Raz::Axis::Y),
+                                 Raz::Ray(Raz::Vec3f({ 18.5f, -5.f, 0.f }), Raz::Axis::Y),
+                                 Raz::Ray(Raz::Vec3f({ 9.5f, -5.f, 0.f }), Raz::Axis::Y) });
+
+  Raz::RayPacket4::DistanceArray maxDistances {};
+  maxDistances.fill(std::numeric_limits<float>::max());
+
+  std::vector<std::size_t> hitBoxes;
+
+  const uint32_t hitMask = bvh.query(packet, maxDistances, [&] (std::size_t boxIndex, uint32_t rayMask, Raz::RayPacket4::DistanceArray&) {
+    const uint32_t boxHitMask = packet.intersects(boxes[boxIndex]) & rayMask;
+
+    if (boxHitMask)
+      hitBoxes.emplace_back(boxIndex);
+
+    return boxHitMask;
+  });
+
+  REQUIRE(hitMask == 0b0111);
+
+  std::sort(hitBoxes.begin(), hitBoxes.end());
+  REQUIRE(hitBoxes == std::vector<std::size_t>({ 0, 3, 9 }));
+}
+
+TEST_CASE("BVH box query & refit") {
+  std::vector<Raz::AABB> boxes = createBoxes();
+  Raz::BoundingVolumeHierarchy bvh(boxes);
+
+  // The hierarchy gives back candidates, whose boxes must then be checked
+  Raz::AABB queryBox(Raz::Vec3f({ 6.5f, 1.f, 1.f }), Raz::Vec3f({ 2.5f, 0.f, 0.f }));
+  std::vector<std::size_t> overlappingBoxes;
+
+  const auto collectBox = [&boxes, &queryBox, &overlappingBoxes] (std::size_t boxIndex) {
+    const Raz::AABB& box = boxes[boxIndex];
+
+    if (box.getLeftBottomBackPos()[0] <= queryBox.getRightTopFrontPos()[0] && box.getRightTopFrontPos()[0] >= queryBox.getLeftBottomBackPos()[0])
+      overlappingBoxes.emplace_back(boxIndex);
+  };
+
+  bvh.query(queryBox, collectBox);
+  std::sort(overlappingBoxes.begin(), overlappingBoxes.end());
+  REQUIRE(overlappingBoxes == std::vector<std::size_t>({ 1, 2, 3 }));
+
+  // Moving the first box to the other end of the row
+  boxes.front() = Raz::AABB(Raz::Vec3f({ 21.f, 0.5f, 0.5f }), Raz::Vec3f({ 20.f, -0.5f, -0.5f }));
+  bvh.refit(boxes);
+
+  REQUIRE(bvh.recoverRootBox().getLeftBottomBackPos() == Raz::Vec3f({ 2.f, -0.5f, -0.5f }));
+  REQUIRE(bvh.recoverRootBox().getRightTopFrontPos() == Raz::Vec3f({ 21.f, 0.5f, 0.5f }));
+
+  overlappingBoxes.clear();
+  queryBox = Raz::AABB(Raz::Vec3f(25.f), Raz::Vec3f({ 19.5f, -1.f, -1.f }));
+  bvh.query(queryBox, collectBox);
+  std::sort(overlappingBoxes.begin(), overlappingBoxes.end());
+  REQUIRE(overlappingBoxes == std::vector<std::size_t>({ 0 }));
+
+  REQUIRE_THROWS(bvh.refit(std::vector<Raz::AABB>()));
+}
@@ -0,0 +1,134 @@
+#include "catch/catch.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Utils/Frustum.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
+
+#include <random>
+
+namespace {
+
+// Declaring a camera located at the origin & looking towards +Z, seeing from 0.1 to 100 units with a field of view of 90°
+//
+//     \      |      /
+//      \     |     /
+//       \  camera /
+//        \   |   /
+//         \__v__/
+//            Z
+
+Raz::Frustum createFrustum() {
+  Raz::Camera camera(100, 100, 90.f, 0.1f, 100.f);
+  const Raz::Transform cameraTrans;
+
+  const Raz::Mat4f& viewMat = camera.computeViewMatrix(cameraTrans.computeTranslationMatrix(true), cameraTrans.getRotation().inverse());
+  return Raz::Frustum(viewMat * camera.getProjectionMatrix());
+}
+
+} // namespace
+
+TEST_CASE("Frustum planes") {
+  const Raz::Frustum frustum = createFrustum();
+
+  // All planes' normals must be normalized & point inward
+  for (const Raz::Plane& plane : frustum.getPlanes()) {
+    REQUIRE(plane.getNormal().computeLength() == Approx(1.f));
+    REQUIRE(plane.getNormal().dot(Raz::Vec3f({ 0.f, 0.f, 10.f })) - plane.getDistance() > 0.f);
+  }
+
+  REQUIRE(frustum.getPlanes()[4].getNormal()[2] == Approx(1.f));  // Near
+  REQUIRE(frustum.getPlanes()[5].getNormal()[2] == Approx(-1.f)); // Far
+}
+
+TEST_CASE("Frustum containment & intersection") {
+  const Raz::Frustum frustum = createFrustum();
+
+  REQUIRE(frustum.contains(Raz::Vec3f({ 0.f, 0.f, 10.f })));
+  REQUIRE(frustum.contains(Raz::Vec3f({ 9.f, -9.f, 10.f })));
+  REQUIRE_FALSE(frustum.contains(Raz::Vec3f({ 11.f, 0.f, 10.f })));
+  REQUIRE_FALSE(frustum.contains(Raz::Vec3f({ 0.f, 0.f, -10.f })));
+  REQUIRE_FALSE(frustum.contains(Raz::Vec3f({ 0.f, 0.f, 0.05f })));
+  REQUIRE_FALSE(frustum.contains(Raz::Vec3f({ 0.f, 0.f, 101.f })));
+
+  REQUIRE(frustum.intersects(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, 50.f }), 1.f)));
+  REQUIRE(frustum.intersects(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, -0.5f }), 1.f)));  // Crossing the near plane
+  REQUIRE_FALSE(frustum.intersects(Raz::Sphere(Raz::Vec3f({ 0.f, 0.f, -5.f }), 1.f)));
+  REQUIRE_FALSE(frustum.intersects(Raz::Sphere(Raz::Vec3f({ 0.f, 20.f, 10.f }), 1.f)));
+
+  REQUIRE(frustum.intersects(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 6.f }), Raz::Vec3f({ -1.f, -1.f, 4.f }))));
+  REQUIRE(frustum.intersects(Raz::AABB(Raz::Vec3f({ 20.f, 1.f, 6.f }), Raz::Vec3f({ 4.f, -1.f, 4.f }))));   // Crossing the right plane
+  REQUIRE(frustum.intersects(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 200.f }), Raz::Vec3f({ -1.f, -1.f, 99.f })))); // Crossing the far plane
+  REQUIRE_FALSE(frustum.intersects(Raz::AABB(Raz::Vec3f({ 1.f, 1.f, -4.f }), Raz::Vec3f({ -1.f, -1.f, -6.f }))));
+  REQUIRE_FALSE(frustum.intersects(Raz::AABB(Raz::Vec3f({ 20.f, 1.f, 6.f }), Raz::Vec3f({ 10.f, -1.f, 4.f }))));
+}
+
+TEST_CASE("Frustum batch visibility") {
+  const Raz::Frustum frustum = createFrustum();
+
+  // Boxes are randomly spread around the camera; their count is neither a multiple of a pack nor of a mask, to check the padding
+  std::mt19937 randomGenerator(42);
+  std::uniform_real_distribution<float> posDistrib(-120.f, 120.f);
+  std::uniform_real_distribution<float> sizeDistrib(0.f, 5.f);
+
+  std::vector<Raz::AABB> boxes;
+  Raz::BoxArray boxArray;
+
+  for (std::size_t boxIndex = 0; boxIndex < 10005; ++boxIndex) {
+    const Raz::Vec3f minPos({ posDistrib(randomGenerator), posDistrib(randomGenerator), posDistrib(randomGenerator) });
+    const Raz::Vec3f maxPos = minPos + Raz::Vec3f({ sizeDistrib(randomGenerator), sizeDistrib(randomGenerator), sizeDistrib(randomGenerator) });
+
+    boxes.emplace_back(maxPos, minPos);
+    boxArray.addBox(boxes.back());
+  }
+
+  REQUIRE(boxArray.getSize() == 10005);
+  REQUIRE(boxArray.getCentroids(0).size() % Raz::BoxArray::PackSize == 0);
+
+  const auto checkMasks = [&boxes] (const std::vector<uint32_t>& masks, const Raz::Frustum& checkedFrustum) {
+    REQUIRE(masks.size() == (boxes.size() + 31) / 32);
+
+    for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex)
+      REQUIRE(((masks[boxIndex / 32] >> (boxIndex % 32)) & 1u) == static_cast<uint32_t>(checkedFrustum.intersects(boxes[boxIndex])));
+
+    // The bits after the last box must never be set
+    REQUIRE((masks.back() >> (boxes.size() % 32)) == 0);
+  };
+
+  std::vector<uint32_t> visibilityMasks;
+  frustum.computeVisibility(boxArray, visibilityMasks);
+  checkMasks(visibilityMasks, frustum);
+
+  // Checking with a thread pool must give the same results, even when reusing masks computed with another frustum
+  Raz::Camera camera(100, 100, 45.f, 1.f, 50.f);
+  Raz::Transform cameraTrans(Raz::Vec3f({ 10.f, 0.f, 0.f }));
+  cameraTrans.rotate(90.f, Raz::Axis::Y);
+
+  const Raz::Mat4f& viewMat = camera.computeViewMatrix(cameraTrans.computeTranslationMatrix(true), cameraTrans.getRotation().inverse());
+  const Raz::Frustum rotatedFrustum(viewMat * camera.getProjectionMatrix());
+
+  Raz::ThreadPool threadPool(4);
+  rotatedFrustum.computeVisibility(boxArray, visibilityMasks, threadPool);
+  checkMasks(visibilityMasks, rotatedFrustum);
+
+  REQUIRE_THROWS(frustum.computeVisibility(boxArray, visibilityMasks, 8));
+
+  boxArray.setBox(0, Raz::AABB(Raz::Vec3f({ 1.f, 1.f, 11.f }), Raz::Vec3f({ -1.f, -1.f, 9.f })));
+  frustum.computeVisibility(boxArray, visibilityMasks, 0, 1);
+  REQUIRE((visibilityMasks.front() & 1u) == 1u);
+
+  boxArray.clear();
+  REQUIRE(boxArray.getSize() == 0);
+}
+
+TEST_CASE("AABB transformation") {
+  const Raz::AABB box(Raz::Vec3f({ 1.f, 2.f, 3.f }), Raz::Vec3f({ -1.f, -2.f, -3.f }));
+
+  const Raz::Transform transform(Raz::Vec3f({ 10.f, 0.f, 0.f }), Raz::Quaternionf(90.f, Raz::Axis::Y).computeMatrix(), Raz::Vec3f(2.f));
+  const Raz::AABB transformedBox = box.computeTransformedBox(transform.computeTransformMatrix());
+
+  // Rotating by 90° around Y swaps the X & Z extents
+  REQUIRE(transformedBox.computeCentroid() == Raz::Vec3f({ 10.f, 0.f, 0.f }));
+  REQUIRE(transformedBox.computeHalfExtents()[0] == Approx(6.f));
+  REQUIRE(transformedBox.computeHalfExtents()[1] == Approx(4.f));
+  REQUIRE(transformedBox.computeHalfExtents()[2] == Approx(2.f));
+}
@@ -0,0 +1,90 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/RangeAllocator.hpp"
+
+TEST_CASE("Range allocator allocation") {
+  Raz::RangeAllocator allocator(100);
+
+  REQUIRE(allocator.getCapacity() == 100);
+  REQUIRE(allocator.getFreeSize() == 100);
+  REQUIRE_THROWS(allocator.allocate(0));
+
+  const std::size_t offset1 = allocator.allocate(30);
+  const std::size_t offset2 = allocator.allocate(30);
+  const std::size_t offset3 = allocator.allocate(30);
+
+  REQUIRE(offset1 == 0);
+  REQUIRE(offset2 == 30);
+  REQUIRE(offset3 == 60);
+  REQUIRE(allocator.getAllocationCount() == 3);
+  REQUIRE(allocator.getAllocatedSize() == 90);
+
+  // Not enough contiguous space remains
+  REQUIRE(allocator.allocate(20) == Raz::RangeAllocator::InvalidOffset);
+
+  allocator.free(offset2);
+  REQUIRE_THROWS(allocator.free(offset2));
+  REQUIRE(allocator.getFreeSize() == 40);
+  REQUIRE(allocator.computeLargestFreeSize() == 30);
+
+  // The first free range large enough is used, its remainder staying free
+  REQUIRE(allocator.allocate(20) == 30);
+  REQUIRE(allocator.getFreeRanges().size() == 2);
+  REQUIRE(allocator.getFreeRanges()[0].offset == 50);
+  REQUIRE(allocator.getFreeRanges()[0].size == 10);
+
+  // Freed ranges are merged with their free neighbours
+  allocator.free(30);
+  allocator.free(offset3);
+  REQUIRE(allocator.getFreeRanges().size() == 1);
+  REQUIRE(allocator.getFreeRanges()[0].offset == 30);
+  REQUIRE(allocator.getFreeRanges()[0].size == 70);
+
+  allocator.free(offset1);
+  REQUIRE(allocator.getFreeRanges().size() == 1);
+  REQUIRE(allocator.getFreeRanges()[0].size == 100);
+  REQUIRE(allocator.getAllocatedSize() == 0);
+}
+
+TEST_CASE("Range allocator growth & defragmentation") {
+  Raz::RangeAllocator allocator;
+  REQUIRE(allocator.allocate(10) == Raz::RangeAllocator::InvalidOffset);
+
+  allocator.grow(50);
+  REQUIRE_THROWS(allocator.grow(20));
+
+  const std::size_t offset1 = allocator.allocate(10);
+  const std::size_t offset2 = allocator.allocate(10);
+  const std::size_t offset3 = allocator.allocate(20);
+  REQUIRE(offset3 == 20);
+
+  // The added space is merged with the trailing free range
+  allocator.grow(60);
+  REQUIRE(allocator.getFreeRanges().size() == 1);
+  REQUIRE(allocator.getFreeRanges()[0].offset == 40);
+  REQUIRE(allocator.getFreeRanges()[0].size == 20);
+
+  allocator.free(offset1);
+  REQUIRE(allocator.computeLargestFreeSize() == 20);
+  REQUIRE(allocator.allocate(30) == Raz::RangeAllocator::InvalidOffset);
+
+  // Allocations are packed in order; the first one not having to move, it has no relocation
+  const std::vector<Raz::RangeRelocation> relocations = allocator.defragment();
+
+  REQUIRE(relocations.size() == 2);
+  REQUIRE(relocations[0].oldOffset == offset2);
+  REQUIRE(relocations[0].newOffset == 0);
+  REQUIRE(relocations[0].size == 10);
+  REQUIRE(relocations[1].oldOffset == offset3);
+  REQUIRE(relocations[1].newOffset == 10);
+  REQUIRE(relocations[1].size == 20);
+
+  REQUIRE(allocator.getFreeRanges().size() == 1);
+  REQUIRE(allocator.getFreeRanges()[0].offset == 30);
+  REQUIRE(allocator.getFreeRanges()[0].size == 30);
+  REQUIRE(allocator.allocate(30) == 30);
+
+  // Relocated ranges are freed at their new offsets
+  REQUIRE_THROWS(allocator.free(offset3));
+  allocator.free(10);
+  REQUIRE(allocator.defragment().size() == 1);
+}
@@ -52,6 +52,64 @@ TEST_CASE("Ray-point intersection") {
   REQUIRE_FALSE(ray3.intersects(topRightPoint));
 }
 
+TEST_CASE("Ray-line intersection") {
+  //                 line2
+  //                   |
+  //   [ -1; 1 ] x-----|-----x [ 1; 1 ] < line1
+  //                   |
+  //                   x [ 1; -1 ]
+  const Raz::Line line1(Raz::Vec3f({ -1.f, 1.f, 0.f }), Raz::Vec3f({ 1.f, 1.f, 0.f }));
+  const Raz::Line line2(Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ 1.f, 0.5f, 0.f }));
+
+  Raz::RayHit hit;
+
+  REQUIRE(ray1.intersects(line1, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  REQUIRE(hit.normal == -Raz::Axis::Y);
+  REQUIRE(hit.distance == Approx(1.f));
+
+  REQUIRE(ray2.intersects(line1, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 1.f, 1.f, 0.f }));
+  REQUIRE(hit.distance == Approx(2.f * std::sqrt(2.f)));
+
+  // Ray 3 starts on line 1's right extremity, thus touching it right away
+  REQUIRE(ray3.intersects(line1, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 1.f, 1.f, 0.f }));
+  REQUIRE(hit.distance == 0.f);
+
+  REQUIRE_FALSE(ray1.intersects(line2));
+  REQUIRE_FALSE(ray2.intersects(line2));
+  REQUIRE_FALSE(ray3.intersects(line2));
+}
+
+TEST_CASE("Ray-plane intersection") {
+  const Raz::Plane plane1(1.f, Raz::Axis::Y);
+  const Raz::Plane plane2(0.5f, Raz::Axis::X);
+  const Raz::Plane plane3(-1.f, Raz::Axis::Z);
+
+  Raz::RayHit hit;
+
+  REQUIRE(ray1.intersects(plane1, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  REQUIRE(hit.normal == Raz::Axis::Y);
+  REQUIRE(hit.distance == Approx(1.f));
+
+  REQUIRE(ray2.intersects(plane1));
+  REQUIRE_FALSE(ray3.intersects(plane1));
+
+  // Ray 1 is parallel to plane 2
+  REQUIRE_FALSE(ray1.intersects(plane2));
+  REQUIRE(ray2.intersects(plane2, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.5f, 0.5f, 0.f }));
+  REQUIRE(hit.distance == Approx(1.5f * std::sqrt(2.f)));
+  REQUIRE(ray3.intersects(plane2));
+
+  // All rays are parallel to plane 3
+  REQUIRE_FALSE(ray1.intersects(plane3));
+  REQUIRE_FALSE(ray2.intersects(plane3));
+  REQUIRE_FALSE(ray3.intersects(plane3));
+}
+
 TEST_CASE("Ray-sphere intersection") {
   const Raz::Sphere sphere1(Raz::Vec3f(0.f), 1.f);
   const Raz::Sphere sphere2(Raz::Vec3f({ 5.f, 10.f, 0.f }), 5.f);
@@ -92,6 +150,27 @@ TEST_CASE("Ray-triangle intersection") {
   REQUIRE(ray3.intersects(triangle3));
 }
 
+TEST_CASE("Ray-quad intersection") {
+  // quad1 is laying flat slightly above 0, quad2 is standing far on the right
+  const Raz::Quad quad1(Raz::Vec3f({ -1.f, 0.5f, -1.f }), Raz::Vec3f({ 1.f, 0.5f, -1.f }),
+                        Raz::Vec3f({ 1.f, 0.5f, 1.f }), Raz::Vec3f({ -1.f, 0.5f, 1.f }));
+  const Raz::Quad quad2(Raz::Vec3f({ 5.f, 1.f, -1.f }), Raz::Vec3f({ 5.f, 1.f, 1.f }),
+                        Raz::Vec3f({ 5.f, -1.f, 1.f }), Raz::Vec3f({ 5.f, -1.f, -1.f }));
+
+  Raz::RayHit hit;
+
+  REQUIRE(ray1.intersects(quad1, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.f, 0.5f, 0.f }));
+  REQUIRE(hit.distance == Approx(0.5f));
+  REQUIRE(ray2.intersects(quad1));
+  REQUIRE(ray3.intersects(quad1, &hit));
+  REQUIRE(hit.distance == Approx(std::sqrt(0.5f)));
+
+  REQUIRE_FALSE(ray1.intersects(quad2));
+  REQUIRE_FALSE(ray2.intersects(quad2));
+  REQUIRE_FALSE(ray3.intersects(quad2));
+}
+
 TEST_CASE("Ray-AABB intersection") {
   //         _______________________
   //        /|                    /|
@@ -126,6 +205,45 @@ TEST_CASE("Ray-AABB intersection") {
   REQUIRE(ray3.intersects(aabb3));
 }
 
+TEST_CASE("Ray hit information") {
+  Raz::RayHit hit;
+
+  // Ray 1 starts inside the sphere & exits it on top
+  REQUIRE(ray1.intersects(Raz::Sphere(Raz::Vec3f(0.f), 1.f), &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  REQUIRE(hit.normal == Raz::Axis::Y);
+  REQUIRE(hit.distance == Approx(1.f));
+
+  REQUIRE(ray3.intersects(Raz::Sphere(Raz::Vec3f({ -10.f, -10.f, 0.f }), 1.f), &hit));
+  REQUIRE(hit.normal == Raz::Vec3f({ 1.f, 1.f, 0.f }).normalize());
+  REQUIRE(hit.distance == Approx(11.f * std::sqrt(2.f) - 1.f));
+
+  // The triangle's normal is oriented downward
+  REQUIRE(ray1.intersects(Raz::Triangle(Raz::Vec3f({ -3.f, 0.5f, 3.f }), Raz::Vec3f({ 0.f, 0.5f, -3.f }), Raz::Vec3f({ 3.f, 0.5f, 3.f })), &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.f, 0.5f, 0.f }));
+  REQUIRE(hit.normal == -Raz::Axis::Y);
+  REQUIRE(hit.distance == Approx(0.5f));
+
+  const Raz::AABB aabb(Raz::Vec3f(1.f), Raz::Vec3f(-1.f));
+
+  // Ray 1 starts inside the box & exits it from the top face
+  REQUIRE(ray1.intersects(aabb, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  REQUIRE(hit.normal == Raz::Axis::Y);
+  REQUIRE(hit.distance == Approx(1.f));
+
+  // This ray enters the box from the bottom face
+  REQUIRE(Raz::Ray(Raz::Vec3f({ 0.5f, -5.f, 0.f }), Raz::Axis::Y).intersects(aabb, &hit));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.5f, -1.f, 0.f }));
+  REQUIRE(hit.normal == -Raz::Axis::Y);
+  REQUIRE(hit.distance == Approx(4.f));
+
+  // No mesh nor entity has been hit
+  REQUIRE(hit.entity == nullptr);
+  REQUIRE(hit.submeshIndex == std::numeric_limits<std::size_t>::max());
+  REQUIRE(hit.triangleIndex == std::numeric_limits<std::size_t>::max());
+}
+
 TEST_CASE("Point projection") {
   const Raz::Vec3f topPoint({ 0.f, 2.f, 0.f });
   const Raz::Vec3f topRightPoint({ 2.f, 2.f, 0.f });
@@ -0,0 +1,130 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/RayPacket.hpp"
+
+namespace {
+
+// Declaring rays to be tested, identical to the single rays' ones
+//
+//        Ray 1      |       Ray 2       |      Ray 3
+//                   |                   |
+//          ^        |           ^       |      [ 1; 1 ]
+//          |        |          /        |         /
+//          |        |         /         |        /
+//      [ 0; 0 ]     |    [ -1; -1 ]     |       v
+
+const Raz::Ray ray1(Raz::Vec3f({ 0.f, 0.f, 0.f }), Raz::Axis::Y);
+const Raz::Ray ray2(Raz::Vec3f({ -1.f, -1.f, 0.f }), Raz::Vec3f({ 1.f, 1.f, 0.f }).normalize());
+const Raz::Ray ray3(Raz::Vec3f({ 1.f, 1.f, 0.f }), Raz::Vec3f({ -1.f, -1.f, 0.f }).normalize());
+
+// The 4th ray is left unset in the packet of 4, and is thus never considered
+const Raz::RayPacket4 packet4({ ray1, ray2, ray3 });
+
+// The packet of 8 has its rays duplicated, the upper half being ray 3, 2 & 1 in that order, with the last one left unset
+const Raz::RayPacket8 packet8({ ray1, ray2, ray3, ray1, ray3, ray2, ray1 });
+
+template <std::size_t Size, typename ShapeT>
+uint32_t computeScalarMask(const Raz::RayPacket<Size>& packet, const ShapeT& shape) {
+  uint32_t mask = 0;
+
+  for (std::size_t rayIndex = 0; rayIndex < Size; ++rayIndex) {
+    if ((packet.getActiveMask() & (1u << rayIndex)) && packet.recoverRay(rayIndex).intersects(shape))
+      mask |= (1u << rayIndex);
+  }
+
+  return mask;
+}
+
+} // namespace
+
+TEST_CASE("Ray packet basic") {
+  REQUIRE(Raz::RayPacket4::getSize() == 4);
+  REQUIRE(Raz::RayPacket8::getSize() == 8);
+
+  REQUIRE(packet4.getActiveMask() == 0b0111);
+  REQUIRE(packet8.getActiveMask() == 0b01111111);
+
+  REQUIRE(packet4.recoverRay(1).getOrigin() == ray2.getOrigin());
+  REQUIRE(packet4.recoverRay(1).getDirection() == ray2.getDirection());
+
+  Raz::RayPacket4 packet;
+  REQUIRE(packet.getActiveMask() == 0);
+
+  packet.setRay(2, ray3);
+  REQUIRE(packet.getActiveMask() == 0b0100);
+}
+
+TEST_CASE("Ray packet-sphere intersection") {
+  const Raz::Sphere sphere1(Raz::Vec3f(0.f), 1.f);
+  const Raz::Sphere sphere2(Raz::Vec3f({ 5.f, 10.f, 0.f }), 5.f);
+  const Raz::Sphere sphere3(Raz::Vec3f({ -10.f, -10.f, 0.f }), 1.f);
+
+  REQUIRE(packet4.intersects(sphere1) == 0b0111);
+  REQUIRE(packet4.intersects(sphere2) == 0b0011);
+  REQUIRE(packet4.intersects(sphere3) == 0b0100);
+
+  REQUIRE(packet8.intersects(sphere1) == computeScalarMask(packet8, sphere1));
+  REQUIRE(packet8.intersects(sphere2) == computeScalarMask(packet8, sphere2));
+  REQUIRE(packet8.intersects(sphere3) == computeScalarMask(packet8, sphere3));
+
+  // Ray 1 starts inside sphere 1, thus hitting it on its way out at a distance of its radius
+  Raz::RayPacket4::DistanceArray hitDistances {};
+  hitDistances.fill(100.f);
+
+  REQUIRE(packet4.intersects(sphere1, hitDistances) == 0b0111);
+  REQUIRE(hitDistances[0] == Approx(1.f));
+  REQUIRE(hitDistances[3] == 100.f);
+
+  // Sphere 2 being farther than the previous hits, these must not be replaced
+  REQUIRE(packet4.intersects(sphere2, hitDistances) == 0);
+  REQUIRE(hitDistances[0] == Approx(1.f));
+}
+
+TEST_CASE("Ray packet-triangle intersection") {
+  // See the single ray-triangle intersection test for a description of these triangles
+  const Raz::Triangle triangle1(Raz::Vec3f({ -3.f, 0.5f, 3.f }), Raz::Vec3f({ 0.f, 0.5f, -3.f }), Raz::Vec3f({ 3.f, 0.5f, 3.f }));
+  const Raz::Triangle triangle2(Raz::Vec3f({ 0.5f, -0.5f, 3.f }), Raz::Vec3f({ 0.5f, -0.5f, -3.f }), Raz::Vec3f({ 0.5f, 3.f, 0.f }));
+  const Raz::Triangle triangle3(Raz::Vec3f({ 0.f, -1.f, 1.f }), Raz::Vec3f({ -1.5f, -1.5f, 0.f }), Raz::Vec3f({ 0.f, -1.75f, -1.f }));
+
+  REQUIRE(packet4.intersects(triangle1) == 0b0111);
+  REQUIRE(packet4.intersects(triangle2) == 0b0110);
+  REQUIRE(packet4.intersects(triangle3) == 0b0100);
+
+  REQUIRE(packet8.intersects(triangle1) == computeScalarMask(packet8, triangle1));
+  REQUIRE(packet8.intersects(triangle2) == computeScalarMask(packet8, triangle2));
+  REQUIRE(packet8.intersects(triangle3) == computeScalarMask(packet8, triangle3));
+
+  Raz::RayPacket4::DistanceArray hitDistances {};
+  hitDistances.fill(std::numeric_limits<float>::infinity());
+
+  REQUIRE(packet4.intersects(triangle2, hitDistances) == 0b0110);
+  REQUIRE(hitDistances[0] == std::numeric_limits<float>::infinity());
+  REQUIRE(hitDistances[2] == Approx(std::sqrt(0.5f)));
+
+  // Triangle 1 is hit at the same distances by rays 2 & 3, thus only ray 1's distance is replaced
+  REQUIRE(packet4.intersects(triangle1, hitDistances) == 0b0001);
+  REQUIRE(hitDistances[0] == Approx(0.5f));
+  REQUIRE(hitDistances[2] == Approx(std::sqrt(0.5f)));
+}
+
+TEST_CASE("Ray packet-AABB intersection") {
+  // See the single ray-AABB intersection test for a description of these boxes
+  const Raz::AABB aabb1(Raz::Vec3f(1.f), Raz::Vec3f(-1.f));
+  const Raz::AABB aabb2(Raz::Vec3f(5.f), Raz::Vec3f({ 3.f, 3.f, -5.f }));
+  const Raz::AABB aabb3(Raz::Vec3f({ -5.f, -5.f, 5.f }), Raz::Vec3f({ -10.f, -10.f, -5.f }));
+
+  REQUIRE(packet4.intersects(aabb1) == 0b0111);
+  REQUIRE(packet4.intersects(aabb2) == 0b0010);
+  REQUIRE(packet4.intersects(aabb3) == 0b0100);
+
+  REQUIRE(packet8.intersects(aabb1) == computeScalarMask(packet8, aabb1));
+  REQUIRE(packet8.intersects(aabb2) == computeScalarMask(packet8, aabb2));
+  REQUIRE(packet8.intersects(aabb3) == computeScalarMask(packet8, aabb3));
+
+  // Limiting the distances makes the farthest boxes unreachable
+  Raz::RayPacket4::DistanceArray maxDistances {};
+  maxDistances.fill(3.f);
+
+  REQUIRE(packet4.intersects(aabb1, maxDistances) == 0b0111);
+  REQUIRE(packet4.intersects(aabb2, maxDistances) == 0);
+  REQUIRE(packet4.intersects(aabb3, maxDistances) == 0);
+}
@@ -1,4 +1,5 @@
 #include "catch/catch.hpp"
+#include "RaZ/Math/Transform.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace {
@@ -120,6 +121,23 @@ TEST_CASE("Plane-plane intersection") {
   REQUIRE_FALSE(plane3.intersects(plane3));
 }
 
+TEST_CASE("Sphere-sphere intersection") {
+  const Raz::Sphere sphere1(Raz::Vec3f(0.f), 1.f);
+  const Raz::Sphere sphere2(Raz::Vec3f({ 1.5f, 0.f, 0.f }), 1.f);
+  const Raz::Sphere sphere3(Raz::Vec3f({ 0.f, 3.f, 0.f }), 1.f);
+
+  REQUIRE(sphere1.intersects(sphere2));
+  REQUIRE_FALSE(sphere1.intersects(sphere3));
+  REQUIRE_FALSE(sphere2.intersects(sphere3));
+
+  // Checking through the generic shape overload, dispatched to the actual shapes' types
+  const Raz::Shape& shape2 = sphere2;
+  const Raz::Shape& shape3 = sphere3;
+  REQUIRE(sphere1.intersects(shape2));
+  REQUIRE_FALSE(sphere1.intersects(shape3));
+  REQUIRE_FALSE(plane1.intersects(shape3));
+}
+
 TEST_CASE("Triangle basic") {
   REQUIRE(triangle1.computeCentroid() == Raz::Vec3f({ 0.f, 0.5f, 0.f }));
   REQUIRE(triangle2.computeCentroid() == Raz::Vec3f({ 0.5f, 0.666666666f, 0.f }));
@@ -151,3 +169,53 @@ TEST_CASE("AABB basic") {
   REQUIRE(aabb2.computeHalfExtents() == Raz::Vec3f({ 1.f, 1.f, 5.f }));
   REQUIRE(aabb3.computeHalfExtents() == Raz::Vec3f({ 2.5f, 2.5f, 5.f }));
 }
+
+TEST_CASE("Convex shapes intersection") {
+  // Shape pairs without dedicated checks are handled by GJK
+  const Raz::Line line(Raz::Vec3f({ 0.f, 0.f, -2.f }), Raz::Vec3f({ 0.f, 0.f, 2.f }));
+  const Raz::Triangle triangle(Raz::Vec3f({ -1.f, -1.f, 0.f }), Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }));
+  const Raz::Quad quad(Raz::Vec3f({ -1.f, 1.f, 1.f }), Raz::Vec3f({ 1.f, 1.f, 1.f }), Raz::Vec3f({ 1.f, -1.f, 1.f }), Raz::Vec3f({ -1.f, -1.f, 1.f }));
+  const Raz::AABB aabb(Raz::Vec3f({ 3.f, 3.f, 0.5f }), Raz::Vec3f({ 0.5f, 0.5f, -0.5f }));
+
+  REQUIRE(line.intersects(triangle));
+  REQUIRE(line.intersects(quad));
+  REQUIRE_FALSE(line.intersects(aabb));
+  REQUIRE_FALSE(triangle.intersects(quad));
+  REQUIRE_FALSE(quad.intersects(aabb));
+  REQUIRE(triangle.intersects(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(-0.5f))));
+
+  // The plane at Z = 0.5 crosses the line & the box, but neither the triangle nor the quad
+  const Raz::Plane plane(0.5f, Raz::Axis::Z);
+  REQUIRE_FALSE(plane.intersects(triangle));
+  REQUIRE_FALSE(plane.intersects(quad));
+  REQUIRE(plane.intersects(Raz::Triangle(Raz::Vec3f({ 0.f, 0.f, 0.f }), Raz::Vec3f({ 1.f, 0.f, 1.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }))));
+}
+
+TEST_CASE("Triangle & quad projection") {
+  const Raz::Triangle triangle(Raz::Vec3f({ -1.f, -1.f, 0.f }), Raz::Vec3f({ 1.f, -1.f, 0.f }), Raz::Vec3f({ 0.f, 1.f, 0.f }));
+
+  REQUIRE(triangle.computeProjection(Raz::Vec3f({ 0.f, 0.f, 5.f })) == Raz::Vec3f(0.f));
+  REQUIRE(triangle.computeProjection(Raz::Vec3f({ -3.f, -3.f, 0.f })) == Raz::Vec3f({ -1.f, -1.f, 0.f }));
+  REQUIRE(triangle.computeProjection(Raz::Vec3f({ 0.f, -3.f, 1.f })) == Raz::Vec3f({ 0.f, -1.f, 0.f }));
+
+  const Raz::Quad quad(Raz::Vec3f({ -1.f, 1.f, 1.f }), Raz::Vec3f({ 1.f, 1.f, 1.f }), Raz::Vec3f({ 1.f, -1.f, 1.f }), Raz::Vec3f({ -1.f, -1.f, 1.f }));
+
+  REQUIRE(quad.computeProjection(Raz::Vec3f({ 0.5f, -0.5f, -2.f })) == Raz::Vec3f({ 0.5f, -0.5f, 1.f }));
+  REQUIRE(quad.computeProjection(Raz::Vec3f({ -0.5f, 0.5f, 3.f })) == Raz::Vec3f({ -0.5f, 0.5f, 1.f }));
+  REQUIRE(quad.computeProjection(Raz::Vec3f({ 5.f, 5.f, 1.f })) == Raz::Vec3f({ 1.f, 1.f, 1.f }));
+  REQUIRE(quad.contains(Raz::Vec3f({ 0.f, 0.f, 1.f })));
+  REQUIRE_FALSE(quad.contains(Raz::Vec3f({ 0.f, 0.f, 0.f })));
+}
+
+TEST_CASE("Sphere transformation") {
+  const Raz::Sphere sphere(Raz::Vec3f({ 1.f, 0.f, 0.f }), 2.f);
+
+  // Non-uniform scaling makes the sphere enclose the ellipsoid, its radius being scaled by the largest factor
+  const Raz::Transform transform(Raz::Vec3f({ 0.f, 5.f, 0.f }), Raz::Quaternionf(90.f, Raz::Axis::Z).computeMatrix(), Raz::Vec3f({ 1.f, 3.f, 2.f }));
+  const Raz::Sphere transformedSphere = sphere.computeTransformedSphere(transform.computeTransformMatrix());
+
+  REQUIRE(transformedSphere.getRadius() == Approx(6.f));
+  REQUIRE(transformedSphere.getCenter()[0] == Approx(0.f).margin(0.0001f));
+  REQUIRE(transformedSphere.getCenter()[1] == Approx(6.f));
+  REQUIRE(transformedSphere.getCenter()[2] == Approx(0.f).margin(0.0001f));
+}
@@ -0,0 +1,32 @@
+#include "catch/catch.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
+
+#include <atomic>
+
+TEST_CASE("ThreadPool tasks") {
+  Raz::ThreadPool threadPool(4);
+  REQUIRE(threadPool.getThreadCount() == 4);
+
+  std::atomic<std::size_t> counter(0);
+  std::vector<std::size_t> values(1000);
+
+  for (std::size_t taskIndex = 0; taskIndex < values.size(); ++taskIndex) {
+    threadPool.addTask([&counter, &values, taskIndex] () {
+      values[taskIndex] = taskIndex * 2;
+      ++counter;
+    });
+  }
+
+  threadPool.wait();
+  REQUIRE(counter == values.size());
+
+  for (std::size_t valueIndex = 0; valueIndex < values.size(); ++valueIndex)
+    REQUIRE(values[valueIndex] == valueIndex * 2);
+
+  // The pool can be reused once its tasks are finished
+  threadPool.addTask([&counter] () { counter = 0; });
+  threadPool.wait();
+  REQUIRE(counter == 0);
+
+  REQUIRE(Raz::ThreadPool().getThreadCount() >= 1);
+}
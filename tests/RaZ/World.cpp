@@ -0,0 +1,75 @@
+#include "catch/catch.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+
+namespace {
+
+// Declaring a world whose entities are aligned along the Z axis, in front of a ray going forward
+//
+//   [ 0; 0; 0 ] ----->  Sphere (Z 5, radius 1)  |  AABB (Z [ 9; 11 ])  |  Sphere (Z 20, radius 1) + Transform  |  Plane (Z 30)
+
+Raz::World createWorld() {
+  Raz::World world(5);
+
+  world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f({ 0.f, 0.f, 5.f }), 1.f);
+  world.addEntityWithComponent<Raz::AABB>(Raz::Vec3f({ 1.f, 1.f, 11.f }), Raz::Vec3f({ -1.f, -1.f, 9.f }));
+
+  Raz::Entity& transformedSphere = world.addEntityWithComponent<Raz::Sphere>(Raz::Vec3f({ 0.f, 0.f, 20.f }), 1.f);
+  transformedSphere.addComponent<Raz::Transform>();
+
+  world.addEntityWithComponent<Raz::Plane>(-30.f, -Raz::Axis::Z);
+
+  return world;
+}
+
+} // namespace
+
+TEST_CASE("World raycast") {
+  Raz::World world = createWorld();
+  const Raz::Ray ray(Raz::Vec3f(0.f), Raz::Axis::Z);
+
+  Raz::RayHit hit;
+  REQUIRE(world.raycast(ray, hit));
+  REQUIRE(hit.entity == world.getEntities()[0].get());
+  REQUIRE(hit.distance == Approx(4.f));
+  REQUIRE(hit.position == Raz::Vec3f({ 0.f, 0.f, 4.f }));
+  REQUIRE(hit.normal == -Raz::Axis::Z);
+
+  // Disabling the sphere makes the box the closest entity
+  world.getEntities()[0]->disable();
+  REQUIRE(world.raycast(ray, hit));
+  REQUIRE(hit.entity == world.getEntities()[1].get());
+  REQUIRE(hit.distance == Approx(9.f));
+
+  // Limiting the distance prevents reaching any entity
+  REQUIRE_FALSE(world.raycast(ray, hit, 8.f));
+
+  // Restricting the entities to those having a Transform skips the box
+  Raz::Bitset componentMask;
+  componentMask.setBit(Raz::Component::getId<Raz::Transform>());
+
+  REQUIRE(world.raycast(ray, hit, std::numeric_limits<float>::max(), componentMask));
+  REQUIRE(hit.entity == world.getEntities()[2].get());
+  REQUIRE(hit.distance == Approx(19.f));
+
+  // A ray going away from the entities hits none of them
+  REQUIRE_FALSE(world.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z), hit));
+}
+
+TEST_CASE("World raycast all") {
+  Raz::World world = createWorld();
+  const Raz::Ray ray(Raz::Vec3f(0.f), Raz::Axis::Z);
+
+  std::vector<Raz::RayHit> hits = world.raycastAll(ray);
+  REQUIRE(hits.size() == 4);
+
+  REQUIRE(hits[0].distance == Approx(4.f));
+  REQUIRE(hits[1].distance == Approx(9.f));
+  REQUIRE(hits[2].distance == Approx(19.f));
+  REQUIRE(hits[3].distance == Approx(30.f));
+  REQUIRE(hits[3].normal == -Raz::Axis::Z);
+
+  hits = world.raycastAll(ray, 15.f);
+  REQUIRE(hits.size() == 2);
+  REQUIRE(hits[1].entity == world.getEntities()[1].get());
+}